@@ -0,0 +1,515 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_bench.c
+/// @brief A benchmark of the conversion functions that prints its results as CSV or JSON
+
+
+#include "conv_endian.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/*
+
+    Usage: conv_endian_bench [--format csv|json] [--filter text]
+                             [--max-bytes bytes] [--min-time-ms ms]
+
+    Every scalar function is timed in nanoseconds per call. The value
+    conversions are timed as a chain of calls that each depend on the
+    previous one, so they give the latency of a call, while loads and stores
+    walk a buffer that stays in the L1 cache.
+
+    Every bulk function is timed in gigabytes per second for each kernel the
+    processor supports and for arrays from 4 KiB, which stays in the L1
+    cache, up to --max-bytes (128 MiB by default), which comes from memory.
+    Out of place conversions count the bytes of the source array only.
+
+    Each measurement is repeated five times for at least --min-time-ms
+    (20 ms by default) and the fastest run is reported.
+
+*/
+
+#define BENCH_RUNS 5
+
+typedef struct bench_options
+{
+    int json;
+    const char* filter;
+    size_t max_bytes;
+    double min_time;
+} bench_options;
+
+static bench_options options = { 0, NULL, (size_t)128 * 1024 * 1024, 0.02 };
+static int rows_printed;
+
+static double now_seconds(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+static int selected(const char* name)
+{
+    return options.filter == NULL || strstr(name, options.filter) != NULL;
+}
+
+static void print_row(const char* group, const char* name, const char* kernel, size_t bytes, double ns_per_call, double gb_per_s)
+{
+    if (options.json)
+    {
+        printf("%s\n    {\"group\": \"%s\", \"function\": \"%s\", \"kernel\": \"%s\", \"bytes\": %lu, \"ns_per_call\": %.3f, \"gb_per_s\": %.3f}",
+            rows_printed == 0 ? "" : ",", group, name, kernel, (unsigned long)bytes, ns_per_call, gb_per_s);
+    }
+    else
+    {
+        printf("%s,%s,%s,%lu,%.3f,%.3f\n", group, name, kernel, (unsigned long)bytes, ns_per_call, gb_per_s);
+    }
+
+    rows_printed++;
+    fflush(stdout);
+}
+
+/*
+
+    Timing
+
+    A measured function runs a number of iterations and returns a value
+    that is kept in a volatile sink so that its work cannot be discarded
+
+*/
+
+typedef uint64_t (*bench_func)(void* ctx, size_t iterations);
+
+static volatile uint64_t sink;
+
+/// @brief Times a function
+/// @return fastest time of a single iteration in seconds
+static double measure(bench_func func, void* ctx)
+{
+    size_t iterations = 1;
+    double best = 0.0;
+    int run;
+
+    // grow the number of iterations until a run takes long enough
+    for (;;)
+    {
+        double start = now_seconds();
+        double elapsed;
+
+        sink = func(ctx, iterations);
+        elapsed = now_seconds() - start;
+
+        if (elapsed >= options.min_time)
+            break;
+
+        iterations *= elapsed > 0.0 && options.min_time / elapsed < 16.0 ? 2 : 16;
+    }
+
+    for (run = 0; run < BENCH_RUNS; run++)
+    {
+        double start = now_seconds();
+        double elapsed;
+
+        sink = func(ctx, iterations);
+        elapsed = (now_seconds() - start) / (double)iterations;
+
+        if (run == 0 || elapsed < best)
+            best = elapsed;
+    }
+
+    return best;
+}
+
+/*
+
+    Scalar functions
+
+*/
+
+#define SCALAR_BUFFER 4096
+
+static unsigned char scalar_buffer[SCALAR_BUFFER + 8];
+
+#define BENCH_VALUE(name, type, bits) \
+    static uint64_t bench_##name(void* ctx, size_t iterations) \
+    { \
+        type val; \
+        size_t i; \
+        (void)ctx; \
+        memcpy(&val, scalar_buffer, sizeof(val)); \
+        for (i = 0; i < iterations; i++) \
+            val = name(val); \
+        { \
+            uint##bits##_t out; \
+            memcpy(&out, &val, sizeof(out)); \
+            return out; \
+        } \
+    }
+
+#define BENCH_LOAD_STORE(suffix, type, bits) \
+    static uint64_t bench_load_##suffix(void* ctx, size_t iterations) \
+    { \
+        uint64_t sum = 0; \
+        size_t i; \
+        (void)ctx; \
+        for (i = 0; i < iterations; i++) \
+        { \
+            type val = load_##suffix(scalar_buffer + (i * (bits / 8)) % SCALAR_BUFFER); \
+            uint##bits##_t out; \
+            memcpy(&out, &val, sizeof(out)); \
+            sum ^= out; \
+        } \
+        return sum; \
+    } \
+    static uint64_t bench_store_##suffix(void* ctx, size_t iterations) \
+    { \
+        size_t i; \
+        (void)ctx; \
+        for (i = 0; i < iterations; i++) \
+            store_##suffix(scalar_buffer + (i * (bits / 8)) % SCALAR_BUFFER, (type)(i & 0x7fff)); \
+        return scalar_buffer[0]; \
+    }
+
+#define BENCH_TYPE(t, type, bits) \
+    BENCH_VALUE(read_le_##t, type, bits) \
+    BENCH_VALUE(convert_to_le_##t, type, bits) \
+    BENCH_VALUE(read_be_##t, type, bits) \
+    BENCH_VALUE(convert_to_be_##t, type, bits) \
+    BENCH_LOAD_STORE(le_##t, type, bits) \
+    BENCH_LOAD_STORE(be_##t, type, bits)
+
+BENCH_TYPE(u16, uint16_t, 16)
+BENCH_TYPE(s16, int16_t, 16)
+BENCH_TYPE(u32, uint32_t, 32)
+BENCH_TYPE(s32, int32_t, 32)
+BENCH_TYPE(f32, float, 32)
+BENCH_TYPE(u64, uint64_t, 64)
+BENCH_TYPE(s64, int64_t, 64)
+BENCH_TYPE(f64, double, 64)
+
+typedef struct scalar_bench
+{
+    const char* name;
+    bench_func func;
+} scalar_bench;
+
+#define SCALAR_ENTRIES(t) \
+    { "read_le_" #t, bench_read_le_##t }, \
+    { "convert_to_le_" #t, bench_convert_to_le_##t }, \
+    { "read_be_" #t, bench_read_be_##t }, \
+    { "convert_to_be_" #t, bench_convert_to_be_##t }, \
+    { "load_le_" #t, bench_load_le_##t }, \
+    { "store_le_" #t, bench_store_le_##t }, \
+    { "load_be_" #t, bench_load_be_##t }, \
+    { "store_be_" #t, bench_store_be_##t }
+
+static const scalar_bench scalar_benches[] =
+{
+    SCALAR_ENTRIES(u16),
+    SCALAR_ENTRIES(s16),
+    SCALAR_ENTRIES(u32),
+    SCALAR_ENTRIES(s32),
+    SCALAR_ENTRIES(f32),
+    SCALAR_ENTRIES(u64),
+    SCALAR_ENTRIES(s64),
+    SCALAR_ENTRIES(f64)
+};
+
+static void run_scalar_benches(void)
+{
+    size_t i;
+
+    // a value that is not a NaN in either byte order, so that floating
+    // point chains never turn into NaN
+    for (i = 0; i < SCALAR_BUFFER + 8; i++)
+        scalar_buffer[i] = (unsigned char)(0x3f - (i % 8));
+
+    for (i = 0; i < sizeof(scalar_benches) / sizeof(scalar_benches[0]); i++)
+    {
+        double seconds;
+
+        if (!selected(scalar_benches[i].name))
+            continue;
+
+        seconds = measure(scalar_benches[i].func, NULL);
+        print_row("scalar", scalar_benches[i].name, "none", 0, seconds * 1e9, 0.0);
+    }
+}
+
+/*
+
+    Bulk functions
+
+*/
+
+typedef struct bulk_context
+{
+    unsigned char* dst;
+    const unsigned char* src;
+    size_t bytes;
+} bulk_context;
+
+typedef struct bulk_bench
+{
+    const char* name;
+    bench_func func;
+} bulk_bench;
+
+static const uint16_t record_perm[16] = { 3, 2, 1, 0, 5, 4, 7, 6, 15, 14, 13, 12, 11, 10, 9, 8 };
+
+#define BENCH_ARRAY(name, type) \
+    static uint64_t bench_##name(void* ctx, size_t iterations) \
+    { \
+        bulk_context* c = (bulk_context*)ctx; \
+        size_t i; \
+        for (i = 0; i < iterations; i++) \
+            name((type*)c->dst, (const type*)c->src, c->bytes / sizeof(type)); \
+        return c->dst[0]; \
+    } \
+    static uint64_t bench_##name##_inplace(void* ctx, size_t iterations) \
+    { \
+        bulk_context* c = (bulk_context*)ctx; \
+        size_t i; \
+        for (i = 0; i < iterations; i++) \
+            name##_inplace((type*)c->dst, c->bytes / sizeof(type)); \
+        return c->dst[0]; \
+    }
+
+#define BENCH_ARRAY_TYPE(t, type) \
+    BENCH_ARRAY(read_le_##t##_array, type) \
+    BENCH_ARRAY(convert_to_le_##t##_array, type) \
+    BENCH_ARRAY(read_be_##t##_array, type) \
+    BENCH_ARRAY(convert_to_be_##t##_array, type)
+
+BENCH_ARRAY_TYPE(u16, uint16_t)
+BENCH_ARRAY_TYPE(s16, int16_t)
+BENCH_ARRAY_TYPE(u32, uint32_t)
+BENCH_ARRAY_TYPE(s32, int32_t)
+BENCH_ARRAY_TYPE(f32, float)
+BENCH_ARRAY_TYPE(u64, uint64_t)
+BENCH_ARRAY_TYPE(s64, int64_t)
+BENCH_ARRAY_TYPE(f64, double)
+
+#define BENCH_BSWAP(bits) \
+    static uint64_t bench_bswap##bits(void* ctx, size_t iterations) \
+    { \
+        bulk_context* c = (bulk_context*)ctx; \
+        size_t i; \
+        for (i = 0; i < iterations; i++) \
+            conv_endian_bswap##bits##_array(c->dst, c->src, c->bytes / (bits / 8)); \
+        return c->dst[0]; \
+    } \
+    static uint64_t bench_bswap##bits##_stream(void* ctx, size_t iterations) \
+    { \
+        bulk_context* c = (bulk_context*)ctx; \
+        size_t i; \
+        for (i = 0; i < iterations; i++) \
+            conv_endian_bswap##bits##_array_stream(c->dst, c->src, c->bytes / (bits / 8)); \
+        return c->dst[0]; \
+    }
+
+BENCH_BSWAP(16)
+BENCH_BSWAP(32)
+BENCH_BSWAP(64)
+
+static uint64_t bench_permute(void* ctx, size_t iterations)
+{
+    bulk_context* c = (bulk_context*)ctx;
+    size_t i;
+
+    for (i = 0; i < iterations; i++)
+        conv_endian_permute_records(c->dst, c->src, c->bytes / 16, 16, record_perm);
+
+    return c->dst[0];
+}
+
+static uint64_t bench_gather(void* ctx, size_t iterations)
+{
+    bulk_context* c = (bulk_context*)ctx;
+    size_t i;
+
+    // one 32-bit field of 16-byte records, the bytes of the records are counted
+    for (i = 0; i < iterations; i++)
+        conv_endian_gather(c->dst, c->src + 4, 16, c->bytes / 16, 4, CONV_ENDIAN_ORDER_BIG);
+
+    return c->dst[0];
+}
+
+#define BULK_ENTRIES(t) \
+    { "read_le_" #t "_array", bench_read_le_##t##_array }, \
+    { "read_le_" #t "_array_inplace", bench_read_le_##t##_array_inplace }, \
+    { "convert_to_le_" #t "_array", bench_convert_to_le_##t##_array }, \
+    { "convert_to_le_" #t "_array_inplace", bench_convert_to_le_##t##_array_inplace }, \
+    { "read_be_" #t "_array", bench_read_be_##t##_array }, \
+    { "read_be_" #t "_array_inplace", bench_read_be_##t##_array_inplace }, \
+    { "convert_to_be_" #t "_array", bench_convert_to_be_##t##_array }, \
+    { "convert_to_be_" #t "_array_inplace", bench_convert_to_be_##t##_array_inplace }
+
+static const bulk_bench bulk_benches[] =
+{
+    { "conv_endian_bswap16_array", bench_bswap16 },
+    { "conv_endian_bswap32_array", bench_bswap32 },
+    { "conv_endian_bswap64_array", bench_bswap64 },
+    { "conv_endian_bswap16_array_stream", bench_bswap16_stream },
+    { "conv_endian_bswap32_array_stream", bench_bswap32_stream },
+    { "conv_endian_bswap64_array_stream", bench_bswap64_stream },
+    { "conv_endian_permute_records", bench_permute },
+    { "conv_endian_gather", bench_gather },
+    BULK_ENTRIES(u16),
+    BULK_ENTRIES(s16),
+    BULK_ENTRIES(u32),
+    BULK_ENTRIES(s32),
+    BULK_ENTRIES(f32),
+    BULK_ENTRIES(u64),
+    BULK_ENTRIES(s64),
+    BULK_ENTRIES(f64)
+};
+
+static int run_bulk_benches(void)
+{
+    conv_endian_kernel saved = conv_endian_get_kernel();
+    conv_endian_kernel best = conv_endian_best_kernel();
+    unsigned char* dst;
+    unsigned char* src;
+    size_t largest = 4096, bytes, i;
+    int kernel;
+
+    while (largest * 8 <= options.max_bytes)
+        largest *= 8;
+
+    dst = (unsigned char*)malloc(largest);
+    src = (unsigned char*)malloc(largest);
+
+    if (dst == NULL || src == NULL)
+    {
+        fprintf(stderr, "conv_endian_bench: could not allocate two arrays of %lu bytes\n", (unsigned long)largest);
+        free(dst);
+        free(src);
+        return -1;
+    }
+
+    for (i = 0; i < largest; i++)
+    {
+        src[i] = (unsigned char)(i * 131 + 7);
+        dst[i] = src[i];
+    }
+
+    for (kernel = CONV_ENDIAN_KERNEL_SCALAR; kernel <= (int)best; kernel++)
+    {
+        if (conv_endian_set_kernel((conv_endian_kernel)kernel) != 0)
+            continue;
+
+        for (bytes = 4096; bytes <= largest; bytes *= 8)
+        {
+            for (i = 0; i < sizeof(bulk_benches) / sizeof(bulk_benches[0]); i++)
+            {
+                bulk_context ctx;
+                double seconds;
+
+                if (!selected(bulk_benches[i].name))
+                    continue;
+
+                ctx.dst = dst;
+                ctx.src = src;
+                ctx.bytes = bytes;
+
+                seconds = measure(bulk_benches[i].func, &ctx);
+                print_row("bulk", bulk_benches[i].name, conv_endian_kernel_name((conv_endian_kernel)kernel),
+                    bytes, seconds * 1e9, (double)bytes / seconds * 1e-9);
+            }
+        }
+    }
+
+    conv_endian_set_kernel(saved);
+    free(dst);
+    free(src);
+    return 0;
+}
+
+static int parse_options(int argc, char** argv)
+{
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(argv[i], "--format") == 0 && value != NULL && (strcmp(value, "csv") == 0 || strcmp(value, "json") == 0))
+            options.json = strcmp(value, "json") == 0;
+        else if (strcmp(argv[i], "--filter") == 0 && value != NULL)
+            options.filter = value;
+        else if (strcmp(argv[i], "--max-bytes") == 0 && value != NULL && strtoul(value, NULL, 0) >= 4096)
+            options.max_bytes = (size_t)strtoul(value, NULL, 0);
+        else if (strcmp(argv[i], "--min-time-ms") == 0 && value != NULL && atof(value) > 0.0)
+            options.min_time = atof(value) / 1000.0;
+        else
+            return -1;
+
+        i++;
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int result;
+
+    if (parse_options(argc, argv) != 0)
+    {
+        fprintf(stderr, "usage: %s [--format csv|json] [--filter text] [--max-bytes bytes] [--min-time-ms ms]\n", argv[0]);
+        return 2;
+    }
+
+    if (options.json)
+        printf("{\n  \"best_kernel\": \"%s\",\n  \"results\": [", conv_endian_kernel_name(conv_endian_best_kernel()));
+    else
+        printf("group,function,kernel,bytes,ns_per_call,gb_per_s\n");
+
+    run_scalar_benches();
+    result = run_bulk_benches();
+
+    if (options.json)
+        printf("\n  ]\n}\n");
+
+    return result == 0 ? 0 : 1;
+}
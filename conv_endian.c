@@ -28,8 +28,13 @@
 /// @brief A C portable source code that contains implementation of functions for converting between endianness
 
 
+// in header-only mode conv_endian.h includes this file itself
+#ifndef CONV_ENDIAN_C
+#define CONV_ENDIAN_C
+
 #include "conv_endian.h"
 #include <stdint.h>
+#include <string.h>
 
 /*
 
@@ -46,37 +51,71 @@
 /// @brief Reads an 16-bit unsigned little endian integer number
 /// @param val value of a 16-bit unsigned integer in little endian
 /// @return converted value of the unsigned little endian value passed into read_le_u16 in their endianness of their machine
-uint16_t read_le_u16(uint16_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint16_t read_le_u16(uint16_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint16_t)((val_ptr[0] << 0) | (val_ptr[1] << 8));
+    return conv_endian_le16(val);
 }
 
 /// @brief Writes an 16-bit unsigned little endian integer number
 /// @param val value of a 16-bit unsigned integer in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_u16 in their endianness of their machine
-uint16_t convert_to_le_u16(uint16_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint16_t convert_to_le_u16(uint16_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint16_t)((val_ptr[0] >> 0) | (val_ptr[1] >> 8));
+    return conv_endian_le16(val);
 }
 
 /// @brief Reads an 16-bit unsigned big endian integer number
 /// @param val value of a 16-bit unsigned integer in big endian 
 /// @return converted value of the unsigned big endian value passed into read_be_u16 in their endianness of their machine
-uint16_t read_be_u16(uint16_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint16_t read_be_u16(uint16_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint16_t)((val_ptr[1] << 0) | (val_ptr[0] << 8));
+    return conv_endian_be16(val);
 }
 
 /// @brief Writes an 16-bit unsigned big endian integer number
 /// @param val value of a 16-bit unsigned integer in their endianness of their machine 
 /// @return big endian value from value passed into convert_to_be_u16 in their endianness of their machine
-uint16_t convert_to_be_u16(uint16_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint16_t convert_to_be_u16(uint16_t val)
+{
+    return conv_endian_be16(val);
+}
+
+/// @brief Loads an 16-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint16_t load_le_u16(const void* ptr)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint16_t)((val_ptr[1] >> 0) | (val_ptr[0] >> 8));
+    uint16_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_le16(bits);
+}
+
+/// @brief Stores an 16-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit unsigned integer number in little endian
+/// @param val value of a 16-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_u16(void* ptr, uint16_t val)
+{
+    uint16_t bits = conv_endian_le16(val);
+    memcpy(ptr, &bits, sizeof(bits));
+}
+
+/// @brief Loads an 16-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint16_t load_be_u16(const void* ptr)
+{
+    uint16_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_be16(bits);
+}
+
+/// @brief Stores an 16-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit unsigned integer number in big endian
+/// @param val value of a 16-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_u16(void* ptr, uint16_t val)
+{
+    uint16_t bits = conv_endian_be16(val);
+    memcpy(ptr, &bits, sizeof(bits));
 }
 
 /*
@@ -88,37 +127,71 @@ uint16_t convert_to_be_u16(uint16_t val)
 /// @brief Reads an 16-bit signed little endian integer number
 /// @param val value of a 16-bit signed integer in little endian
 /// @return converted value of the signed little endian value passed into read_le_s16 in their endianness of their machine
-int16_t read_le_s16(int16_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int16_t read_le_s16(int16_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (int16_t)((val_ptr[0] << 0) | (val_ptr[1] << 8));
+    return (int16_t)conv_endian_le16((uint16_t)val);
 }
 
 /// @brief Writes an 16-bit signed little endian integer number
 /// @param val value of a 16-bit signed integer in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_s16 in their endianness of their machine
-int16_t convert_to_le_s16(int16_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int16_t convert_to_le_s16(int16_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (int16_t)((val_ptr[0] >> 0) | (val_ptr[1] >> 8));
+    return (int16_t)conv_endian_le16((uint16_t)val);
 }
 
 /// @brief Reads an 16-bit signed big endian integer number
 /// @param val value of a 16-bit signed integer in big endian 
 /// @return converted value of the signed big endian value passed into read_be_s16 in their endianness of their machine
-int16_t read_be_s16(int16_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int16_t read_be_s16(int16_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (int16_t)((val_ptr[1] << 0) | (val_ptr[0] << 8));
+    return (int16_t)conv_endian_be16((uint16_t)val);
 }
 
 /// @brief Writes an 16-bit signed big endian integer number
 /// @param val value of a 16-bit signed integer in their endianness of their machine 
 /// @return big endian value from value passed into convert_to_be_s16 in their endianness of their machine
-int16_t convert_to_be_s16(int16_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int16_t convert_to_be_s16(int16_t val)
+{
+    return (int16_t)conv_endian_be16((uint16_t)val);
+}
+
+/// @brief Loads an 16-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int16_t load_le_s16(const void* ptr)
+{
+    uint16_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return (int16_t)conv_endian_le16(bits);
+}
+
+/// @brief Stores an 16-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit signed integer number in little endian
+/// @param val value of a 16-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_s16(void* ptr, int16_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (int16_t)((val_ptr[1] >> 0) | (val_ptr[0] >> 8));
+    uint16_t bits = conv_endian_le16((uint16_t)val);
+    memcpy(ptr, &bits, sizeof(bits));
+}
+
+/// @brief Loads an 16-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int16_t load_be_s16(const void* ptr)
+{
+    uint16_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return (int16_t)conv_endian_be16(bits);
+}
+
+/// @brief Stores an 16-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit signed integer number in big endian
+/// @param val value of a 16-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_s16(void* ptr, int16_t val)
+{
+    uint16_t bits = conv_endian_be16((uint16_t)val);
+    memcpy(ptr, &bits, sizeof(bits));
 }
 
 /*
@@ -140,39 +213,71 @@ int16_t convert_to_be_s16(int16_t val)
 /// @brief Reads an 32-bit unsigned little endian integer number
 /// @param val value of a 32-bit unsigned integer in little endian
 /// @return converted value of the unsigned little endian value passed into read_le_u32 in their endianness of their machine
-uint32_t read_le_u32(uint32_t val) 
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint32_t read_le_u32(uint32_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-
-    return (uint32_t)((val_ptr[0] << 0) | (val_ptr[1] << 8) | (val_ptr[2] << 16) | (val_ptr[3] << 24));
+    return conv_endian_le32(val);
 }
 
 /// @brief Writes an 32-bit unsigned little endian integer number
 /// @param val value of a 32-bit unsigned integer in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_u32 in their endianness of their machine
-uint32_t convert_to_le_u32(uint32_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint32_t convert_to_le_u32(uint32_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-
-    return (uint32_t)((val_ptr[0] >> 0) | (val_ptr[1] >> 8) | (val_ptr[2] >> 16) | (val_ptr[3] >> 24));
+    return conv_endian_le32(val);
 }
 
 /// @brief Reads an 32-bit unsigned big endian integer number
 /// @param val value of a 32-bit unsigned integer in big endian 
 /// @return converted value of the unsigned big endian value passed into read_be_u32 in their endianness of their machine
-uint32_t read_be_u32(uint32_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint32_t read_be_u32(uint32_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint32_t)((val_ptr[3] << 0) | (val_ptr[2] << 8) | (val_ptr[1] << 16) | (val_ptr[0] << 24));
+    return conv_endian_be32(val);
 }
 
 /// @brief Writes an 32 bit unsigned big endian integer number
 /// @param val value of a 32-bit unsigned integer in their endianness of their machine 
 /// @return big endian value from value passed into convert_to_be_u32 in their endianness of their machine
-uint32_t convert_to_be_u32(uint32_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint32_t convert_to_be_u32(uint32_t val)
+{
+    return conv_endian_be32(val);
+}
+
+/// @brief Loads an 32-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint32_t load_le_u32(const void* ptr)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint32_t)((val_ptr[3] >> 0) | (val_ptr[2] >> 8) | (val_ptr[1] >> 16) | (val_ptr[0] >> 24));
+    uint32_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_le32(bits);
+}
+
+/// @brief Stores an 32-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit unsigned integer number in little endian
+/// @param val value of a 32-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_u32(void* ptr, uint32_t val)
+{
+    uint32_t bits = conv_endian_le32(val);
+    memcpy(ptr, &bits, sizeof(bits));
+}
+
+/// @brief Loads an 32-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint32_t load_be_u32(const void* ptr)
+{
+    uint32_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_be32(bits);
+}
+
+/// @brief Stores an 32-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit unsigned integer number in big endian
+/// @param val value of a 32-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_u32(void* ptr, uint32_t val)
+{
+    uint32_t bits = conv_endian_be32(val);
+    memcpy(ptr, &bits, sizeof(bits));
 }
 
 
@@ -184,55 +289,71 @@ uint32_t convert_to_be_u32(uint32_t val)
 /// @brief Reads an 32-bit signed little endian integer number
 /// @param val value of a 32-bit signed integer in little endian
 /// @return converted value of the signed little endian value passed into read_le_s32 in their endianness of their machine
-int32_t read_le_s32(int32_t val) 
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int32_t read_le_s32(int32_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-
-    return (int32_t)((val_ptr[0] << 0) | (val_ptr[1] << 8) | (val_ptr[2] << 16) | (val_ptr[3] << 24));
+    return (int32_t)conv_endian_le32((uint32_t)val);
 }
 
 /// @brief Writes an 32-bit signed little endian integer number
 /// @param val value of a 32-bit signed integer in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_s32 in their endianness of their machine
-int32_t convert_to_le_s32(int32_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int32_t convert_to_le_s32(int32_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-
-    return (int32_t)((val_ptr[0] >> 0) | (val_ptr[1] >> 8) | (val_ptr[2] >> 16) | (val_ptr[3] >> 24));
+    return (int32_t)conv_endian_le32((uint32_t)val);
 }
 
 /// @brief Reads an 32-bit signed big endian integer number
 /// @param val value of a 32-bit signed integer in big endian 
 /// @return converted value of the signed big endian value passed into read_be_s32 in their endianness of their machine
-int32_t read_be_s32(int32_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int32_t read_be_s32(int32_t val)
 {
-    uint32_t reintrepreted_val = *(uint32_t*)&val;
-
-    uint8_t bytes[4];
-
-    bytes[0] = (uint64_t)reintrepreted_val << 0;
-    bytes[1] = (uint64_t)reintrepreted_val << 8;
-    bytes[2] = (uint64_t)reintrepreted_val << 16;
-    bytes[3] = (uint64_t)reintrepreted_val << 24;
-
-    return *(int32_t*)bytes;
+    return (int32_t)conv_endian_be32((uint32_t)val);
 }
 
 /// @brief Writes an 32-bit signed big endian integer number
 /// @param val value of a 32-bit signed integer in their endianness of their machine 
 /// @return big endian value from value passed into convert_to_be_s32 in their endianness of their machine
-int32_t convert_to_be_s32(int32_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int32_t convert_to_be_s32(int32_t val)
+{
+    return (int32_t)conv_endian_be32((uint32_t)val);
+}
+
+/// @brief Loads an 32-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int32_t load_le_s32(const void* ptr)
 {
-    uint32_t reintrepreted_val = *(uint32_t*)&val;
+    uint32_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return (int32_t)conv_endian_le32(bits);
+}
 
-    uint8_t bytes[4];
+/// @brief Stores an 32-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit signed integer number in little endian
+/// @param val value of a 32-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_s32(void* ptr, int32_t val)
+{
+    uint32_t bits = conv_endian_le32((uint32_t)val);
+    memcpy(ptr, &bits, sizeof(bits));
+}
 
-    bytes[0] = (uint64_t)reintrepreted_val >> 0;
-    bytes[1] = (uint64_t)reintrepreted_val >> 8;
-    bytes[2] = (uint64_t)reintrepreted_val >> 16;
-    bytes[3] = (uint64_t)reintrepreted_val >> 24;
+/// @brief Loads an 32-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int32_t load_be_s32(const void* ptr)
+{
+    uint32_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return (int32_t)conv_endian_be32(bits);
+}
 
-    return *(int32_t*)bytes;
+/// @brief Stores an 32-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit signed integer number in big endian
+/// @param val value of a 32-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_s32(void* ptr, int32_t val)
+{
+    uint32_t bits = conv_endian_be32((uint32_t)val);
+    memcpy(ptr, &bits, sizeof(bits));
 }
 
 /*
@@ -244,89 +365,71 @@ int32_t convert_to_be_s32(int32_t val)
 /// @brief Reads an 32-bit little endian floating point number
 /// @param val value of a 32-bit floating point number in little endian
 /// @return converted value of the little endian value passed into read_le_f32 in their endianness of their machine
-float read_le_f32(float val) 
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT float read_le_f32(float val)
 {
-    // by writing this code like that
-    // prevent dereferencing type-punned pointer 
-    // breaking strict-aliasing rules warning
-
-    uint32_t* ptr_val = (uint32_t*)&val;
-    uint32_t reintrepreted_val = *ptr_val;
-
-    uint8_t bytes[4];
-
-    bytes[0] = (uint64_t)reintrepreted_val << 0;
-    bytes[1] = (uint64_t)reintrepreted_val << 8;
-    bytes[2] = (uint64_t)reintrepreted_val << 16;
-    bytes[3] = (uint64_t)reintrepreted_val << 24;
-
-    return *(float*)bytes;
+    return conv_endian_bits_f32(conv_endian_le32(conv_endian_f32_bits(val)));
 }
 
 /// @brief Writes an 32-bit little endian floating point number
 /// @param val value of a 32-bit floating point number in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_f32 in their endianness of their machine
-float convert_to_le_f32(float val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT float convert_to_le_f32(float val)
 {
-    // by writing this code like that
-    // prevent dereferencing type-punned pointer 
-    // breaking strict-aliasing rules warning
-
-    uint32_t* ptr_val = (uint32_t*)&val;
-    uint32_t reintrepreted_val = *ptr_val;
-
-    uint8_t bytes[4];
-
-    bytes[0] = (uint32_t)reintrepreted_val >> 0;
-    bytes[1] = (uint32_t)reintrepreted_val >> 8;
-    bytes[2] = (uint32_t)reintrepreted_val >> 16;
-    bytes[3] = (uint32_t)reintrepreted_val >> 24;
-
-    return *(float*)bytes;
+    return conv_endian_bits_f32(conv_endian_le32(conv_endian_f32_bits(val)));
 }
 
 /// @brief Reads an 32-bit big endian floating point number
 /// @param val value of a 32-bit floating point number in big endian
 /// @return converted value of the big endian value passed into read_be_f32 in their endianness of their machine
-float read_be_f32(float val) 
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT float read_be_f32(float val)
 {
-    // by writing this code like that
-    // prevent dereferencing type-punned pointer 
-    // breaking strict-aliasing rules warning
-
-    uint32_t* ptr_val = (uint32_t*)&val;
-    uint32_t reintrepreted_val = *ptr_val;
-
-    uint8_t bytes[4];
-
-    bytes[0] = (uint32_t)reintrepreted_val << 24;
-    bytes[1] = (uint32_t)reintrepreted_val << 16;
-    bytes[2] = (uint32_t)reintrepreted_val << 8;
-    bytes[3] = (uint32_t)reintrepreted_val << 0;
-
-    return *(float*)bytes;
+    return conv_endian_bits_f32(conv_endian_be32(conv_endian_f32_bits(val)));
 }
 
 /// @brief Writes an 32-bit big endian floating point number
 /// @param val value of a 32-bit floating point number in their endianness of their machine
 /// @return big endian value from value passed into convert_to_be_f32 in their endianness of their machine
-float convert_to_be_f32(float val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT float convert_to_be_f32(float val)
 {
-    // by writing this code like that
-    // prevent dereferencing type-punned pointer 
-    // breaking strict-aliasing rules warning
+    return conv_endian_bits_f32(conv_endian_be32(conv_endian_f32_bits(val)));
+}
 
-    uint32_t* ptr_val = (uint32_t*)&val;
-    uint32_t reintrepreted_val = *ptr_val;
+/// @brief Loads an 32-bit little endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit floating point number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC float load_le_f32(const void* ptr)
+{
+    uint32_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_bits_f32(conv_endian_le32(bits));
+}
 
-    uint8_t bytes[4];
+/// @brief Stores an 32-bit little endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit floating point number in little endian
+/// @param val value of a 32-bit floating point number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_f32(void* ptr, float val)
+{
+    uint32_t bits = conv_endian_le32(conv_endian_f32_bits(val));
+    memcpy(ptr, &bits, sizeof(bits));
+}
 
-    bytes[0] = (uint32_t)reintrepreted_val >> 24;
-    bytes[1] = (uint32_t)reintrepreted_val >> 16;
-    bytes[2] = (uint32_t)reintrepreted_val >> 8;
-    bytes[3] = (uint32_t)reintrepreted_val >> 0;
+/// @brief Loads an 32-bit big endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit floating point number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC float load_be_f32(const void* ptr)
+{
+    uint32_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_bits_f32(conv_endian_be32(bits));
+}
 
-    return *(float*)bytes;
+/// @brief Stores an 32-bit big endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit floating point number in big endian
+/// @param val value of a 32-bit floating point number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_f32(void* ptr, float val)
+{
+    uint32_t bits = conv_endian_be32(conv_endian_f32_bits(val));
+    memcpy(ptr, &bits, sizeof(bits));
 }
 
 
@@ -350,73 +453,71 @@ float convert_to_be_f32(float val)
 /// @brief Reads an 64-bit little endian integer number
 /// @param val value of a 64-bit unsigned integer in little endian
 /// @return converted value of the signed value passed into read_le_u64 in their endianness of their machine
-uint64_t read_le_u64(uint64_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint64_t read_le_u64(uint64_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint64_t)(
-        ((uint64_t)val_ptr[0] << 0) | 
-        ((uint64_t)val_ptr[1] << 8) | 
-        ((uint64_t)val_ptr[2] << 16) | 
-        ((uint64_t)val_ptr[3] << 24) | 
-        ((uint64_t)val_ptr[4] << 32) | 
-        ((uint64_t)val_ptr[5] << 40) | 
-        ((uint64_t)val_ptr[6] << 48) | 
-        ((uint64_t)val_ptr[7] << 56)
-    );
+    return conv_endian_le64(val);
 }
 
 /// @brief Writes an 64-bit little endian integer number
 /// @param val value of a number in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_u64 in their endianness of their machine
-uint64_t convert_to_le_u64(uint64_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint64_t convert_to_le_u64(uint64_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint64_t)(
-        ((uint64_t)val_ptr[0] >> 0) | 
-        ((uint64_t)val_ptr[1] >> 8) | 
-        ((uint64_t)val_ptr[2] >> 16) | 
-        ((uint64_t)val_ptr[3] >> 24) | 
-        ((uint64_t)val_ptr[4] >> 32) | 
-        ((uint64_t)val_ptr[5] >> 40) | 
-        ((uint64_t)val_ptr[6] >> 48) | 
-        ((uint64_t)val_ptr[7] >> 56)
-    );
+    return conv_endian_le64(val);
 }
 
 /// @brief Reads an 64-bit big endian integer number
 /// @param val value of a 64-bit unsigned integer in big endian 
 /// @return converted value of the unsigned big endian value passed into read_be_u64 in their endianness of their machine
-uint64_t read_be_u64(uint64_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint64_t read_be_u64(uint64_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint64_t)(
-        ((uint64_t)val_ptr[7] << 0) | 
-        ((uint64_t)val_ptr[6] << 8) | 
-        ((uint64_t)val_ptr[5] << 16) | 
-        ((uint64_t)val_ptr[4] << 24) | 
-        ((uint64_t)val_ptr[3] << 32) | 
-        ((uint64_t)val_ptr[2] << 40) | 
-        ((uint64_t)val_ptr[1] << 48) | 
-        ((uint64_t)val_ptr[0] << 56)
-    );
+    return conv_endian_be64(val);
 }
 
 /// @brief Writes an 64-bit big endian integer number
 /// @param val value of a number in their endianness of their machine 
 /// @return big endian value from the value passed into convert_to_be_u64 in their endianness of their machine
-uint64_t convert_to_be_u64(uint64_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint64_t convert_to_be_u64(uint64_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (uint64_t)(
-        ((uint64_t)val_ptr[7] >> 0) | 
-        ((uint64_t)val_ptr[6] >> 8) | 
-        ((uint64_t)val_ptr[5] >> 16) | 
-        ((uint64_t)val_ptr[4] >> 24) | 
-        ((uint64_t)val_ptr[3] >> 32) | 
-        ((uint64_t)val_ptr[2] >> 40) | 
-        ((uint64_t)val_ptr[1] >> 48) | 
-        ((uint64_t)val_ptr[0] >> 56)
-    );
+    return conv_endian_be64(val);
+}
+
+/// @brief Loads an 64-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint64_t load_le_u64(const void* ptr)
+{
+    uint64_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_le64(bits);
+}
+
+/// @brief Stores an 64-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit unsigned integer number in little endian
+/// @param val value of a 64-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_u64(void* ptr, uint64_t val)
+{
+    uint64_t bits = conv_endian_le64(val);
+    memcpy(ptr, &bits, sizeof(bits));
+}
+
+/// @brief Loads an 64-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint64_t load_be_u64(const void* ptr)
+{
+    uint64_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_be64(bits);
+}
+
+/// @brief Stores an 64-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit unsigned integer number in big endian
+/// @param val value of a 64-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_u64(void* ptr, uint64_t val)
+{
+    uint64_t bits = conv_endian_be64(val);
+    memcpy(ptr, &bits, sizeof(bits));
 }
 
 /*
@@ -428,73 +529,71 @@ uint64_t convert_to_be_u64(uint64_t val)
 /// @brief Reads an 64-bit little endian integer number
 /// @param val value of a an 64-bit integer in little endian
 /// @return converted value of the signed value passed into read_le_s64 in their endianness of their machine
-int64_t read_le_s64(int64_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int64_t read_le_s64(int64_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (int64_t)(
-        ((int64_t)val_ptr[0] << 0) | 
-        ((int64_t)val_ptr[1] << 8) | 
-        ((int64_t)val_ptr[2] << 16) | 
-        ((int64_t)val_ptr[3] << 24) | 
-        ((int64_t)val_ptr[4] << 32) | 
-        ((int64_t)val_ptr[5] << 40) | 
-        ((int64_t)val_ptr[6] << 48) | 
-        ((int64_t)val_ptr[7] << 56)
-    );
+    return (int64_t)conv_endian_le64((uint64_t)val);
 }
 
 /// @brief Writes an 64-bit little endian integer number
 /// @param val value of a number in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_s64 in their endianness of their machine
-int64_t convert_to_le_s64(int64_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int64_t convert_to_le_s64(int64_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (int64_t)(
-        ((int64_t)val_ptr[0] >> 0) | 
-        ((int64_t)val_ptr[1] >> 8) | 
-        ((int64_t)val_ptr[2] >> 16) | 
-        ((int64_t)val_ptr[3] >> 24) | 
-        ((int64_t)val_ptr[4] >> 32) | 
-        ((int64_t)val_ptr[5] >> 40) | 
-        ((int64_t)val_ptr[6] >> 48) | 
-        ((int64_t)val_ptr[7] >> 56)
-    );
+    return (int64_t)conv_endian_le64((uint64_t)val);
 }
 
 /// @brief Reads an 64-bit big endian integer number
 /// @param val value of a number in big endian 
 /// @return converted value of the signed value passed into read_be_s64 in their endianness of their machine
-int64_t read_be_s64(int64_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int64_t read_be_s64(int64_t val)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (int64_t)(
-        ((int64_t)val_ptr[7] << 0) | 
-        ((int64_t)val_ptr[6] << 8) | 
-        ((int64_t)val_ptr[5] << 16) | 
-        ((int64_t)val_ptr[4] << 24) | 
-        ((int64_t)val_ptr[3] << 32) | 
-        ((int64_t)val_ptr[2] << 40) | 
-        ((int64_t)val_ptr[1] << 48) | 
-        ((int64_t)val_ptr[0] << 56)
-    );
+    return (int64_t)conv_endian_be64((uint64_t)val);
 }
 
 /// @brief Writes an 64-bit big endian integer number
 /// @param val value of a number in their endianness of their machine 
 /// @return big endian value from the value passed into convert_to_be_s64 in their endianness of their machine
-int64_t convert_to_be_s64(int64_t val)
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int64_t convert_to_be_s64(int64_t val)
+{
+    return (int64_t)conv_endian_be64((uint64_t)val);
+}
+
+/// @brief Loads an 64-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int64_t load_le_s64(const void* ptr)
 {
-    uint8_t* val_ptr = (uint8_t*)&val;
-    return (int64_t)(
-        ((int64_t)val_ptr[7] >> 0) | 
-        ((int64_t)val_ptr[6] >> 8) | 
-        ((int64_t)val_ptr[5] >> 16) | 
-        ((int64_t)val_ptr[4] >> 24) | 
-        ((int64_t)val_ptr[3] >> 32) | 
-        ((int64_t)val_ptr[2] >> 40) | 
-        ((int64_t)val_ptr[1] >> 48) | 
-        ((int64_t)val_ptr[0] >> 56)
-    );
+    uint64_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return (int64_t)conv_endian_le64(bits);
+}
+
+/// @brief Stores an 64-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit signed integer number in little endian
+/// @param val value of a 64-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_s64(void* ptr, int64_t val)
+{
+    uint64_t bits = conv_endian_le64((uint64_t)val);
+    memcpy(ptr, &bits, sizeof(bits));
+}
+
+/// @brief Loads an 64-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int64_t load_be_s64(const void* ptr)
+{
+    uint64_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return (int64_t)conv_endian_be64(bits);
+}
+
+/// @brief Stores an 64-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit signed integer number in big endian
+/// @param val value of a 64-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_s64(void* ptr, int64_t val)
+{
+    uint64_t bits = conv_endian_be64((uint64_t)val);
+    memcpy(ptr, &bits, sizeof(bits));
 }
 
 /*
@@ -507,105 +606,369 @@ int64_t convert_to_be_s64(int64_t val)
 /// @brief Reads an 64-bit little endian floating point number
 /// @param val value of a 64-bit floating point number in little endian
 /// @return converted value of the little endian value passed into read_le_f64 in their endianness of their machine
-double read_le_f64(double val) 
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT double read_le_f64(double val)
 {
-    // by writing this code like that
-    // prevent dereferencing type-punned pointer 
-    // breaking strict-aliasing rules warning
+    return conv_endian_bits_f64(conv_endian_le64(conv_endian_f64_bits(val)));
+}
 
-    uint64_t* ptr_val = (uint64_t*)&val;
-    uint64_t reintrepreted_val = *ptr_val;
+/// @brief Writes an 64-bit little endian floating point number
+/// @param val value of a 64-bit floating point number in their endianness of their machine
+/// @return little endian double-precision value from value passed into convert_to_le_f64 in their endianness of their machine
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT double convert_to_le_f64(double val)
+{
+    return conv_endian_bits_f64(conv_endian_le64(conv_endian_f64_bits(val)));
+}
 
-    uint8_t bytes[8];
+/// @brief Reads an 64-bit big endian floating point number
+/// @param val value of a 64-bit floating point number in big endian
+/// @return converted value of the big endian value passed into read_be_f64 in their endianness of their machine
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT double read_be_f64(double val)
+{
+    return conv_endian_bits_f64(conv_endian_be64(conv_endian_f64_bits(val)));
+}
 
-    bytes[0] = (uint64_t)reintrepreted_val << 0;
-    bytes[1] = (uint64_t)reintrepreted_val << 8;
-    bytes[2] = (uint64_t)reintrepreted_val << 16;
-    bytes[3] = (uint64_t)reintrepreted_val << 24;
-    bytes[4] = (uint64_t)reintrepreted_val << 32;
-    bytes[5] = (uint64_t)reintrepreted_val << 40;
-    bytes[6] = (uint64_t)reintrepreted_val << 48;
-    bytes[7] = (uint64_t)reintrepreted_val << 56;
+/// @brief Writes an 64-bit big endian floating point number
+/// @param val value of a 64-bit floating point number in their endianness of their machine
+/// @return big endian double-precision value from value passed into convert_to_be_f64 in their endianness of their machine
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT double convert_to_be_f64(double val)
+{
+    return conv_endian_bits_f64(conv_endian_be64(conv_endian_f64_bits(val)));
+}
 
-    return *(double*)bytes;
+/// @brief Loads an 64-bit little endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit floating point number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC double load_le_f64(const void* ptr)
+{
+    uint64_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_bits_f64(conv_endian_le64(bits));
 }
 
-/// @brief Writes an 64-bit little endian floating point number
+/// @brief Stores an 64-bit little endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit floating point number in little endian
 /// @param val value of a 64-bit floating point number in their endianness of their machine
-/// @return little endian double-precision value from value passed into convert_to_le_f64 in their endianness of their machine
-double convert_to_le_f64(double val)
+CONV_ENDIAN_FUNC void store_le_f64(void* ptr, double val)
+{
+    uint64_t bits = conv_endian_le64(conv_endian_f64_bits(val));
+    memcpy(ptr, &bits, sizeof(bits));
+}
+
+/// @brief Loads an 64-bit big endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit floating point number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC double load_be_f64(const void* ptr)
+{
+    uint64_t bits;
+    memcpy(&bits, ptr, sizeof(bits));
+    return conv_endian_bits_f64(conv_endian_be64(bits));
+}
+
+/// @brief Stores an 64-bit big endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit floating point number in big endian
+/// @param val value of a 64-bit floating point number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_f64(void* ptr, double val)
 {
-    // by writing this code like that
-    // prevent dereferencing type-punned pointer 
-    // breaking strict-aliasing rules warning
+    uint64_t bits = conv_endian_be64(conv_endian_f64_bits(val));
+    memcpy(ptr, &bits, sizeof(bits));
+}
+
+/*
 
-    uint64_t* ptr_val = (uint64_t*)&val;
-    uint64_t reintrepreted_val = *ptr_val;
-    
-    uint8_t bytes[8];
+    64-bit code ends here
+
+    ---------------------------------------------------------------------------
+
+    Packed code begins here
+
+*/
+
+/*
 
-    bytes[0] = reintrepreted_val >> 0;
-    bytes[1] = reintrepreted_val >> 8;
-    bytes[2] = reintrepreted_val >> 16;
-    bytes[3] = reintrepreted_val >> 24;
-    bytes[4] = reintrepreted_val >> 32;
-    bytes[5] = reintrepreted_val >> 40;
-    bytes[6] = reintrepreted_val >> 48;
-    bytes[7] = reintrepreted_val >> 56;
+    24-bit code
 
+*/
 
-    return *(double*)bytes;
+/// @brief Loads a packed 24-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 3 bytes of the 24-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint32_t load_le_u24(const void* ptr)
+{
+    const unsigned char* bytes = (const unsigned char*)ptr;
+    return (uint32_t)load_le_u16(bytes) | ((uint32_t)bytes[2] << 16);
 }
 
-/// @brief Reads an 64-bit big endian floating point number
-/// @param val value of a 64-bit floating point number in big endian
-/// @return converted value of the big endian value passed into read_be_f64 in their endianness of their machine
-double read_be_f64(double val) 
+/// @brief Stores a packed 24-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 3 bytes of the 24-bit unsigned integer number in little endian
+/// @param val value in their endianness of their machine, only its lowest 24 bits are stored
+CONV_ENDIAN_FUNC void store_le_u24(void* ptr, uint32_t val)
 {
-    // by writing this code like that
-    // prevent dereferencing type-punned pointer 
-    // breaking strict-aliasing rules warning
+    unsigned char* bytes = (unsigned char*)ptr;
+    store_le_u16(bytes, (uint16_t)val);
+    bytes[2] = (unsigned char)(val >> 16);
+}
 
-    uint64_t* ptr_val = (uint64_t*)&val;
-    uint64_t reintrepreted_val = *ptr_val;
+/// @brief Loads a packed 24-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 3 bytes of the 24-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint32_t load_be_u24(const void* ptr)
+{
+    const unsigned char* bytes = (const unsigned char*)ptr;
+    return ((uint32_t)load_be_u16(bytes) << 8) | bytes[2];
+}
 
-    uint8_t bytes[8];
+/// @brief Stores a packed 24-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 3 bytes of the 24-bit unsigned integer number in big endian
+/// @param val value in their endianness of their machine, only its lowest 24 bits are stored
+CONV_ENDIAN_FUNC void store_be_u24(void* ptr, uint32_t val)
+{
+    unsigned char* bytes = (unsigned char*)ptr;
+    store_be_u16(bytes, (uint16_t)(val >> 8));
+    bytes[2] = (unsigned char)val;
+}
 
-    bytes[0] = (uint64_t)reintrepreted_val >> 56;
-    bytes[1] = (uint64_t)reintrepreted_val >> 48;
-    bytes[2] = (uint64_t)reintrepreted_val >> 40;
-    bytes[3] = (uint64_t)reintrepreted_val >> 32;
-    bytes[4] = (uint64_t)reintrepreted_val >> 24;
-    bytes[5] = (uint64_t)reintrepreted_val >> 16;
-    bytes[6] = (uint64_t)reintrepreted_val >> 8;
-    bytes[7] = (uint64_t)reintrepreted_val >> 0;
+/// @brief Loads a packed 24-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 3 bytes of the 24-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine, sign extended
+CONV_ENDIAN_FUNC int32_t load_le_s24(const void* ptr)
+{
+    return (int32_t)(load_le_u24(ptr) ^ 0x800000) - 0x800000;
+}
 
-    return *(double*)bytes;
+/// @brief Stores a packed 24-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 3 bytes of the 24-bit signed integer number in little endian
+/// @param val value in their endianness of their machine, only its lowest 24 bits are stored
+CONV_ENDIAN_FUNC void store_le_s24(void* ptr, int32_t val)
+{
+    store_le_u24(ptr, (uint32_t)val);
 }
 
-/// @brief Writes an 64-bit big endian floating point number
-/// @param val value of a 64-bit floating point number in their endianness of their machine
-/// @return big endian double-precision value from value passed into convert_to_be_f64 in their endianness of their machine
-double convert_to_be_f64(double val)
+/// @brief Loads a packed 24-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 3 bytes of the 24-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine, sign extended
+CONV_ENDIAN_FUNC int32_t load_be_s24(const void* ptr)
+{
+    return (int32_t)(load_be_u24(ptr) ^ 0x800000) - 0x800000;
+}
+
+/// @brief Stores a packed 24-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 3 bytes of the 24-bit signed integer number in big endian
+/// @param val value in their endianness of their machine, only its lowest 24 bits are stored
+CONV_ENDIAN_FUNC void store_be_s24(void* ptr, int32_t val)
+{
+    store_be_u24(ptr, (uint32_t)val);
+}
+
+/*
+
+    48-bit code
+
+*/
+
+/// @brief Loads a packed 48-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 6 bytes of the 48-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint64_t load_le_u48(const void* ptr)
+{
+    const unsigned char* bytes = (const unsigned char*)ptr;
+    return (uint64_t)load_le_u32(bytes) | ((uint64_t)load_le_u16(bytes + 4) << 32);
+}
+
+/// @brief Stores a packed 48-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 6 bytes of the 48-bit unsigned integer number in little endian
+/// @param val value in their endianness of their machine, only its lowest 48 bits are stored
+CONV_ENDIAN_FUNC void store_le_u48(void* ptr, uint64_t val)
+{
+    unsigned char* bytes = (unsigned char*)ptr;
+    store_le_u32(bytes, (uint32_t)val);
+    store_le_u16(bytes + 4, (uint16_t)(val >> 32));
+}
+
+/// @brief Loads a packed 48-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 6 bytes of the 48-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint64_t load_be_u48(const void* ptr)
+{
+    const unsigned char* bytes = (const unsigned char*)ptr;
+    return ((uint64_t)load_be_u32(bytes) << 16) | load_be_u16(bytes + 4);
+}
+
+/// @brief Stores a packed 48-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 6 bytes of the 48-bit unsigned integer number in big endian
+/// @param val value in their endianness of their machine, only its lowest 48 bits are stored
+CONV_ENDIAN_FUNC void store_be_u48(void* ptr, uint64_t val)
+{
+    unsigned char* bytes = (unsigned char*)ptr;
+    store_be_u32(bytes, (uint32_t)(val >> 16));
+    store_be_u16(bytes + 4, (uint16_t)val);
+}
+
+/// @brief Loads a packed 48-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 6 bytes of the 48-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine, sign extended
+CONV_ENDIAN_FUNC int64_t load_le_s48(const void* ptr)
+{
+    return (int64_t)(load_le_u48(ptr) ^ 0x800000000000) - 0x800000000000;
+}
+
+/// @brief Stores a packed 48-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 6 bytes of the 48-bit signed integer number in little endian
+/// @param val value in their endianness of their machine, only its lowest 48 bits are stored
+CONV_ENDIAN_FUNC void store_le_s48(void* ptr, int64_t val)
+{
+    store_le_u48(ptr, (uint64_t)val);
+}
+
+/// @brief Loads a packed 48-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 6 bytes of the 48-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine, sign extended
+CONV_ENDIAN_FUNC int64_t load_be_s48(const void* ptr)
 {
-    // by writing this code like that
-    // prevent dereferencing type-punned pointer 
-    // breaking strict-aliasing rules warning
+    return (int64_t)(load_be_u48(ptr) ^ 0x800000000000) - 0x800000000000;
+}
+
+/// @brief Stores a packed 48-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 6 bytes of the 48-bit signed integer number in big endian
+/// @param val value in their endianness of their machine, only its lowest 48 bits are stored
+CONV_ENDIAN_FUNC void store_be_s48(void* ptr, int64_t val)
+{
+    store_be_u48(ptr, (uint64_t)val);
+}
+
+/*
+
+    128-bit code
+
+*/
+
+/// @brief Loads a 128-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 128-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC conv_endian_u128 load_le_u128(const void* ptr)
+{
+    const unsigned char* bytes = (const unsigned char*)ptr;
+    conv_endian_u128 val;
+    val.lo = load_le_u64(bytes);
+    val.hi = load_le_u64(bytes + 8);
+    return val;
+}
+
+/// @brief Stores a 128-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 128-bit unsigned integer number in little endian
+/// @param val value of a 128-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_u128(void* ptr, conv_endian_u128 val)
+{
+    unsigned char* bytes = (unsigned char*)ptr;
+    store_le_u64(bytes, val.lo);
+    store_le_u64(bytes + 8, val.hi);
+}
+
+/// @brief Loads a 128-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 128-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC conv_endian_u128 load_be_u128(const void* ptr)
+{
+    const unsigned char* bytes = (const unsigned char*)ptr;
+    conv_endian_u128 val;
+    val.hi = load_be_u64(bytes);
+    val.lo = load_be_u64(bytes + 8);
+    return val;
+}
+
+/// @brief Stores a 128-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 128-bit unsigned integer number in big endian
+/// @param val value of a 128-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_u128(void* ptr, conv_endian_u128 val)
+{
+    unsigned char* bytes = (unsigned char*)ptr;
+    store_be_u64(bytes, val.hi);
+    store_be_u64(bytes + 8, val.lo);
+}
+
+/*
+
+    Packed code ends here
+
+    ---------------------------------------------------------------------------
+
+    16-bit floating point code begins here
+
+*/
+
+/*
+
+    Half precision floating point code
+
+*/
+
+/// @brief Loads a half precision little endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit floating point number in little endian
+/// @return value at ptr widened into a 32-bit floating point number
+CONV_ENDIAN_FUNC float load_le_f16(const void* ptr)
+{
+    return conv_endian_half_to_float(load_le_u16(ptr));
+}
+
+/// @brief Stores a half precision little endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit floating point number in little endian
+/// @param val 32-bit floating point number that is rounded to the nearest half precision number, ties to even
+CONV_ENDIAN_FUNC void store_le_f16(void* ptr, float val)
+{
+    store_le_u16(ptr, conv_endian_float_to_half(val));
+}
+
+/// @brief Loads a half precision big endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit floating point number in big endian
+/// @return value at ptr widened into a 32-bit floating point number
+CONV_ENDIAN_FUNC float load_be_f16(const void* ptr)
+{
+    return conv_endian_half_to_float(load_be_u16(ptr));
+}
+
+/// @brief Stores a half precision big endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit floating point number in big endian
+/// @param val 32-bit floating point number that is rounded to the nearest half precision number, ties to even
+CONV_ENDIAN_FUNC void store_be_f16(void* ptr, float val)
+{
+    store_be_u16(ptr, conv_endian_float_to_half(val));
+}
+
+/*
+
+    bfloat16 floating point code
 
-    uint64_t* ptr_val = (uint64_t*)&val;
-    uint64_t reintrepreted_val = *ptr_val;
-    
-    uint8_t bytes[8];
+*/
 
-    bytes[0] = reintrepreted_val >> 56;
-    bytes[1] = reintrepreted_val >> 48;
-    bytes[2] = reintrepreted_val >> 40;
-    bytes[3] = reintrepreted_val >> 32;
-    bytes[4] = reintrepreted_val >> 24;
-    bytes[5] = reintrepreted_val >> 16;
-    bytes[6] = reintrepreted_val >> 8;
-    bytes[7] = reintrepreted_val >> 0;
+/// @brief Loads a bfloat16 little endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit floating point number in little endian
+/// @return value at ptr widened into a 32-bit floating point number
+CONV_ENDIAN_FUNC float load_le_bf16(const void* ptr)
+{
+    return conv_endian_bfloat_to_float(load_le_u16(ptr));
+}
 
+/// @brief Stores a bfloat16 little endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit floating point number in little endian
+/// @param val 32-bit floating point number that is rounded to the nearest bfloat16 number, ties to even
+CONV_ENDIAN_FUNC void store_le_bf16(void* ptr, float val)
+{
+    store_le_u16(ptr, conv_endian_float_to_bfloat(val));
+}
+
+/// @brief Loads a bfloat16 big endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit floating point number in big endian
+/// @return value at ptr widened into a 32-bit floating point number
+CONV_ENDIAN_FUNC float load_be_bf16(const void* ptr)
+{
+    return conv_endian_bfloat_to_float(load_be_u16(ptr));
+}
+
+/// @brief Stores a bfloat16 big endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit floating point number in big endian
+/// @param val 32-bit floating point number that is rounded to the nearest bfloat16 number, ties to even
+CONV_ENDIAN_FUNC void store_be_bf16(void* ptr, float val)
+{
+    store_be_u16(ptr, conv_endian_float_to_bfloat(val));
+}
 
-    return *(double*)bytes;
-}
\ No newline at end of file
+#endif
@@ -36,6 +36,396 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+
+    Header-only mode
+
+    Defining CONV_ENDIAN_HEADER_ONLY before including this header turns
+    every conversion function into a static inline function so that the
+    compiler can fold it into a single byte swap instruction (or nothing
+    at all when the requested endianness matches the machine). In C++ the
+    integer conversions (and the floating point conversions on compilers
+    that provide __builtin_bit_cast) are also constexpr.
+
+    Without CONV_ENDIAN_HEADER_ONLY the functions are declared as regular
+    functions that are implemented in conv_endian.c
+
+*/
+
+/*
+
+    Host endianness detection
+
+    CONV_ENDIAN_HOST_LITTLE or CONV_ENDIAN_HOST_BIG is defined when the
+    endianness of the machine is known at compile time. Either one may be
+    defined before including this header for compilers that are not
+    detected here. When neither is defined the conversions fall back to
+    assembling the value byte by byte.
+
+*/
+
+#if !defined(CONV_ENDIAN_HOST_LITTLE) && !defined(CONV_ENDIAN_HOST_BIG)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define CONV_ENDIAN_HOST_LITTLE 1
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define CONV_ENDIAN_HOST_BIG 1
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM) || defined(_M_ARM64))
+#define CONV_ENDIAN_HOST_LITTLE 1
+#endif
+#endif
+
+#if defined(__cplusplus) || !defined(_MSC_VER)
+#define CONV_ENDIAN_INLINE inline
+#else
+#define CONV_ENDIAN_INLINE __inline
+#endif
+
+// constexpr for helpers that only shift and mask integers
+#if defined(__cplusplus) && (__cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L))
+#define CONV_ENDIAN_CXX_CONSTEXPR constexpr
+#else
+#define CONV_ENDIAN_CXX_CONSTEXPR
+#endif
+
+// constexpr for helpers that depend on the endianness of the machine
+#if defined(CONV_ENDIAN_HOST_LITTLE) || defined(CONV_ENDIAN_HOST_BIG)
+#define CONV_ENDIAN_ORDER_CONSTEXPR CONV_ENDIAN_CXX_CONSTEXPR
+#else
+#define CONV_ENDIAN_ORDER_CONSTEXPR
+#endif
+
+// constexpr for helpers that reinterpret floating point numbers as integers
+#if defined(__cplusplus) && defined(__has_builtin)
+#if __has_builtin(__builtin_bit_cast)
+#define CONV_ENDIAN_HAS_BIT_CAST 1
+#endif
+#elif defined(__cplusplus) && defined(_MSC_VER) && _MSC_VER >= 1927
+#define CONV_ENDIAN_HAS_BIT_CAST 1
+#endif
+
+#if defined(CONV_ENDIAN_HAS_BIT_CAST)
+#define CONV_ENDIAN_BIT_CAST_CONSTEXPR CONV_ENDIAN_CXX_CONSTEXPR
+#define CONV_ENDIAN_FLOAT_CONSTEXPR CONV_ENDIAN_ORDER_CONSTEXPR
+#else
+#define CONV_ENDIAN_BIT_CAST_CONSTEXPR
+#define CONV_ENDIAN_FLOAT_CONSTEXPR
+#endif
+
+#if defined(CONV_ENDIAN_HEADER_ONLY)
+#define CONV_ENDIAN_FUNC static CONV_ENDIAN_INLINE
+#define CONV_ENDIAN_CONSTEXPR CONV_ENDIAN_ORDER_CONSTEXPR
+#define CONV_ENDIAN_CONSTEXPR_FLOAT CONV_ENDIAN_FLOAT_CONSTEXPR
+#else
+#define CONV_ENDIAN_FUNC
+#define CONV_ENDIAN_CONSTEXPR
+#define CONV_ENDIAN_CONSTEXPR_FLOAT
+#endif
+
+#if defined(_MSC_VER) && !defined(__cplusplus) && !defined(__clang__)
+#include <stdlib.h>
+#endif
+
+/*
+
+    Helpers shared by every conversion
+
+    These are always inline, regardless of CONV_ENDIAN_HEADER_ONLY
+
+*/
+
+/// @brief Reverses the bytes of a 16-bit unsigned integer
+/// @param val value to be byte swapped
+/// @return val with its bytes in reversed order
+static CONV_ENDIAN_INLINE CONV_ENDIAN_CXX_CONSTEXPR uint16_t conv_endian_bswap16(uint16_t val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(val);
+#elif defined(_MSC_VER) && !defined(__cplusplus)
+    return _byteswap_ushort(val);
+#else
+    return (uint16_t)((val >> 8) | (val << 8));
+#endif
+}
+
+/// @brief Reverses the bytes of a 32-bit unsigned integer
+/// @param val value to be byte swapped
+/// @return val with its bytes in reversed order
+static CONV_ENDIAN_INLINE CONV_ENDIAN_CXX_CONSTEXPR uint32_t conv_endian_bswap32(uint32_t val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(val);
+#elif defined(_MSC_VER) && !defined(__cplusplus)
+    return _byteswap_ulong(val);
+#else
+    return (uint32_t)(
+        ((val & 0x000000FFu) << 24) |
+        ((val & 0x0000FF00u) << 8) |
+        ((val & 0x00FF0000u) >> 8) |
+        ((val & 0xFF000000u) >> 24)
+    );
+#endif
+}
+
+/// @brief Reverses the bytes of a 64-bit unsigned integer
+/// @param val value to be byte swapped
+/// @return val with its bytes in reversed order
+static CONV_ENDIAN_INLINE CONV_ENDIAN_CXX_CONSTEXPR uint64_t conv_endian_bswap64(uint64_t val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(val);
+#elif defined(_MSC_VER) && !defined(__cplusplus)
+    return _byteswap_uint64(val);
+#else
+    return (uint64_t)(
+        ((val & 0x00000000000000FFull) << 56) |
+        ((val & 0x000000000000FF00ull) << 40) |
+        ((val & 0x0000000000FF0000ull) << 24) |
+        ((val & 0x00000000FF000000ull) << 8) |
+        ((val & 0x000000FF00000000ull) >> 8) |
+        ((val & 0x0000FF0000000000ull) >> 24) |
+        ((val & 0x00FF000000000000ull) >> 40) |
+        ((val & 0xFF00000000000000ull) >> 56)
+    );
+#endif
+}
+
+/// @brief Converts a 16-bit unsigned integer between little endian and the endianness of the machine
+/// @param val value in little endian or in the endianness of the machine
+/// @return val in the other of the two byte orders
+static CONV_ENDIAN_INLINE CONV_ENDIAN_ORDER_CONSTEXPR uint16_t conv_endian_le16(uint16_t val)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    return val;
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    return conv_endian_bswap16(val);
+#else
+    const uint8_t* val_ptr = (const uint8_t*)&val;
+    return (uint16_t)((val_ptr[0] << 0) | (val_ptr[1] << 8));
+#endif
+}
+
+/// @brief Converts a 16-bit unsigned integer between big endian and the endianness of the machine
+/// @param val value in big endian or in the endianness of the machine
+/// @return val in the other of the two byte orders
+static CONV_ENDIAN_INLINE CONV_ENDIAN_ORDER_CONSTEXPR uint16_t conv_endian_be16(uint16_t val)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    return conv_endian_bswap16(val);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    return val;
+#else
+    const uint8_t* val_ptr = (const uint8_t*)&val;
+    return (uint16_t)((val_ptr[1] << 0) | (val_ptr[0] << 8));
+#endif
+}
+
+/// @brief Converts a 32-bit unsigned integer between little endian and the endianness of the machine
+/// @param val value in little endian or in the endianness of the machine
+/// @return val in the other of the two byte orders
+static CONV_ENDIAN_INLINE CONV_ENDIAN_ORDER_CONSTEXPR uint32_t conv_endian_le32(uint32_t val)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    return val;
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    return conv_endian_bswap32(val);
+#else
+    const uint8_t* val_ptr = (const uint8_t*)&val;
+    return (uint32_t)(
+        ((uint32_t)val_ptr[0] << 0) |
+        ((uint32_t)val_ptr[1] << 8) |
+        ((uint32_t)val_ptr[2] << 16) |
+        ((uint32_t)val_ptr[3] << 24)
+    );
+#endif
+}
+
+/// @brief Converts a 32-bit unsigned integer between big endian and the endianness of the machine
+/// @param val value in big endian or in the endianness of the machine
+/// @return val in the other of the two byte orders
+static CONV_ENDIAN_INLINE CONV_ENDIAN_ORDER_CONSTEXPR uint32_t conv_endian_be32(uint32_t val)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    return conv_endian_bswap32(val);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    return val;
+#else
+    const uint8_t* val_ptr = (const uint8_t*)&val;
+    return (uint32_t)(
+        ((uint32_t)val_ptr[3] << 0) |
+        ((uint32_t)val_ptr[2] << 8) |
+        ((uint32_t)val_ptr[1] << 16) |
+        ((uint32_t)val_ptr[0] << 24)
+    );
+#endif
+}
+
+/// @brief Converts a 64-bit unsigned integer between little endian and the endianness of the machine
+/// @param val value in little endian or in the endianness of the machine
+/// @return val in the other of the two byte orders
+static CONV_ENDIAN_INLINE CONV_ENDIAN_ORDER_CONSTEXPR uint64_t conv_endian_le64(uint64_t val)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    return val;
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    return conv_endian_bswap64(val);
+#else
+    const uint8_t* val_ptr = (const uint8_t*)&val;
+    return (uint64_t)(
+        ((uint64_t)val_ptr[0] << 0) |
+        ((uint64_t)val_ptr[1] << 8) |
+        ((uint64_t)val_ptr[2] << 16) |
+        ((uint64_t)val_ptr[3] << 24) |
+        ((uint64_t)val_ptr[4] << 32) |
+        ((uint64_t)val_ptr[5] << 40) |
+        ((uint64_t)val_ptr[6] << 48) |
+        ((uint64_t)val_ptr[7] << 56)
+    );
+#endif
+}
+
+/// @brief Converts a 64-bit unsigned integer between big endian and the endianness of the machine
+/// @param val value in big endian or in the endianness of the machine
+/// @return val in the other of the two byte orders
+static CONV_ENDIAN_INLINE CONV_ENDIAN_ORDER_CONSTEXPR uint64_t conv_endian_be64(uint64_t val)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    return conv_endian_bswap64(val);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    return val;
+#else
+    const uint8_t* val_ptr = (const uint8_t*)&val;
+    return (uint64_t)(
+        ((uint64_t)val_ptr[7] << 0) |
+        ((uint64_t)val_ptr[6] << 8) |
+        ((uint64_t)val_ptr[5] << 16) |
+        ((uint64_t)val_ptr[4] << 24) |
+        ((uint64_t)val_ptr[3] << 32) |
+        ((uint64_t)val_ptr[2] << 40) |
+        ((uint64_t)val_ptr[1] << 48) |
+        ((uint64_t)val_ptr[0] << 56)
+    );
+#endif
+}
+
+/// @brief Reinterprets the bits of a 32-bit floating point number as an integer
+/// @param val 32-bit floating point number
+/// @return bits of val
+static CONV_ENDIAN_INLINE CONV_ENDIAN_BIT_CAST_CONSTEXPR uint32_t conv_endian_f32_bits(float val)
+{
+#if defined(CONV_ENDIAN_HAS_BIT_CAST)
+    return __builtin_bit_cast(uint32_t, val);
+#else
+    uint32_t bits;
+    memcpy(&bits, &val, sizeof(bits));
+    return bits;
+#endif
+}
+
+/// @brief Reinterprets an integer as the bits of a 32-bit floating point number
+/// @param bits bits of a 32-bit floating point number
+/// @return 32-bit floating point number made of bits
+static CONV_ENDIAN_INLINE CONV_ENDIAN_BIT_CAST_CONSTEXPR float conv_endian_bits_f32(uint32_t bits)
+{
+#if defined(CONV_ENDIAN_HAS_BIT_CAST)
+    return __builtin_bit_cast(float, bits);
+#else
+    float val;
+    memcpy(&val, &bits, sizeof(val));
+    return val;
+#endif
+}
+
+/// @brief Reinterprets the bits of a 64-bit floating point number as an integer
+/// @param val 64-bit floating point number
+/// @return bits of val
+static CONV_ENDIAN_INLINE CONV_ENDIAN_BIT_CAST_CONSTEXPR uint64_t conv_endian_f64_bits(double val)
+{
+#if defined(CONV_ENDIAN_HAS_BIT_CAST)
+    return __builtin_bit_cast(uint64_t, val);
+#else
+    uint64_t bits;
+    memcpy(&bits, &val, sizeof(bits));
+    return bits;
+#endif
+}
+
+/// @brief Reinterprets an integer as the bits of a 64-bit floating point number
+/// @param bits bits of a 64-bit floating point number
+/// @return 64-bit floating point number made of bits
+static CONV_ENDIAN_INLINE CONV_ENDIAN_BIT_CAST_CONSTEXPR double conv_endian_bits_f64(uint64_t bits)
+{
+#if defined(CONV_ENDIAN_HAS_BIT_CAST)
+    return __builtin_bit_cast(double, bits);
+#else
+    double val;
+    memcpy(&val, &bits, sizeof(val));
+    return val;
+#endif
+}
+
+/// @brief Widens the bits of an IEEE 754 half precision floating point number into a 32-bit floating point number
+/// @param bits bits of a 16-bit floating point number
+/// @return the same number as a 32-bit floating point number, signaling NaNs become quiet NaNs
+static CONV_ENDIAN_INLINE float conv_endian_half_to_float(uint16_t bits)
+{
+    uint32_t sign = (uint32_t)(bits & 0x8000) << 16;
+    uint32_t exponent = (bits >> 10) & 0x1F;
+    uint32_t mantissa = bits & 0x3FF;
+
+    if (exponent == 0x1F)
+        return conv_endian_bits_f32(sign | 0x7F800000 | (mantissa << 13) | (mantissa != 0 ? 0x400000 : 0));
+
+    // subnormal numbers are a multiple of 2^-24
+    if (exponent == 0)
+        return conv_endian_bits_f32(sign | conv_endian_f32_bits((float)mantissa * 5.9604644775390625e-8f));
+
+    return conv_endian_bits_f32(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+/// @brief Narrows a 32-bit floating point number into the bits of an IEEE 754 half precision floating point number
+/// @param val 32-bit floating point number
+/// @return bits of val rounded to the nearest half precision number, ties to even, NaNs stay NaNs
+static CONV_ENDIAN_INLINE uint16_t conv_endian_float_to_half(float val)
+{
+    uint32_t bits = conv_endian_f32_bits(val);
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t magnitude = bits & 0x7FFFFFFF;
+
+    if (magnitude >= 0x47800000)
+        return (uint16_t)(sign | (magnitude > 0x7F800000 ? 0x7E00 | ((magnitude >> 13) & 0x3FF) : 0x7C00));
+
+    // adding 0.5 shifts the mantissa of a subnormal result into place and
+    // rounds it with the rounding of the floating point addition
+    if (magnitude < 0x38800000)
+        return (uint16_t)(sign | (conv_endian_f32_bits(conv_endian_bits_f32(magnitude) + 0.5f) - 0x3F000000));
+
+    magnitude += 0xC8000FFF + ((magnitude >> 13) & 1);
+    return (uint16_t)(sign | (magnitude >> 13));
+}
+
+/// @brief Widens the bits of a bfloat16 floating point number into a 32-bit floating point number
+/// @param bits bits of a bfloat16 floating point number
+/// @return the same number as a 32-bit floating point number
+static CONV_ENDIAN_INLINE CONV_ENDIAN_BIT_CAST_CONSTEXPR float conv_endian_bfloat_to_float(uint16_t bits)
+{
+    return conv_endian_bits_f32((uint32_t)bits << 16);
+}
+
+/// @brief Narrows a 32-bit floating point number into the bits of a bfloat16 floating point number
+/// @param val 32-bit floating point number
+/// @return bits of val rounded to the nearest bfloat16 number, ties to even, NaNs become quiet NaNs
+static CONV_ENDIAN_INLINE uint16_t conv_endian_float_to_bfloat(float val)
+{
+    uint32_t bits = conv_endian_f32_bits(val);
+
+    if ((bits & 0x7FFFFFFF) > 0x7F800000)
+        return (uint16_t)((bits | 0x400000) >> 16);
+
+    return (uint16_t)((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
 
 /*
 
@@ -61,22 +451,86 @@ extern "C" {
 /// @brief Reads an 16-bit unsigned little endian integer number
 /// @param val value of a 16-bit unsigned integer in little endian
 /// @return converted value of the unsigned little endian value passed into read_le_u16 in their endianness of their machine
-uint16_t read_le_u16(uint16_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint16_t read_le_u16(uint16_t val);
 
 /// @brief Writes an 16-bit unsigned little endian integer number
 /// @param val value of a 16-bit unsigned integer in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_u16 in their endianness of their machine
-uint16_t convert_to_le_u16(uint16_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint16_t convert_to_le_u16(uint16_t val);
 
 /// @brief Reads an 16-bit unsigned big endian integer number
 /// @param val value of a 16-bit unsigned integer in big endian 
 /// @return converted value of the unsigned big endian value passed into read_be_u16 in their endianness of their machine
-uint16_t read_be_u16(uint16_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint16_t read_be_u16(uint16_t val);
 
 /// @brief Writes an 16-bit unsigned big endian integer number
 /// @param val value of a 16-bit unsigned integer in their endianness of their machine 
 /// @return big endian value from value passed into convert_to_be_u16 in their endianness of their machine
-uint16_t convert_to_be_u16(uint16_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint16_t convert_to_be_u16(uint16_t val);
+
+/// @brief Loads an 16-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint16_t load_le_u16(const void* ptr);
+
+/// @brief Stores an 16-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit unsigned integer number in little endian
+/// @param val value of a 16-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_u16(void* ptr, uint16_t val);
+
+/// @brief Loads an 16-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint16_t load_be_u16(const void* ptr);
+
+/// @brief Stores an 16-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit unsigned integer number in big endian
+/// @param val value of a 16-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_u16(void* ptr, uint16_t val);
+
+/// @brief Reads an array of 16-bit unsigned little endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 16-bit unsigned integers in little endian
+/// @param count number of values in src
+void read_le_u16_array(uint16_t* dst, const uint16_t* src, size_t count);
+
+/// @brief Reads an array of 16-bit unsigned little endian integers in place
+/// @param buf array of 16-bit unsigned integers in little endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_le_u16_array_inplace(uint16_t* buf, size_t count);
+
+/// @brief Writes an array of 16-bit unsigned little endian integers
+/// @param dst array that receives the values in little endian, may be the same array as src
+/// @param src array of 16-bit unsigned integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_u16_array(uint16_t* dst, const uint16_t* src, size_t count);
+
+/// @brief Writes an array of 16-bit unsigned little endian integers in place
+/// @param buf array of 16-bit unsigned integers in their endianness of their machine that is converted into little endian
+/// @param count number of values in buf
+void convert_to_le_u16_array_inplace(uint16_t* buf, size_t count);
+
+/// @brief Reads an array of 16-bit unsigned big endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 16-bit unsigned integers in big endian
+/// @param count number of values in src
+void read_be_u16_array(uint16_t* dst, const uint16_t* src, size_t count);
+
+/// @brief Reads an array of 16-bit unsigned big endian integers in place
+/// @param buf array of 16-bit unsigned integers in big endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_be_u16_array_inplace(uint16_t* buf, size_t count);
+
+/// @brief Writes an array of 16-bit unsigned big endian integers
+/// @param dst array that receives the values in big endian, may be the same array as src
+/// @param src array of 16-bit unsigned integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_u16_array(uint16_t* dst, const uint16_t* src, size_t count);
+
+/// @brief Writes an array of 16-bit unsigned big endian integers in place
+/// @param buf array of 16-bit unsigned integers in their endianness of their machine that is converted into big endian
+/// @param count number of values in buf
+void convert_to_be_u16_array_inplace(uint16_t* buf, size_t count);
 
 /*
 
@@ -87,22 +541,86 @@ uint16_t convert_to_be_u16(uint16_t val);
 /// @brief Reads an 16-bit signed little endian integer number
 /// @param val value of a 16-bit signed integer in little endian
 /// @return converted value of the signed little endian value passed into read_le_s16 in their endianness of their machine
-int16_t read_le_s16(int16_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int16_t read_le_s16(int16_t val);
 
 /// @brief Writes an 16-bit signed little endian integer number
 /// @param val value of a 16-bit signed integer in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_s16 in their endianness of their machine
-int16_t convert_to_le_s16(int16_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int16_t convert_to_le_s16(int16_t val);
 
 /// @brief Reads an 16-bit signed big endian integer number
 /// @param val value of a 16-bit signed integer in big endian 
 /// @return converted value of the signed big endian value passed into read_be_s16 in their endianness of their machine
-int16_t read_be_s16(int16_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int16_t read_be_s16(int16_t val);
 
 /// @brief Writes an 16-bit signed big endian integer number
 /// @param val value of a 16-bit signed integer in their endianness of their machine 
 /// @return big endian value from value passed into convert_to_be_s16 in their endianness of their machine
-int16_t convert_to_be_s16(int16_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int16_t convert_to_be_s16(int16_t val);
+
+/// @brief Loads an 16-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int16_t load_le_s16(const void* ptr);
+
+/// @brief Stores an 16-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit signed integer number in little endian
+/// @param val value of a 16-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_s16(void* ptr, int16_t val);
+
+/// @brief Loads an 16-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int16_t load_be_s16(const void* ptr);
+
+/// @brief Stores an 16-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit signed integer number in big endian
+/// @param val value of a 16-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_s16(void* ptr, int16_t val);
+
+/// @brief Reads an array of 16-bit signed little endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 16-bit signed integers in little endian
+/// @param count number of values in src
+void read_le_s16_array(int16_t* dst, const int16_t* src, size_t count);
+
+/// @brief Reads an array of 16-bit signed little endian integers in place
+/// @param buf array of 16-bit signed integers in little endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_le_s16_array_inplace(int16_t* buf, size_t count);
+
+/// @brief Writes an array of 16-bit signed little endian integers
+/// @param dst array that receives the values in little endian, may be the same array as src
+/// @param src array of 16-bit signed integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_s16_array(int16_t* dst, const int16_t* src, size_t count);
+
+/// @brief Writes an array of 16-bit signed little endian integers in place
+/// @param buf array of 16-bit signed integers in their endianness of their machine that is converted into little endian
+/// @param count number of values in buf
+void convert_to_le_s16_array_inplace(int16_t* buf, size_t count);
+
+/// @brief Reads an array of 16-bit signed big endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 16-bit signed integers in big endian
+/// @param count number of values in src
+void read_be_s16_array(int16_t* dst, const int16_t* src, size_t count);
+
+/// @brief Reads an array of 16-bit signed big endian integers in place
+/// @param buf array of 16-bit signed integers in big endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_be_s16_array_inplace(int16_t* buf, size_t count);
+
+/// @brief Writes an array of 16-bit signed big endian integers
+/// @param dst array that receives the values in big endian, may be the same array as src
+/// @param src array of 16-bit signed integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_s16_array(int16_t* dst, const int16_t* src, size_t count);
+
+/// @brief Writes an array of 16-bit signed big endian integers in place
+/// @param buf array of 16-bit signed integers in their endianness of their machine that is converted into big endian
+/// @param count number of values in buf
+void convert_to_be_s16_array_inplace(int16_t* buf, size_t count);
 
 /*
 
@@ -123,22 +641,86 @@ int16_t convert_to_be_s16(int16_t val);
 /// @brief Reads an 32-bit unsigned little endian integer number
 /// @param val value of a 32-bit unsigned integer in little endian
 /// @return converted value of the unsigned little endian value passed into read_le_u32 in their endianness of their machine
-uint32_t read_le_u32(uint32_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint32_t read_le_u32(uint32_t val);
 
 /// @brief Writes an 32-bit unsigned little endian integer number
 /// @param val value of a 32-bit unsigned integer in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_u32 in their endianness of their machine
-uint32_t convert_to_le_u32(uint32_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint32_t convert_to_le_u32(uint32_t val);
 
 /// @brief Reads an 32-bit unsigned big endian integer number
 /// @param val value of a 32-bit unsigned integer in big endian 
 /// @return converted value of the unsigned big endian value passed into read_be_u32 in their endianness of their machine
-uint32_t read_be_u32(uint32_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint32_t read_be_u32(uint32_t val);
 
 /// @brief Writes an 32 bit unsigned big endian integer number
 /// @param val value of a 32-bit unsigned integer in their endianness of their machine 
 /// @return big endian value from value passed into convert_to_be_u32 in their endianness of their machine
-uint32_t convert_to_be_u32(uint32_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint32_t convert_to_be_u32(uint32_t val);
+
+/// @brief Loads an 32-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint32_t load_le_u32(const void* ptr);
+
+/// @brief Stores an 32-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit unsigned integer number in little endian
+/// @param val value of a 32-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_u32(void* ptr, uint32_t val);
+
+/// @brief Loads an 32-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint32_t load_be_u32(const void* ptr);
+
+/// @brief Stores an 32-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit unsigned integer number in big endian
+/// @param val value of a 32-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_u32(void* ptr, uint32_t val);
+
+/// @brief Reads an array of 32-bit unsigned little endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 32-bit unsigned integers in little endian
+/// @param count number of values in src
+void read_le_u32_array(uint32_t* dst, const uint32_t* src, size_t count);
+
+/// @brief Reads an array of 32-bit unsigned little endian integers in place
+/// @param buf array of 32-bit unsigned integers in little endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_le_u32_array_inplace(uint32_t* buf, size_t count);
+
+/// @brief Writes an array of 32-bit unsigned little endian integers
+/// @param dst array that receives the values in little endian, may be the same array as src
+/// @param src array of 32-bit unsigned integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_u32_array(uint32_t* dst, const uint32_t* src, size_t count);
+
+/// @brief Writes an array of 32-bit unsigned little endian integers in place
+/// @param buf array of 32-bit unsigned integers in their endianness of their machine that is converted into little endian
+/// @param count number of values in buf
+void convert_to_le_u32_array_inplace(uint32_t* buf, size_t count);
+
+/// @brief Reads an array of 32-bit unsigned big endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 32-bit unsigned integers in big endian
+/// @param count number of values in src
+void read_be_u32_array(uint32_t* dst, const uint32_t* src, size_t count);
+
+/// @brief Reads an array of 32-bit unsigned big endian integers in place
+/// @param buf array of 32-bit unsigned integers in big endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_be_u32_array_inplace(uint32_t* buf, size_t count);
+
+/// @brief Writes an array of 32-bit unsigned big endian integers
+/// @param dst array that receives the values in big endian, may be the same array as src
+/// @param src array of 32-bit unsigned integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_u32_array(uint32_t* dst, const uint32_t* src, size_t count);
+
+/// @brief Writes an array of 32-bit unsigned big endian integers in place
+/// @param buf array of 32-bit unsigned integers in their endianness of their machine that is converted into big endian
+/// @param count number of values in buf
+void convert_to_be_u32_array_inplace(uint32_t* buf, size_t count);
 
 /*
 
@@ -149,22 +731,86 @@ uint32_t convert_to_be_u32(uint32_t val);
 /// @brief Reads an 32-bit signed little endian integer number
 /// @param val value of a 32-bit signed integer in little endian
 /// @return converted value of the signed little endian value passed into read_le_s32 in their endianness of their machine
-int32_t read_le_s32(int32_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int32_t read_le_s32(int32_t val);
 
 /// @brief Writes an 32-bit signed little endian integer number
 /// @param val value of a 32-bit signed integer in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_s32 in their endianness of their machine
-int32_t convert_to_le_s32(int32_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int32_t convert_to_le_s32(int32_t val);
 
 /// @brief Reads an 32-bit signed big endian integer number
 /// @param val value of a 32-bit signed integer in big endian 
 /// @return converted value of the signed big endian value passed into read_be_s32 in their endianness of their machine
-int32_t read_be_s32(int32_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int32_t read_be_s32(int32_t val);
 
 /// @brief Writes an 32-bit signed big endian integer number
 /// @param val value of a 32-bit signed integer in their endianness of their machine 
 /// @return big endian value from value passed into convert_to_be_s32 in their endianness of their machine
-int32_t convert_to_be_s32(int32_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int32_t convert_to_be_s32(int32_t val);
+
+/// @brief Loads an 32-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int32_t load_le_s32(const void* ptr);
+
+/// @brief Stores an 32-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit signed integer number in little endian
+/// @param val value of a 32-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_s32(void* ptr, int32_t val);
+
+/// @brief Loads an 32-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int32_t load_be_s32(const void* ptr);
+
+/// @brief Stores an 32-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit signed integer number in big endian
+/// @param val value of a 32-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_s32(void* ptr, int32_t val);
+
+/// @brief Reads an array of 32-bit signed little endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 32-bit signed integers in little endian
+/// @param count number of values in src
+void read_le_s32_array(int32_t* dst, const int32_t* src, size_t count);
+
+/// @brief Reads an array of 32-bit signed little endian integers in place
+/// @param buf array of 32-bit signed integers in little endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_le_s32_array_inplace(int32_t* buf, size_t count);
+
+/// @brief Writes an array of 32-bit signed little endian integers
+/// @param dst array that receives the values in little endian, may be the same array as src
+/// @param src array of 32-bit signed integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_s32_array(int32_t* dst, const int32_t* src, size_t count);
+
+/// @brief Writes an array of 32-bit signed little endian integers in place
+/// @param buf array of 32-bit signed integers in their endianness of their machine that is converted into little endian
+/// @param count number of values in buf
+void convert_to_le_s32_array_inplace(int32_t* buf, size_t count);
+
+/// @brief Reads an array of 32-bit signed big endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 32-bit signed integers in big endian
+/// @param count number of values in src
+void read_be_s32_array(int32_t* dst, const int32_t* src, size_t count);
+
+/// @brief Reads an array of 32-bit signed big endian integers in place
+/// @param buf array of 32-bit signed integers in big endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_be_s32_array_inplace(int32_t* buf, size_t count);
+
+/// @brief Writes an array of 32-bit signed big endian integers
+/// @param dst array that receives the values in big endian, may be the same array as src
+/// @param src array of 32-bit signed integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_s32_array(int32_t* dst, const int32_t* src, size_t count);
+
+/// @brief Writes an array of 32-bit signed big endian integers in place
+/// @param buf array of 32-bit signed integers in their endianness of their machine that is converted into big endian
+/// @param count number of values in buf
+void convert_to_be_s32_array_inplace(int32_t* buf, size_t count);
 
 
 /*
@@ -176,22 +822,86 @@ int32_t convert_to_be_s32(int32_t val);
 /// @brief Reads an 32-bit little endian floating point number
 /// @param val value of a 32-bit floating point number in little endian
 /// @return converted value of the little endian value passed into read_le_f32 in their endianness of their machine
-float read_le_f32(float val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT float read_le_f32(float val);
 
 /// @brief Writes an 32-bit little endian floating point number
 /// @param val value of a 32-bit floating point number in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_f32 in their endianness of their machine
-float convert_to_le_f32(float val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT float convert_to_le_f32(float val);
 
 /// @brief Reads an 32-bit big endian floating point number
 /// @param val value of a 32-bit floating point number in big endian
 /// @return converted value of the big endian value passed into read_be_f32 in their endianness of their machine
-float read_be_f32(float val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT float read_be_f32(float val);
 
 /// @brief Writes an 32-bit big endian floating point number
 /// @param val value of a 32-bit floating point number in their endianness of their machine
 /// @return big endian value from value passed into convert_to_be_f32 in their endianness of their machine
-float convert_to_be_f32(float val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT float convert_to_be_f32(float val);
+
+/// @brief Loads an 32-bit little endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit floating point number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC float load_le_f32(const void* ptr);
+
+/// @brief Stores an 32-bit little endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit floating point number in little endian
+/// @param val value of a 32-bit floating point number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_f32(void* ptr, float val);
+
+/// @brief Loads an 32-bit big endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 32-bit floating point number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC float load_be_f32(const void* ptr);
+
+/// @brief Stores an 32-bit big endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 32-bit floating point number in big endian
+/// @param val value of a 32-bit floating point number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_f32(void* ptr, float val);
+
+/// @brief Reads an array of 32-bit little endian floating point numbers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 32-bit floating point numbers in little endian
+/// @param count number of values in src
+void read_le_f32_array(float* dst, const float* src, size_t count);
+
+/// @brief Reads an array of 32-bit little endian floating point numbers in place
+/// @param buf array of 32-bit floating point numbers in little endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_le_f32_array_inplace(float* buf, size_t count);
+
+/// @brief Writes an array of 32-bit little endian floating point numbers
+/// @param dst array that receives the values in little endian, may be the same array as src
+/// @param src array of 32-bit floating point numbers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_f32_array(float* dst, const float* src, size_t count);
+
+/// @brief Writes an array of 32-bit little endian floating point numbers in place
+/// @param buf array of 32-bit floating point numbers in their endianness of their machine that is converted into little endian
+/// @param count number of values in buf
+void convert_to_le_f32_array_inplace(float* buf, size_t count);
+
+/// @brief Reads an array of 32-bit big endian floating point numbers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 32-bit floating point numbers in big endian
+/// @param count number of values in src
+void read_be_f32_array(float* dst, const float* src, size_t count);
+
+/// @brief Reads an array of 32-bit big endian floating point numbers in place
+/// @param buf array of 32-bit floating point numbers in big endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_be_f32_array_inplace(float* buf, size_t count);
+
+/// @brief Writes an array of 32-bit big endian floating point numbers
+/// @param dst array that receives the values in big endian, may be the same array as src
+/// @param src array of 32-bit floating point numbers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_f32_array(float* dst, const float* src, size_t count);
+
+/// @brief Writes an array of 32-bit big endian floating point numbers in place
+/// @param buf array of 32-bit floating point numbers in their endianness of their machine that is converted into big endian
+/// @param count number of values in buf
+void convert_to_be_f32_array_inplace(float* buf, size_t count);
 
 /*
 
@@ -212,22 +922,86 @@ float convert_to_be_f32(float val);
 /// @brief Reads an 64-bit little endian integer number
 /// @param val value of a 64-bit unsigned integer in little endian
 /// @return converted value of the signed value passed into read_le_u64 in their endianness of their machine
-uint64_t read_le_u64(uint64_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint64_t read_le_u64(uint64_t val);
 
 /// @brief Writes an 64-bit little endian integer number
 /// @param val value of a number in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_u64 in their endianness of their machine
-uint64_t convert_to_le_u64(uint64_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint64_t convert_to_le_u64(uint64_t val);
 
 /// @brief Reads an 64-bit big endian integer number
 /// @param val value of a 64-bit unsigned integer in big endian 
 /// @return converted value of the unsigned big endian value passed into read_be_u64 in their endianness of their machine
-uint64_t read_be_u64(uint64_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint64_t read_be_u64(uint64_t val);
 
 /// @brief Writes an 64-bit big endian integer number
 /// @param val value of a number in their endianness of their machine 
 /// @return big endian value from the value passed into convert_to_be_u64 in their endianness of their machine
-uint64_t convert_to_be_u64(uint64_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR uint64_t convert_to_be_u64(uint64_t val);
+
+/// @brief Loads an 64-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint64_t load_le_u64(const void* ptr);
+
+/// @brief Stores an 64-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit unsigned integer number in little endian
+/// @param val value of a 64-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_u64(void* ptr, uint64_t val);
+
+/// @brief Loads an 64-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint64_t load_be_u64(const void* ptr);
+
+/// @brief Stores an 64-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit unsigned integer number in big endian
+/// @param val value of a 64-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_u64(void* ptr, uint64_t val);
+
+/// @brief Reads an array of 64-bit unsigned little endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 64-bit unsigned integers in little endian
+/// @param count number of values in src
+void read_le_u64_array(uint64_t* dst, const uint64_t* src, size_t count);
+
+/// @brief Reads an array of 64-bit unsigned little endian integers in place
+/// @param buf array of 64-bit unsigned integers in little endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_le_u64_array_inplace(uint64_t* buf, size_t count);
+
+/// @brief Writes an array of 64-bit unsigned little endian integers
+/// @param dst array that receives the values in little endian, may be the same array as src
+/// @param src array of 64-bit unsigned integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_u64_array(uint64_t* dst, const uint64_t* src, size_t count);
+
+/// @brief Writes an array of 64-bit unsigned little endian integers in place
+/// @param buf array of 64-bit unsigned integers in their endianness of their machine that is converted into little endian
+/// @param count number of values in buf
+void convert_to_le_u64_array_inplace(uint64_t* buf, size_t count);
+
+/// @brief Reads an array of 64-bit unsigned big endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 64-bit unsigned integers in big endian
+/// @param count number of values in src
+void read_be_u64_array(uint64_t* dst, const uint64_t* src, size_t count);
+
+/// @brief Reads an array of 64-bit unsigned big endian integers in place
+/// @param buf array of 64-bit unsigned integers in big endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_be_u64_array_inplace(uint64_t* buf, size_t count);
+
+/// @brief Writes an array of 64-bit unsigned big endian integers
+/// @param dst array that receives the values in big endian, may be the same array as src
+/// @param src array of 64-bit unsigned integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_u64_array(uint64_t* dst, const uint64_t* src, size_t count);
+
+/// @brief Writes an array of 64-bit unsigned big endian integers in place
+/// @param buf array of 64-bit unsigned integers in their endianness of their machine that is converted into big endian
+/// @param count number of values in buf
+void convert_to_be_u64_array_inplace(uint64_t* buf, size_t count);
 
 
 /*
@@ -239,22 +1013,86 @@ uint64_t convert_to_be_u64(uint64_t val);
 /// @brief Reads an 64-bit little endian integer number
 /// @param val value of a an 64-bit integer in little endian
 /// @return converted value of the signed value passed into read_le_s64 in their endianness of their machine
-int64_t read_le_s64(int64_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int64_t read_le_s64(int64_t val);
 
 /// @brief Writes an 64-bit little endian integer number
 /// @param val value of a number in their endianness of their machine
 /// @return little endian value from value passed into convert_to_le_s64 in their endianness of their machine
-int64_t convert_to_le_s64(int64_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int64_t convert_to_le_s64(int64_t val);
 
 /// @brief Reads an 64-bit big endian integer number
 /// @param val value of a number in big endian 
 /// @return converted value of the signed value passed into read_be_s64 in their endianness of their machine
-int64_t read_be_s64(int64_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int64_t read_be_s64(int64_t val);
 
 /// @brief Writes an 64-bit big endian integer number
 /// @param val value of a number in their endianness of their machine 
 /// @return big endian value from the value passed into convert_to_be_s64 in their endianness of their machine
-int64_t convert_to_be_s64(int64_t val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR int64_t convert_to_be_s64(int64_t val);
+
+/// @brief Loads an 64-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int64_t load_le_s64(const void* ptr);
+
+/// @brief Stores an 64-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit signed integer number in little endian
+/// @param val value of a 64-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_s64(void* ptr, int64_t val);
+
+/// @brief Loads an 64-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC int64_t load_be_s64(const void* ptr);
+
+/// @brief Stores an 64-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit signed integer number in big endian
+/// @param val value of a 64-bit signed integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_s64(void* ptr, int64_t val);
+
+/// @brief Reads an array of 64-bit signed little endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 64-bit signed integers in little endian
+/// @param count number of values in src
+void read_le_s64_array(int64_t* dst, const int64_t* src, size_t count);
+
+/// @brief Reads an array of 64-bit signed little endian integers in place
+/// @param buf array of 64-bit signed integers in little endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_le_s64_array_inplace(int64_t* buf, size_t count);
+
+/// @brief Writes an array of 64-bit signed little endian integers
+/// @param dst array that receives the values in little endian, may be the same array as src
+/// @param src array of 64-bit signed integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_s64_array(int64_t* dst, const int64_t* src, size_t count);
+
+/// @brief Writes an array of 64-bit signed little endian integers in place
+/// @param buf array of 64-bit signed integers in their endianness of their machine that is converted into little endian
+/// @param count number of values in buf
+void convert_to_le_s64_array_inplace(int64_t* buf, size_t count);
+
+/// @brief Reads an array of 64-bit signed big endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 64-bit signed integers in big endian
+/// @param count number of values in src
+void read_be_s64_array(int64_t* dst, const int64_t* src, size_t count);
+
+/// @brief Reads an array of 64-bit signed big endian integers in place
+/// @param buf array of 64-bit signed integers in big endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_be_s64_array_inplace(int64_t* buf, size_t count);
+
+/// @brief Writes an array of 64-bit signed big endian integers
+/// @param dst array that receives the values in big endian, may be the same array as src
+/// @param src array of 64-bit signed integers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_s64_array(int64_t* dst, const int64_t* src, size_t count);
+
+/// @brief Writes an array of 64-bit signed big endian integers in place
+/// @param buf array of 64-bit signed integers in their endianness of their machine that is converted into big endian
+/// @param count number of values in buf
+void convert_to_be_s64_array_inplace(int64_t* buf, size_t count);
 
 /*
 
@@ -265,23 +1103,1123 @@ int64_t convert_to_be_s64(int64_t val);
 /// @brief Reads an 64-bit little endian floating point number
 /// @param val value of a 64-bit floating point number in little endian
 /// @return converted value of the little endian value passed into read_le_f64 in their endianness of their machine
-double read_le_f64(double val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT double read_le_f64(double val);
 
 /// @brief Writes an 64-bit little endian floating point number
 /// @param val value of a 64-bit floating point number in their endianness of their machine
 /// @return little endian double-precision value from value passed into convert_to_le_f64 in their endianness of their machine
-double convert_to_le_f64(double val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT double convert_to_le_f64(double val);
 
 /// @brief Reads an 64-bit big endian floating point number
 /// @param val value of a 64-bit floating point number in big endian
 /// @return converted value of the big endian value passed into read_be_f64 in their endianness of their machine
-double read_be_f64(double val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT double read_be_f64(double val);
 
 /// @brief Writes an 64-bit big endian floating point number
 /// @param val value of a 64-bit floating point number in their endianness of their machine
 /// @return big endian double-precision value from value passed into convert_to_be_f64 in their endianness of their machine
-double convert_to_be_f64(double val);
+CONV_ENDIAN_FUNC CONV_ENDIAN_CONSTEXPR_FLOAT double convert_to_be_f64(double val);
+
+/// @brief Loads an 64-bit little endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit floating point number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC double load_le_f64(const void* ptr);
+
+/// @brief Stores an 64-bit little endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit floating point number in little endian
+/// @param val value of a 64-bit floating point number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_f64(void* ptr, double val);
+
+/// @brief Loads an 64-bit big endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 64-bit floating point number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC double load_be_f64(const void* ptr);
+
+/// @brief Stores an 64-bit big endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 64-bit floating point number in big endian
+/// @param val value of a 64-bit floating point number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_f64(void* ptr, double val);
+
+/// @brief Reads an array of 64-bit little endian floating point numbers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 64-bit floating point numbers in little endian
+/// @param count number of values in src
+void read_le_f64_array(double* dst, const double* src, size_t count);
+
+/// @brief Reads an array of 64-bit little endian floating point numbers in place
+/// @param buf array of 64-bit floating point numbers in little endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_le_f64_array_inplace(double* buf, size_t count);
+
+/// @brief Writes an array of 64-bit little endian floating point numbers
+/// @param dst array that receives the values in little endian, may be the same array as src
+/// @param src array of 64-bit floating point numbers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_f64_array(double* dst, const double* src, size_t count);
+
+/// @brief Writes an array of 64-bit little endian floating point numbers in place
+/// @param buf array of 64-bit floating point numbers in their endianness of their machine that is converted into little endian
+/// @param count number of values in buf
+void convert_to_le_f64_array_inplace(double* buf, size_t count);
+
+/// @brief Reads an array of 64-bit big endian floating point numbers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of 64-bit floating point numbers in big endian
+/// @param count number of values in src
+void read_be_f64_array(double* dst, const double* src, size_t count);
+
+/// @brief Reads an array of 64-bit big endian floating point numbers in place
+/// @param buf array of 64-bit floating point numbers in big endian that is converted into their endianness of their machine
+/// @param count number of values in buf
+void read_be_f64_array_inplace(double* buf, size_t count);
+
+/// @brief Writes an array of 64-bit big endian floating point numbers
+/// @param dst array that receives the values in big endian, may be the same array as src
+/// @param src array of 64-bit floating point numbers in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_f64_array(double* dst, const double* src, size_t count);
+
+/// @brief Writes an array of 64-bit big endian floating point numbers in place
+/// @param buf array of 64-bit floating point numbers in their endianness of their machine that is converted into big endian
+/// @param count number of values in buf
+void convert_to_be_f64_array_inplace(double* buf, size_t count);
+
+/*
+
+    64-bit code ends here
+
+    ---------------------------------------------------------------------------
+
+    Packed code begins here
+
+    Packed numbers take 3, 6 or 16 bytes in memory, without padding, such
+    as 24-bit audio samples, 48-bit counters and 128-bit keys. 24-bit and
+    48-bit numbers are widened into 32-bit and 64-bit numbers when they are
+    read and narrowed back when they are written. The array functions are
+    implemented in conv_endian_packed.c and are not affected by
+    CONV_ENDIAN_HEADER_ONLY.
+
+*/
+
+/// @brief A 128-bit unsigned integer number in their endianness of their machine
+typedef struct conv_endian_u128
+{
+    uint64_t lo; ///< lowest 64 bits
+    uint64_t hi; ///< highest 64 bits
+} conv_endian_u128;
+
+/*
+
+    24-bit integer starts here
+
+*/
 
+/// @brief Loads a packed 24-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 3 bytes of the 24-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint32_t load_le_u24(const void* ptr);
+
+/// @brief Stores a packed 24-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 3 bytes of the 24-bit unsigned integer number in little endian
+/// @param val value in their endianness of their machine, only its lowest 24 bits are stored
+CONV_ENDIAN_FUNC void store_le_u24(void* ptr, uint32_t val);
+
+/// @brief Loads a packed 24-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 3 bytes of the 24-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint32_t load_be_u24(const void* ptr);
+
+/// @brief Stores a packed 24-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 3 bytes of the 24-bit unsigned integer number in big endian
+/// @param val value in their endianness of their machine, only its lowest 24 bits are stored
+CONV_ENDIAN_FUNC void store_be_u24(void* ptr, uint32_t val);
+
+/// @brief Loads a packed 24-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 3 bytes of the 24-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine, sign extended
+CONV_ENDIAN_FUNC int32_t load_le_s24(const void* ptr);
+
+/// @brief Stores a packed 24-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 3 bytes of the 24-bit signed integer number in little endian
+/// @param val value in their endianness of their machine, only its lowest 24 bits are stored
+CONV_ENDIAN_FUNC void store_le_s24(void* ptr, int32_t val);
+
+/// @brief Loads a packed 24-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 3 bytes of the 24-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine, sign extended
+CONV_ENDIAN_FUNC int32_t load_be_s24(const void* ptr);
+
+/// @brief Stores a packed 24-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 3 bytes of the 24-bit signed integer number in big endian
+/// @param val value in their endianness of their machine, only its lowest 24 bits are stored
+CONV_ENDIAN_FUNC void store_be_s24(void* ptr, int32_t val);
+
+/// @brief Reads an array of packed 24-bit unsigned little endian integers into an array of uint32_t
+/// @param dst array that receives the values in their endianness of their machine
+/// @param src array of count packed values of 3 bytes in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_u24_array(uint32_t* dst, const void* src, size_t count);
+
+/// @brief Writes an array of uint32_t as packed 24-bit unsigned little endian integers
+/// @param dst array that receives count packed values of 3 bytes in little endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 24 bits are written
+/// @param count number of values in src
+void convert_to_le_u24_array(void* dst, const uint32_t* src, size_t count);
+
+/// @brief Reads an array of packed 24-bit unsigned big endian integers into an array of uint32_t
+/// @param dst array that receives the values in their endianness of their machine
+/// @param src array of count packed values of 3 bytes in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_u24_array(uint32_t* dst, const void* src, size_t count);
+
+/// @brief Writes an array of uint32_t as packed 24-bit unsigned big endian integers
+/// @param dst array that receives count packed values of 3 bytes in big endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 24 bits are written
+/// @param count number of values in src
+void convert_to_be_u24_array(void* dst, const uint32_t* src, size_t count);
+
+/// @brief Reads an array of packed 24-bit signed little endian integers into an array of int32_t
+/// @param dst array that receives the values in their endianness of their machine, sign extended
+/// @param src array of count packed values of 3 bytes in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_s24_array(int32_t* dst, const void* src, size_t count);
+
+/// @brief Writes an array of int32_t as packed 24-bit signed little endian integers
+/// @param dst array that receives count packed values of 3 bytes in little endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 24 bits are written
+/// @param count number of values in src
+void convert_to_le_s24_array(void* dst, const int32_t* src, size_t count);
+
+/// @brief Reads an array of packed 24-bit signed big endian integers into an array of int32_t
+/// @param dst array that receives the values in their endianness of their machine, sign extended
+/// @param src array of count packed values of 3 bytes in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_s24_array(int32_t* dst, const void* src, size_t count);
+
+/// @brief Writes an array of int32_t as packed 24-bit signed big endian integers
+/// @param dst array that receives count packed values of 3 bytes in big endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 24 bits are written
+/// @param count number of values in src
+void convert_to_be_s24_array(void* dst, const int32_t* src, size_t count);
+
+/*
+
+    48-bit integer starts here
+
+*/
+
+/// @brief Loads a packed 48-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 6 bytes of the 48-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint64_t load_le_u48(const void* ptr);
+
+/// @brief Stores a packed 48-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 6 bytes of the 48-bit unsigned integer number in little endian
+/// @param val value in their endianness of their machine, only its lowest 48 bits are stored
+CONV_ENDIAN_FUNC void store_le_u48(void* ptr, uint64_t val);
+
+/// @brief Loads a packed 48-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 6 bytes of the 48-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC uint64_t load_be_u48(const void* ptr);
+
+/// @brief Stores a packed 48-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 6 bytes of the 48-bit unsigned integer number in big endian
+/// @param val value in their endianness of their machine, only its lowest 48 bits are stored
+CONV_ENDIAN_FUNC void store_be_u48(void* ptr, uint64_t val);
+
+/// @brief Loads a packed 48-bit signed little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 6 bytes of the 48-bit signed integer number in little endian
+/// @return value at ptr in their endianness of their machine, sign extended
+CONV_ENDIAN_FUNC int64_t load_le_s48(const void* ptr);
+
+/// @brief Stores a packed 48-bit signed little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 6 bytes of the 48-bit signed integer number in little endian
+/// @param val value in their endianness of their machine, only its lowest 48 bits are stored
+CONV_ENDIAN_FUNC void store_le_s48(void* ptr, int64_t val);
+
+/// @brief Loads a packed 48-bit signed big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 6 bytes of the 48-bit signed integer number in big endian
+/// @return value at ptr in their endianness of their machine, sign extended
+CONV_ENDIAN_FUNC int64_t load_be_s48(const void* ptr);
+
+/// @brief Stores a packed 48-bit signed big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 6 bytes of the 48-bit signed integer number in big endian
+/// @param val value in their endianness of their machine, only its lowest 48 bits are stored
+CONV_ENDIAN_FUNC void store_be_s48(void* ptr, int64_t val);
+
+/// @brief Reads an array of packed 48-bit unsigned little endian integers into an array of uint64_t
+/// @param dst array that receives the values in their endianness of their machine
+/// @param src array of count packed values of 6 bytes in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_u48_array(uint64_t* dst, const void* src, size_t count);
+
+/// @brief Writes an array of uint64_t as packed 48-bit unsigned little endian integers
+/// @param dst array that receives count packed values of 6 bytes in little endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 48 bits are written
+/// @param count number of values in src
+void convert_to_le_u48_array(void* dst, const uint64_t* src, size_t count);
+
+/// @brief Reads an array of packed 48-bit unsigned big endian integers into an array of uint64_t
+/// @param dst array that receives the values in their endianness of their machine
+/// @param src array of count packed values of 6 bytes in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_u48_array(uint64_t* dst, const void* src, size_t count);
+
+/// @brief Writes an array of uint64_t as packed 48-bit unsigned big endian integers
+/// @param dst array that receives count packed values of 6 bytes in big endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 48 bits are written
+/// @param count number of values in src
+void convert_to_be_u48_array(void* dst, const uint64_t* src, size_t count);
+
+/// @brief Reads an array of packed 48-bit signed little endian integers into an array of int64_t
+/// @param dst array that receives the values in their endianness of their machine, sign extended
+/// @param src array of count packed values of 6 bytes in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_s48_array(int64_t* dst, const void* src, size_t count);
+
+/// @brief Writes an array of int64_t as packed 48-bit signed little endian integers
+/// @param dst array that receives count packed values of 6 bytes in little endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 48 bits are written
+/// @param count number of values in src
+void convert_to_le_s48_array(void* dst, const int64_t* src, size_t count);
+
+/// @brief Reads an array of packed 48-bit signed big endian integers into an array of int64_t
+/// @param dst array that receives the values in their endianness of their machine, sign extended
+/// @param src array of count packed values of 6 bytes in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_s48_array(int64_t* dst, const void* src, size_t count);
+
+/// @brief Writes an array of int64_t as packed 48-bit signed big endian integers
+/// @param dst array that receives count packed values of 6 bytes in big endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 48 bits are written
+/// @param count number of values in src
+void convert_to_be_s48_array(void* dst, const int64_t* src, size_t count);
+
+/*
+
+    128-bit integer starts here
+
+*/
+
+/// @brief Loads a 128-bit unsigned little endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 128-bit unsigned integer number in little endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC conv_endian_u128 load_le_u128(const void* ptr);
+
+/// @brief Stores a 128-bit unsigned little endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 128-bit unsigned integer number in little endian
+/// @param val value of a 128-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_le_u128(void* ptr, conv_endian_u128 val);
+
+/// @brief Loads a 128-bit unsigned big endian integer number from memory that does not have to be aligned
+/// @param ptr address of the 128-bit unsigned integer number in big endian
+/// @return value at ptr in their endianness of their machine
+CONV_ENDIAN_FUNC conv_endian_u128 load_be_u128(const void* ptr);
+
+/// @brief Stores a 128-bit unsigned big endian integer number into memory that does not have to be aligned
+/// @param ptr address that receives the 128-bit unsigned integer number in big endian
+/// @param val value of a 128-bit unsigned integer number in their endianness of their machine
+CONV_ENDIAN_FUNC void store_be_u128(void* ptr, conv_endian_u128 val);
+
+/// @brief Reads an array of 128-bit unsigned little endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count 128-bit unsigned integers in little endian
+/// @param count number of values in src
+void read_le_u128_array(conv_endian_u128* dst, const void* src, size_t count);
+
+/// @brief Writes an array of 128-bit unsigned little endian integers
+/// @param dst array that receives count 128-bit unsigned integers in little endian, may be the same array as src
+/// @param src array of values in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_u128_array(void* dst, const conv_endian_u128* src, size_t count);
+
+/// @brief Reads an array of 128-bit unsigned big endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count 128-bit unsigned integers in big endian
+/// @param count number of values in src
+void read_be_u128_array(conv_endian_u128* dst, const void* src, size_t count);
+
+/// @brief Writes an array of 128-bit unsigned big endian integers
+/// @param dst array that receives count 128-bit unsigned integers in big endian, may be the same array as src
+/// @param src array of values in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_u128_array(void* dst, const conv_endian_u128* src, size_t count);
+
+/*
+
+    Packed code ends here
+
+    ---------------------------------------------------------------------------
+
+    16-bit floating point code begins here
+
+    IEEE 754 half precision (f16) and bfloat16 (bf16) numbers are widened
+    into 32-bit floating point numbers when they are read and rounded back
+    when they are written, so an array is swapped and widened in a single
+    pass. The array functions are implemented in conv_endian_half.c and
+    are not affected by CONV_ENDIAN_HEADER_ONLY.
+
+*/
+
+/*
+
+    Half precision floating point starts here
+
+*/
+
+/// @brief Loads a half precision little endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit floating point number in little endian
+/// @return value at ptr widened into a 32-bit floating point number
+CONV_ENDIAN_FUNC float load_le_f16(const void* ptr);
+
+/// @brief Stores a half precision little endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit floating point number in little endian
+/// @param val 32-bit floating point number that is rounded to the nearest half precision number, ties to even
+CONV_ENDIAN_FUNC void store_le_f16(void* ptr, float val);
+
+/// @brief Loads a half precision big endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit floating point number in big endian
+/// @return value at ptr widened into a 32-bit floating point number
+CONV_ENDIAN_FUNC float load_be_f16(const void* ptr);
+
+/// @brief Stores a half precision big endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit floating point number in big endian
+/// @param val 32-bit floating point number that is rounded to the nearest half precision number, ties to even
+CONV_ENDIAN_FUNC void store_be_f16(void* ptr, float val);
+
+/// @brief Reads an array of half precision little endian floating point numbers into an array of 32-bit floating point numbers
+/// @param dst array that receives the widened values
+/// @param src array of count 16-bit floating point numbers in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_f16_array(float* dst, const void* src, size_t count);
+
+/// @brief Writes an array of 32-bit floating point numbers as half precision little endian floating point numbers
+/// @param dst array that receives count 16-bit floating point numbers in little endian, must not overlap src
+/// @param src array of 32-bit floating point numbers that are rounded to the nearest half precision numbers, ties to even
+/// @param count number of values in src
+void convert_to_le_f16_array(void* dst, const float* src, size_t count);
+
+/// @brief Reads an array of half precision big endian floating point numbers into an array of 32-bit floating point numbers
+/// @param dst array that receives the widened values
+/// @param src array of count 16-bit floating point numbers in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_f16_array(float* dst, const void* src, size_t count);
+
+/// @brief Writes an array of 32-bit floating point numbers as half precision big endian floating point numbers
+/// @param dst array that receives count 16-bit floating point numbers in big endian, must not overlap src
+/// @param src array of 32-bit floating point numbers that are rounded to the nearest half precision numbers, ties to even
+/// @param count number of values in src
+void convert_to_be_f16_array(void* dst, const float* src, size_t count);
+
+/*
+
+    bfloat16 floating point starts here
+
+*/
+
+/// @brief Loads a bfloat16 little endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit floating point number in little endian
+/// @return value at ptr widened into a 32-bit floating point number
+CONV_ENDIAN_FUNC float load_le_bf16(const void* ptr);
+
+/// @brief Stores a bfloat16 little endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit floating point number in little endian
+/// @param val 32-bit floating point number that is rounded to the nearest bfloat16 number, ties to even
+CONV_ENDIAN_FUNC void store_le_bf16(void* ptr, float val);
+
+/// @brief Loads a bfloat16 big endian floating point number from memory that does not have to be aligned
+/// @param ptr address of the 16-bit floating point number in big endian
+/// @return value at ptr widened into a 32-bit floating point number
+CONV_ENDIAN_FUNC float load_be_bf16(const void* ptr);
+
+/// @brief Stores a bfloat16 big endian floating point number into memory that does not have to be aligned
+/// @param ptr address that receives the 16-bit floating point number in big endian
+/// @param val 32-bit floating point number that is rounded to the nearest bfloat16 number, ties to even
+CONV_ENDIAN_FUNC void store_be_bf16(void* ptr, float val);
+
+/// @brief Reads an array of bfloat16 little endian floating point numbers into an array of 32-bit floating point numbers
+/// @param dst array that receives the widened values
+/// @param src array of count 16-bit floating point numbers in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_bf16_array(float* dst, const void* src, size_t count);
+
+/// @brief Writes an array of 32-bit floating point numbers as bfloat16 little endian floating point numbers
+/// @param dst array that receives count 16-bit floating point numbers in little endian, must not overlap src
+/// @param src array of 32-bit floating point numbers that are rounded to the nearest bfloat16 numbers, ties to even
+/// @param count number of values in src
+void convert_to_le_bf16_array(void* dst, const float* src, size_t count);
+
+/// @brief Reads an array of bfloat16 big endian floating point numbers into an array of 32-bit floating point numbers
+/// @param dst array that receives the widened values
+/// @param src array of count 16-bit floating point numbers in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_bf16_array(float* dst, const void* src, size_t count);
+
+/// @brief Writes an array of 32-bit floating point numbers as bfloat16 big endian floating point numbers
+/// @param dst array that receives count 16-bit floating point numbers in big endian, must not overlap src
+/// @param src array of 32-bit floating point numbers that are rounded to the nearest bfloat16 numbers, ties to even
+/// @param count number of values in src
+void convert_to_be_bf16_array(void* dst, const float* src, size_t count);
+
+/*
+
+    16-bit floating point code ends here
+
+    ---------------------------------------------------------------------------
+
+    Bulk byte swapping begins here
+
+    The array functions above are implemented in conv_endian_bulk.c on top
+    of these functions. They are not affected by CONV_ENDIAN_HEADER_ONLY.
+    dst and src may point to the same array but must not partially overlap.
+
+*/
+
+/// @brief Reverses the bytes of every 16-bit value in an array
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+void conv_endian_bswap16_array(void* dst, const void* src, size_t count);
+
+/// @brief Reverses the bytes of every 32-bit value in an array
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+void conv_endian_bswap32_array(void* dst, const void* src, size_t count);
+
+/// @brief Reverses the bytes of every 64-bit value in an array
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+void conv_endian_bswap64_array(void* dst, const void* src, size_t count);
+
+/*
+
+    Streaming
+
+    An out of place conversion of an array at least as large as the stream
+    threshold writes its destination with non-temporal stores, which do not
+    evict the rest of the cache to make room for it. The threshold is the
+    size of the largest cache of the processor, or
+    CONV_ENDIAN_STREAM_THRESHOLD when the processor does not describe its
+    caches. The _stream functions use non-temporal stores whatever the size
+    of the array. Only vector kernels have non-temporal stores.
+
+*/
+
+/// @brief Stream threshold used when the size of the caches of the processor is not known
+#define CONV_ENDIAN_STREAM_THRESHOLD (8 * 1024 * 1024)
+
+/// @brief Reverses the bytes of every 16-bit value in an array with non-temporal stores whatever its size
+/// @param dst array that receives the byte swapped values, converted like conv_endian_bswap16_array when it is the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+void conv_endian_bswap16_array_stream(void* dst, const void* src, size_t count);
+
+/// @brief Reverses the bytes of every 32-bit value in an array with non-temporal stores whatever its size
+/// @param dst array that receives the byte swapped values, converted like conv_endian_bswap32_array when it is the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+void conv_endian_bswap32_array_stream(void* dst, const void* src, size_t count);
+
+/// @brief Reverses the bytes of every 64-bit value in an array with non-temporal stores whatever its size
+/// @param dst array that receives the byte swapped values, converted like conv_endian_bswap64_array when it is the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+void conv_endian_bswap64_array_stream(void* dst, const void* src, size_t count);
+
+/// @brief Sets the number of bytes from which out of place bulk conversions use non-temporal stores
+/// @param bytes threshold in bytes, 0 to always use them or SIZE_MAX to never use them
+void conv_endian_set_stream_threshold(size_t bytes);
+
+/// @brief Gets the number of bytes from which out of place bulk conversions use non-temporal stores
+/// @return threshold in bytes
+size_t conv_endian_get_stream_threshold(void);
+
+/*
+
+    Strided conversion
+
+    Gathering converts one field out of every record of an array of fixed
+    size records into a dense array in their endianness of their machine,
+    and scattering writes a dense array back into that field. These are
+    implemented in conv_endian_strided.c.
+
+*/
+
+/// @brief Endianness of numbers that are converted by functions which take it as a parameter
+typedef enum conv_endian_order
+{
+    CONV_ENDIAN_ORDER_LITTLE = 0, ///< little endian
+    CONV_ENDIAN_ORDER_BIG = 1 ///< big endian
+} conv_endian_order;
+
+/// @brief Converts one field of every record in an array of records into a dense array
+/// @param dst dense array that receives count numbers in their endianness of their machine
+/// @param base address of the field in the first record
+/// @param stride number of bytes from one record to the next, at least width
+/// @param count number of records
+/// @param width number of bytes in the field: 1, 2, 4 or 8
+/// @param order endianness of the field
+/// @return 0 on success or -1 if width or stride is not supported
+int conv_endian_gather(void* dst, const void* base, size_t stride, size_t count, size_t width, conv_endian_order order);
+
+/// @brief Converts a dense array into one field of every record in an array of records
+/// @param base address of the field in the first record
+/// @param stride number of bytes from one record to the next, at least width
+/// @param src dense array of count numbers in their endianness of their machine
+/// @param count number of records
+/// @param width number of bytes in the field: 1, 2, 4 or 8
+/// @param order endianness the field is written in
+/// @return 0 on success or -1 if width or stride is not supported
+int conv_endian_scatter(void* base, size_t stride, const void* src, size_t count, size_t width, conv_endian_order order);
+
+/*
+
+    Record permutation
+
+    Rearranging the bytes of every record in an array of fixed size records
+    converts every field of the records at once, for example byte swapping
+    a record made of a 16-bit, a 32-bit and a 64-bit number. The
+    permutation is done with byte shuffles when no byte has to move
+    between the 16-byte blocks of the array and a multiple of 64 bytes that
+    holds a whole number of records is no larger than
+    CONV_ENDIAN_PERMUTE_MAX_PERIOD.
+
+*/
+
+/// @brief Largest repeating block of records that conv_endian_permute_records converts with byte shuffles
+#define CONV_ENDIAN_PERMUTE_MAX_PERIOD 1024
+
+/// @brief Rearranges the bytes of every record in an array of fixed size records
+/// @param dst array that receives the rearranged records, may be the same array as src
+/// @param src array of records
+/// @param count number of records in src
+/// @param record_size number of bytes in a record
+/// @param perm record_size byte indices, byte i of every record in dst is byte perm[i] of the same record in src
+/// @return 0 on success or -1, without converting anything, if memory for converting records larger than 256 bytes in place could not be allocated
+int conv_endian_permute_records(void* dst, const void* src, size_t count, size_t record_size, const uint16_t* perm);
+
+/// @brief Checks whether a record permutation can be done with byte shuffles
+/// @param record_size number of bytes in a record
+/// @param perm record_size byte indices
+/// @return 1 if conv_endian_permute_records uses byte shuffles for this permutation whenever a vector kernel is in use, 0 otherwise
+int conv_endian_permute_fits_shuffles(size_t record_size, const uint16_t* perm);
+
+/*
+
+    Checksums
+
+    Packets are usually checksummed as they are converted, so the byte
+    swapping functions have variants that compute the CRC32C or the
+    Internet checksum of the data in the same pass, either of the source
+    as it was before the conversion, when reading, or of the destination,
+    when writing. Checksums are chained by passing the value returned for
+    one buffer when the next buffer is checksummed. These are implemented
+    in conv_endian_checksum.c.
+
+*/
+
+/// @brief Computes the CRC32C of a buffer
+/// @param data buffer to be checksummed
+/// @param size number of bytes in data
+/// @param crc CRC32C of the data before this buffer, or 0 for the first buffer
+/// @return CRC32C of the data up to the end of this buffer
+uint32_t conv_endian_crc32c(const void* data, size_t size, uint32_t crc);
+
+/// @brief Computes the Internet checksum sum of a buffer
+/// @param data buffer to be checksummed, which must have an even size unless it is the last buffer
+/// @param size number of bytes in data
+/// @param sum sum of the data before this buffer, or 0 for the first buffer
+/// @return one's complement sum of the big endian 16-bit words up to the end of this buffer, whose complement is the checksum
+uint16_t conv_endian_inet_sum(const void* data, size_t size, uint16_t sum);
+
+/// @brief Reverses the bytes of every 16-bit value in an array and computes the CRC32C of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before src, or 0
+/// @return CRC32C of the data up to the end of src, as it was before the conversion
+uint32_t conv_endian_bswap16_array_crc32c(void* dst, const void* src, size_t count, uint32_t crc);
+
+/// @brief Reverses the bytes of every 32-bit value in an array and computes the CRC32C of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before src, or 0
+/// @return CRC32C of the data up to the end of src, as it was before the conversion
+uint32_t conv_endian_bswap32_array_crc32c(void* dst, const void* src, size_t count, uint32_t crc);
+
+/// @brief Reverses the bytes of every 64-bit value in an array and computes the CRC32C of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before src, or 0
+/// @return CRC32C of the data up to the end of src, as it was before the conversion
+uint32_t conv_endian_bswap64_array_crc32c(void* dst, const void* src, size_t count, uint32_t crc);
+
+/// @brief Reverses the bytes of every 16-bit value in an array and computes the CRC32C of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before dst, or 0
+/// @return CRC32C of the data up to the end of dst
+uint32_t conv_endian_bswap16_array_crc32c_dst(void* dst, const void* src, size_t count, uint32_t crc);
+
+/// @brief Reverses the bytes of every 32-bit value in an array and computes the CRC32C of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before dst, or 0
+/// @return CRC32C of the data up to the end of dst
+uint32_t conv_endian_bswap32_array_crc32c_dst(void* dst, const void* src, size_t count, uint32_t crc);
+
+/// @brief Reverses the bytes of every 64-bit value in an array and computes the CRC32C of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before dst, or 0
+/// @return CRC32C of the data up to the end of dst
+uint32_t conv_endian_bswap64_array_crc32c_dst(void* dst, const void* src, size_t count, uint32_t crc);
+
+/// @brief Reverses the bytes of every 16-bit value in an array and computes the Internet checksum sum of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before src, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of src, as it was before the conversion
+uint16_t conv_endian_bswap16_array_inet_sum(void* dst, const void* src, size_t count, uint16_t sum);
+
+/// @brief Reverses the bytes of every 32-bit value in an array and computes the Internet checksum sum of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before src, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of src, as it was before the conversion
+uint16_t conv_endian_bswap32_array_inet_sum(void* dst, const void* src, size_t count, uint16_t sum);
+
+/// @brief Reverses the bytes of every 64-bit value in an array and computes the Internet checksum sum of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before src, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of src, as it was before the conversion
+uint16_t conv_endian_bswap64_array_inet_sum(void* dst, const void* src, size_t count, uint16_t sum);
+
+/// @brief Reverses the bytes of every 16-bit value in an array and computes the Internet checksum sum of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before dst, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of dst
+uint16_t conv_endian_bswap16_array_inet_sum_dst(void* dst, const void* src, size_t count, uint16_t sum);
+
+/// @brief Reverses the bytes of every 32-bit value in an array and computes the Internet checksum sum of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before dst, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of dst
+uint16_t conv_endian_bswap32_array_inet_sum_dst(void* dst, const void* src, size_t count, uint16_t sum);
+
+/// @brief Reverses the bytes of every 64-bit value in an array and computes the Internet checksum sum of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before dst, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of dst
+uint16_t conv_endian_bswap64_array_inet_sum_dst(void* dst, const void* src, size_t count, uint16_t sum);
+
+/*
+
+    PCM samples
+
+    Audio samples are stored as signed 16-bit, packed 24-bit or 32-bit
+    integers in either endianness and processed as 32-bit floating point
+    numbers in [-1, 1). Reading byte swaps, sign extends and scales the
+    samples in one pass; writing scales, rounds to the nearest integer,
+    ties to even, and clamps samples outside [-1, 1) to the full scale
+    value of their sign. NaNs are written as 0. Samples of several channels
+    are interleaved frame after frame, and the _planar functions convert
+    them from and into one array per channel. These are implemented in
+    conv_endian_pcm.c.
+
+*/
+
+/// @brief Reads an array of PCM samples into an array of 32-bit floating point numbers
+/// @param dst array that receives count samples in [-1, 1)
+/// @param src array of count samples, must not overlap dst
+/// @param count number of samples in src
+/// @param width number of bytes in a sample: 2, 3 or 4
+/// @param order endianness of the samples
+/// @return 0 on success or -1 if width is not supported
+int conv_endian_pcm_to_float(float* dst, const void* src, size_t count, size_t width, conv_endian_order order);
+
+/// @brief Writes an array of 32-bit floating point numbers as PCM samples
+/// @param dst array that receives count samples, must not overlap src
+/// @param src array of count samples in [-1, 1), samples outside are clamped
+/// @param count number of samples in src
+/// @param width number of bytes in a sample: 2, 3 or 4
+/// @param order endianness the samples are written in
+/// @return 0 on success or -1 if width is not supported
+int conv_endian_float_to_pcm(void* dst, const float* src, size_t count, size_t width, conv_endian_order order);
+
+/// @brief Reads interleaved PCM samples into one array of 32-bit floating point numbers per channel
+/// @param dst channels arrays that each receive frames samples in [-1, 1)
+/// @param src array of frames frames of channels samples each, must not overlap any array of dst
+/// @param frames number of frames in src
+/// @param channels number of channels
+/// @param width number of bytes in a sample: 2, 3 or 4
+/// @param order endianness of the samples
+/// @return 0 on success or -1 if width is not supported or channels is 0
+int conv_endian_pcm_to_float_planar(float* const* dst, const void* src, size_t frames, size_t channels, size_t width, conv_endian_order order);
+
+/// @brief Writes one array of 32-bit floating point numbers per channel as interleaved PCM samples
+/// @param dst array that receives frames frames of channels samples each, must not overlap any array of src
+/// @param src channels arrays of frames samples each in [-1, 1), samples outside are clamped
+/// @param frames number of frames
+/// @param channels number of channels
+/// @param width number of bytes in a sample: 2, 3 or 4
+/// @param order endianness the samples are written in
+/// @return 0 on success or -1 if width is not supported or channels is 0
+int conv_endian_float_to_pcm_planar(void* dst, const float* const* src, size_t frames, size_t channels, size_t width, conv_endian_order order);
+
+/*
+
+    Delta coding
+
+    Time series of timestamps and counters are usually stored as the
+    differences between consecutive values, which are small, and
+    sometimes as the differences between consecutive differences, which
+    are mostly 0 for regular intervals. Zigzag coding maps differences of
+    either sign to small unsigned numbers, 0, -1, 1, -2 becoming 0, 1, 2,
+    3. Decoding byte swaps the stored differences and adds them up with
+    vectorized prefix sums in one pass, and encoding takes the differences
+    and byte swaps them. Every operation wraps around modulo 2^32 or 2^64.
+    A series split into several buffers is converted one buffer after
+    another with the same state. These are implemented in
+    conv_endian_delta.c.
+
+*/
+
+/// @brief How the values of a series are stored
+typedef enum conv_endian_delta_coding
+{
+    CONV_ENDIAN_DELTA = 0, ///< differences between consecutive values
+    CONV_ENDIAN_DELTA_ZIGZAG = 1, ///< zigzag coded differences between consecutive values
+    CONV_ENDIAN_DELTA_OF_DELTA = 2, ///< differences between consecutive differences
+    CONV_ENDIAN_DELTA_OF_DELTA_ZIGZAG = 3 ///< zigzag coded differences between consecutive differences
+} conv_endian_delta_coding;
+
+/// @brief Values that a series carries from one buffer to the next, all 0 at the start of a series
+typedef struct conv_endian_delta_state
+{
+    uint64_t last; ///< last value of the series
+    uint64_t delta; ///< last difference between two values of the series, only kept by delta of delta coding
+} conv_endian_delta_state;
+
+/// @brief Decodes an array of delta coded unsigned integer numbers
+/// @param dst array that receives count values in their endianness of their machine, may be the same array as src
+/// @param src array of count stored differences
+/// @param count number of values in src
+/// @param width number of bytes in a value: 4 or 8
+/// @param order endianness of the stored differences
+/// @param coding how the differences are stored
+/// @param state state of the series before src, updated to the end of src, or NULL for a series that starts and ends in src
+/// @return 0 on success or -1 if width or coding is not supported
+int conv_endian_delta_decode(void* dst, const void* src, size_t count, size_t width, conv_endian_order order, conv_endian_delta_coding coding, conv_endian_delta_state* state);
+
+/// @brief Encodes an array of unsigned integer numbers as delta coded numbers
+/// @param dst array that receives count stored differences, must not overlap src
+/// @param src array of count values in their endianness of their machine
+/// @param count number of values in src
+/// @param width number of bytes in a value: 4 or 8
+/// @param order endianness the differences are stored in
+/// @param coding how the differences are stored
+/// @param state state of the series before src, updated to the end of src, or NULL for a series that starts and ends in src
+/// @return 0 on success or -1 if width or coding is not supported
+int conv_endian_delta_encode(void* dst, const void* src, size_t count, size_t width, conv_endian_order order, conv_endian_delta_coding coding, conv_endian_delta_state* state);
+
+/*
+
+    Column statistics
+
+    Columns are usually summarized while they are loaded, with the
+    minimum, maximum and sum of their values and the number of nulls, so
+    the _stats variants of the array reading functions compute these in
+    the same pass as the conversion. Nulls are given by an optional
+    validity bitmap in which bit i % 8 of byte i / 8 is set when value i is
+    not null, as in Apache Arrow. Null values are still converted but left
+    out of the statistics, and so are NaNs, which are counted on their own.
+    Statistics are merged into a conv_endian_stats that starts zeroed, so
+    a column read in several pieces is summarized by reading every piece
+    into the same one. These are implemented in conv_endian_stats.c.
+
+*/
+
+/// @brief A minimum, maximum or sum, of the member that matches the type of the values
+typedef union conv_endian_stat
+{
+    uint64_t u; ///< unsigned integer numbers
+    int64_t s; ///< signed integer numbers
+    double f; ///< floating point numbers
+} conv_endian_stat;
+
+/// @brief Statistics of a column of values, all 0 before its first values are read
+typedef struct conv_endian_stats
+{
+    size_t count; ///< number of values that are neither null nor NaN, which the statistics are of
+    size_t null_count; ///< number of values that are null in the validity bitmap
+    size_t nan_count; ///< number of NaNs that are not null
+    conv_endian_stat min; ///< smallest value, only set when count is not 0
+    conv_endian_stat max; ///< largest value, only set when count is not 0
+    conv_endian_stat sum; ///< sum of the values, modulo 2^64 for integers and added in any order in double precision for floating point numbers
+} conv_endian_stats;
+
+/// @brief Reads an array of 16-bit unsigned little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_u16_array_stats(uint16_t* dst, const uint16_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 16-bit signed little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_s16_array_stats(int16_t* dst, const int16_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 32-bit unsigned little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_u32_array_stats(uint32_t* dst, const uint32_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 32-bit signed little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_s32_array_stats(int32_t* dst, const int32_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 32-bit little endian floating point numbers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_f32_array_stats(float* dst, const float* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 64-bit unsigned little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_u64_array_stats(uint64_t* dst, const uint64_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 64-bit signed little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_s64_array_stats(int64_t* dst, const int64_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 64-bit little endian floating point numbers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_f64_array_stats(double* dst, const double* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 16-bit unsigned big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_u16_array_stats(uint16_t* dst, const uint16_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 16-bit signed big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_s16_array_stats(int16_t* dst, const int16_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 32-bit unsigned big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_u32_array_stats(uint32_t* dst, const uint32_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 32-bit signed big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_s32_array_stats(int32_t* dst, const int32_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 32-bit big endian floating point numbers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_f32_array_stats(float* dst, const float* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 64-bit unsigned big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_u64_array_stats(uint64_t* dst, const uint64_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 64-bit signed big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_s64_array_stats(int64_t* dst, const int64_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/// @brief Reads an array of 64-bit big endian floating point numbers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_f64_array_stats(double* dst, const double* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+/*
+
+    Kernel selection
+
+    The bulk functions check which instruction sets the processor supports
+    once and use the fastest kernel available. Vector kernels are only
+    compiled for x86 processors, and not at all when the library is compiled
+    with CONV_ENDIAN_NO_SIMD defined.
+
+*/
+
+/// @brief Kernels that the bulk functions can use
+typedef enum conv_endian_kernel
+{
+    CONV_ENDIAN_KERNEL_SCALAR = 0, ///< one 64-bit word at a time in plain C
+    CONV_ENDIAN_KERNEL_SSSE3 = 1, ///< 16-byte shuffles, CRC32C also uses SSE4.2 where the processor has it
+    CONV_ENDIAN_KERNEL_AVX2 = 2, ///< 32-byte shuffles, also requires F16C for half precision conversions
+    CONV_ENDIAN_KERNEL_AVX512 = 3 ///< 64-byte shuffles with AVX-512BW
+} conv_endian_kernel;
+
+/// @brief Gets the fastest kernel that the processor supports
+/// @return fastest supported kernel
+conv_endian_kernel conv_endian_best_kernel(void);
+
+/// @brief Gets the kernel that the bulk functions currently use
+/// @return kernel in use
+conv_endian_kernel conv_endian_get_kernel(void);
+
+/// @brief Forces the bulk functions to use a kernel, it should not be called while other threads are converting
+/// @param kernel kernel to be used
+/// @return 0 on success or -1 if the processor or the build does not support kernel
+int conv_endian_set_kernel(conv_endian_kernel kernel);
+
+/// @brief Gets the name of a kernel
+/// @param kernel kernel to be named
+/// @return name of kernel such as "avx2"
+const char* conv_endian_kernel_name(conv_endian_kernel kernel);
+
+/*
+
+    Instrumentation
+
+    When the library is compiled with CONV_ENDIAN_INSTRUMENT defined, the
+    bulk conversions count their calls and the bytes they read, both per
+    operation and per kernel. Every thread counts on its own and the counts
+    are only added up when a snapshot is taken, so counting does not make
+    threads wait for each other. Where <sys/sdt.h> is available the bulk
+    conversions also have the USDT probes conv_endian:convert__start and
+    conv_endian:convert__done for perf and bpftrace. Without
+    CONV_ENDIAN_INSTRUMENT the functions below are still there but every
+    count stays 0.
+
+    Calls are counted per operation rather than per function: the array
+    functions of every type, endianness and width that run on the same
+    kernels share one operation. A call is counted where it reaches those
+    kernels, so a function that is built on another one is counted as that
+    one, such as the 128-bit array functions and conv_endian_unpack as
+    permutations or byte swaps. The worker pool converts large arrays a
+    chunk at a time, so a parallel conversion is counted once per chunk of
+    CONV_ENDIAN_PARALLEL_CHUNK bytes rather than once.
+
+*/
+
+/// @brief Operations that are counted separately
+typedef enum conv_endian_operation
+{
+    CONV_ENDIAN_OPERATION_BSWAP16 = 0, ///< byte swapping arrays of 16-bit values, which most array conversions do
+    CONV_ENDIAN_OPERATION_BSWAP32 = 1, ///< byte swapping arrays of 32-bit values
+    CONV_ENDIAN_OPERATION_BSWAP64 = 2, ///< byte swapping arrays of 64-bit values
+    CONV_ENDIAN_OPERATION_PERMUTE = 3, ///< rearranging the bytes of records
+    CONV_ENDIAN_OPERATION_GATHER = 4, ///< converting a field of an array of records into a dense array
+    CONV_ENDIAN_OPERATION_SCATTER = 5, ///< converting a dense array into a field of an array of records
+    CONV_ENDIAN_OPERATION_CHECKSUM = 6, ///< byte swapping arrays while checksumming them
+    CONV_ENDIAN_OPERATION_PCM_DECODE = 7, ///< reading PCM samples
+    CONV_ENDIAN_OPERATION_PCM_ENCODE = 8, ///< writing PCM samples
+    CONV_ENDIAN_OPERATION_DELTA_DECODE = 9, ///< decoding delta coded numbers
+    CONV_ENDIAN_OPERATION_DELTA_ENCODE = 10, ///< encoding delta coded numbers
+    CONV_ENDIAN_OPERATION_STATS = 11, ///< reading arrays with their statistics
+    CONV_ENDIAN_OPERATION_PACKED_READ = 12, ///< reading packed 24-bit and 48-bit numbers
+    CONV_ENDIAN_OPERATION_PACKED_WRITE = 13, ///< writing packed 24-bit and 48-bit numbers
+    CONV_ENDIAN_OPERATION_HALF_READ = 14, ///< reading half precision and bfloat16 numbers
+    CONV_ENDIAN_OPERATION_HALF_WRITE = 15, ///< writing half precision and bfloat16 numbers
+    CONV_ENDIAN_OPERATION_COUNT = 16 ///< number of operations
+} conv_endian_operation;
+
+/// @brief Number of calls and of bytes they read
+typedef struct conv_endian_counter
+{
+    uint64_t calls; ///< number of calls
+    uint64_t bytes; ///< number of bytes read by the calls
+} conv_endian_counter;
+
+/// @brief Counts of every operation and every kernel since the library was loaded
+typedef struct conv_endian_snapshot
+{
+    conv_endian_counter operations[CONV_ENDIAN_OPERATION_COUNT]; ///< counts per operation
+    conv_endian_counter kernels[CONV_ENDIAN_KERNEL_AVX512 + 1]; ///< counts per kernel in use at the time of the call
+} conv_endian_snapshot;
+
+/// @brief Checks whether the library was compiled with CONV_ENDIAN_INSTRUMENT
+/// @return 1 if the conversions are counted, 0 otherwise
+int conv_endian_instrumented(void);
+
+/// @brief Adds up the counts of all threads, including the threads that have exited
+/// @param snapshot snapshot that receives the counts
+void conv_endian_take_snapshot(conv_endian_snapshot* snapshot);
+
+/// @brief Gets the name of an operation
+/// @param operation operation to be named
+/// @return name of operation such as "bswap32"
+const char* conv_endian_operation_name(conv_endian_operation operation);
+
+#if defined(CONV_ENDIAN_HEADER_ONLY)
+#include "conv_endian.c"
+#endif
 
 #ifdef __cplusplus
 }
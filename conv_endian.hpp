@@ -0,0 +1,273 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian.hpp
+/// @brief A C++ header that contains types which store numbers in a fixed endianness
+
+
+#ifndef CONV_ENDIAN_HPP
+#define CONV_ENDIAN_HPP
+
+#include "conv_endian.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace conv_endian
+{
+
+/// @brief Byte order of a stored number
+enum class endian
+{
+    little,
+    big
+};
+
+namespace detail
+{
+
+/*
+
+    Converting the bits of a number between an endianness and the
+    endianness of the machine
+
+*/
+
+template <endian Order>
+struct order;
+
+template <>
+struct order<endian::little>
+{
+    static uint16_t convert(uint16_t bits) noexcept { return conv_endian_le16(bits); }
+    static uint32_t convert(uint32_t bits) noexcept { return conv_endian_le32(bits); }
+    static uint64_t convert(uint64_t bits) noexcept { return conv_endian_le64(bits); }
+};
+
+template <>
+struct order<endian::big>
+{
+    static uint16_t convert(uint16_t bits) noexcept { return conv_endian_be16(bits); }
+    static uint32_t convert(uint32_t bits) noexcept { return conv_endian_be32(bits); }
+    static uint64_t convert(uint64_t bits) noexcept { return conv_endian_be64(bits); }
+};
+
+/*
+
+    Reinterpreting numbers as unsigned integers of the same size
+
+*/
+
+template <std::size_t Size>
+struct unsigned_of;
+
+template <>
+struct unsigned_of<2>
+{
+    using type = uint16_t;
+};
+
+template <>
+struct unsigned_of<4>
+{
+    using type = uint32_t;
+};
+
+template <>
+struct unsigned_of<8>
+{
+    using type = uint64_t;
+};
+
+template <typename T, typename Enable = void>
+struct codec;
+
+template <typename T>
+struct codec<T, typename std::enable_if<std::is_integral<T>::value>::type>
+{
+    using bits = typename unsigned_of<sizeof(T)>::type;
+
+    static bits to_bits(T val) noexcept { return static_cast<bits>(val); }
+    static T from_bits(bits val) noexcept { return static_cast<T>(val); }
+};
+
+template <>
+struct codec<float>
+{
+    using bits = uint32_t;
+
+    static bits to_bits(float val) noexcept { return conv_endian_f32_bits(val); }
+    static float from_bits(bits val) noexcept { return conv_endian_bits_f32(val); }
+};
+
+template <>
+struct codec<double>
+{
+    using bits = uint64_t;
+
+    static bits to_bits(double val) noexcept { return conv_endian_f64_bits(val); }
+    static double from_bits(bits val) noexcept { return conv_endian_bits_f64(val); }
+};
+
+} // namespace detail
+
+/// @brief Loads a number of type T stored in Order from memory that does not have to be aligned
+/// @param ptr address of the number in Order
+/// @return value at ptr in their endianness of their machine
+template <typename T, endian Order>
+inline T load(const void* ptr) noexcept
+{
+    typename detail::codec<T>::bits bits;
+    std::memcpy(&bits, ptr, sizeof(bits));
+    return detail::codec<T>::from_bits(detail::order<Order>::convert(bits));
+}
+
+/// @brief Stores a number of type T in Order into memory that does not have to be aligned
+/// @param ptr address that receives the number in Order
+/// @param val value in their endianness of their machine
+template <typename T, endian Order>
+inline void store(void* ptr, T val) noexcept
+{
+    typename detail::codec<T>::bits bits = detail::order<Order>::convert(detail::codec<T>::to_bits(val));
+    std::memcpy(ptr, &bits, sizeof(bits));
+}
+
+/// @brief A number of type T that is stored in Order
+///
+/// It has the size of T and an alignment of 1, is trivially copyable and
+/// has no padding, so structs made of these types can be placed directly
+/// over received or memory mapped buffers. Reading converts the number
+/// into the endianness of the machine and assigning converts it back.
+template <typename T, endian Order>
+class endian_value
+{
+    static_assert(std::is_arithmetic<T>::value && sizeof(T) >= 2 && sizeof(T) <= 8,
+        "endian_value holds 16-bit, 32-bit and 64-bit integers and floating point numbers");
+
+public:
+    using value_type = T;
+
+    static constexpr endian order = Order;
+
+    endian_value() noexcept = default;
+
+    endian_value(T val) noexcept
+    {
+        store<T, Order>(bytes_, val);
+    }
+
+    endian_value& operator=(T val) noexcept
+    {
+        store<T, Order>(bytes_, val);
+        return *this;
+    }
+
+    operator T() const noexcept
+    {
+        return load<T, Order>(bytes_);
+    }
+
+    /// @brief Gets the number in their endianness of their machine
+    /// @return stored number
+    T value() const noexcept
+    {
+        return load<T, Order>(bytes_);
+    }
+
+    /// @brief Gets the stored bytes, which are in Order
+    /// @return address of the first byte
+    const unsigned char* data() const noexcept
+    {
+        return bytes_;
+    }
+
+    endian_value& operator+=(T rhs) noexcept { return *this = static_cast<T>(value() + rhs); }
+    endian_value& operator-=(T rhs) noexcept { return *this = static_cast<T>(value() - rhs); }
+    endian_value& operator*=(T rhs) noexcept { return *this = static_cast<T>(value() * rhs); }
+    endian_value& operator/=(T rhs) noexcept { return *this = static_cast<T>(value() / rhs); }
+    endian_value& operator%=(T rhs) noexcept { return *this = static_cast<T>(value() % rhs); }
+    endian_value& operator&=(T rhs) noexcept { return *this = static_cast<T>(value() & rhs); }
+    endian_value& operator|=(T rhs) noexcept { return *this = static_cast<T>(value() | rhs); }
+    endian_value& operator^=(T rhs) noexcept { return *this = static_cast<T>(value() ^ rhs); }
+    endian_value& operator<<=(int rhs) noexcept { return *this = static_cast<T>(value() << rhs); }
+    endian_value& operator>>=(int rhs) noexcept { return *this = static_cast<T>(value() >> rhs); }
+
+    endian_value& operator++() noexcept { return *this += T(1); }
+    endian_value& operator--() noexcept { return *this -= T(1); }
+
+    T operator++(int) noexcept
+    {
+        T old = value();
+        *this = static_cast<T>(old + T(1));
+        return old;
+    }
+
+    T operator--(int) noexcept
+    {
+        T old = value();
+        *this = static_cast<T>(old - T(1));
+        return old;
+    }
+
+private:
+    unsigned char bytes_[sizeof(T)];
+};
+
+template <typename T, endian Order>
+constexpr endian endian_value<T, Order>::order;
+
+/// @brief A number of type T that is stored in big endian
+template <typename T>
+using big_endian = endian_value<T, endian::big>;
+
+/// @brief A number of type T that is stored in little endian
+template <typename T>
+using little_endian = endian_value<T, endian::little>;
+
+using be_u16 = big_endian<uint16_t>;
+using be_s16 = big_endian<int16_t>;
+using be_u32 = big_endian<uint32_t>;
+using be_s32 = big_endian<int32_t>;
+using be_f32 = big_endian<float>;
+using be_u64 = big_endian<uint64_t>;
+using be_s64 = big_endian<int64_t>;
+using be_f64 = big_endian<double>;
+
+using le_u16 = little_endian<uint16_t>;
+using le_s16 = little_endian<int16_t>;
+using le_u32 = little_endian<uint32_t>;
+using le_s32 = little_endian<int32_t>;
+using le_f32 = little_endian<float>;
+using le_u64 = little_endian<uint64_t>;
+using le_s64 = little_endian<int64_t>;
+using le_f64 = little_endian<double>;
+
+static_assert(sizeof(be_u32) == 4 && alignof(be_u32) == 1, "endian_value must not add padding");
+static_assert(std::is_trivially_copyable<be_f64>::value, "endian_value must be trivially copyable");
+
+} // namespace conv_endian
+
+#endif
@@ -0,0 +1,454 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_bits.h
+/// @brief A C portable header that contains inline readers and writers of big endian bit fields
+
+
+#ifndef CONV_ENDIAN_BITS_H
+#define CONV_ENDIAN_BITS_H
+
+#include "conv_endian.h"
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/*
+
+    Bit streams
+
+    Fields are packed most significant bit first, the way MPEG transport
+    stream headers, H.264 NAL units and similar formats store them.
+
+    A bit reader keeps up to 64 bits of the stream in a cache whose next
+    bit is its highest bit. A refill tops the cache up with a single
+    unaligned big endian load and leaves at least 57 bits in it, unless
+    the end of the buffer is near, so after one refill several fields of
+    up to 57 bits in total can be taken with conv_endian_bits_peek and
+    conv_endian_bits_consume without any branch. conv_endian_bits_get
+    refills by itself when the cache runs low.
+
+        conv_endian_bit_reader br;
+        conv_endian_bit_reader_init(&br, ts_packet, 188);
+
+        sync = conv_endian_bits_get(&br, 8);
+        conv_endian_bits_refill(&br);
+        error = conv_endian_bits_take(&br, 1);
+        start = conv_endian_bits_take(&br, 1);
+        priority = conv_endian_bits_take(&br, 1);
+        pid = conv_endian_bits_take(&br, 13);
+
+    Reading past the end of the buffer reads zero bits and sets a sticky
+    error flag. A bit writer works the other way round, and writes whole
+    bytes out of its cache with a single big endian store.
+
+    Everything here is inline and only uses the inline helpers of
+    conv_endian.h, so it does not depend on CONV_ENDIAN_HEADER_ONLY.
+
+*/
+
+/// @brief Most bits that can be taken at a time
+#define CONV_ENDIAN_BITS_MAX 57
+
+/// @brief A reader of big endian bit fields
+typedef struct conv_endian_bit_reader
+{
+    const unsigned char* data; ///< first byte of the buffer
+    size_t size; ///< number of bytes in the buffer
+    size_t pos; ///< offset of the next byte to be loaded into the cache
+    uint64_t cache; ///< next bits of the stream, starting at the highest bit, followed by zeros
+    unsigned bits; ///< number of bits of the stream in the cache
+    int error; ///< set when a read went past the end of the buffer, and stays set
+} conv_endian_bit_reader;
+
+/// @brief A writer of big endian bit fields
+typedef struct conv_endian_bit_writer
+{
+    unsigned char* data; ///< first byte of the buffer
+    size_t size; ///< number of bytes in the buffer
+    size_t pos; ///< offset of the next byte to be stored from the cache
+    uint64_t cache; ///< bits that have not been stored yet, starting at the highest bit
+    unsigned bits; ///< number of bits in the cache
+    int error; ///< set when a write did not fit in the buffer, and stays set
+} conv_endian_bit_writer;
+
+/// @brief Counts the zero bits above the highest set bit of a number
+/// @param val number that is not 0
+/// @return number of leading zero bits
+static CONV_ENDIAN_INLINE unsigned conv_endian_clz64(uint64_t val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_clzll(val);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, val);
+    return 63 - (unsigned)index;
+#else
+    unsigned count = 0;
+
+    while ((val & 0x8000000000000000) == 0)
+    {
+        val <<= 1;
+        count++;
+    }
+
+    return count;
+#endif
+}
+
+/*
+
+    Reading
+
+*/
+
+/// @brief Starts a bit reader at the first bit of a buffer
+/// @param reader reader to be started
+/// @param data buffer to be read
+/// @param size number of bytes in data
+static CONV_ENDIAN_INLINE void conv_endian_bit_reader_init(conv_endian_bit_reader* reader, const void* data, size_t size)
+{
+    reader->data = (const unsigned char*)data;
+    reader->size = size;
+    reader->pos = 0;
+    reader->cache = 0;
+    reader->bits = 0;
+    reader->error = 0;
+}
+
+/// @brief Fills the cache of a bit reader with at least 57 bits, or with every bit left in the buffer
+/// @param reader reader
+static CONV_ENDIAN_INLINE void conv_endian_bits_refill(conv_endian_bit_reader* reader)
+{
+    if (reader->size - reader->pos >= 8)
+    {
+        uint64_t next;
+        unsigned bytes = (64 - reader->bits) >> 3;
+
+        // the bits below the whole bytes that are counted are loaded
+        // again by the next refill, which ORs the same bits in, and the
+        // shift is split in two so a full cache shifts by 64 safely
+        memcpy(&next, reader->data + reader->pos, sizeof(next));
+        next = conv_endian_be64(next) >> (reader->bits >> 1);
+        reader->cache |= next >> (reader->bits - (reader->bits >> 1));
+        reader->pos += bytes;
+        reader->bits += bytes << 3;
+    }
+    else
+    {
+        while (reader->bits <= 56 && reader->pos < reader->size)
+        {
+            reader->cache |= (uint64_t)reader->data[reader->pos++] << (56 - reader->bits);
+            reader->bits += 8;
+        }
+    }
+}
+
+/// @brief Looks at the next bits of a bit reader without taking them
+/// @param reader reader, refilled since at least count bits were taken
+/// @param count number of bits, from 1 to 57
+/// @return next count bits, bits past the end of the buffer are read as 0
+static CONV_ENDIAN_INLINE uint64_t conv_endian_bits_peek(const conv_endian_bit_reader* reader, unsigned count)
+{
+    return reader->cache >> (64 - count);
+}
+
+/// @brief Takes bits of a bit reader that have been looked at
+/// @param reader reader, refilled since at least count bits were taken
+/// @param count number of bits, from 1 to 57
+static CONV_ENDIAN_INLINE void conv_endian_bits_consume(conv_endian_bit_reader* reader, unsigned count)
+{
+    reader->error |= count > reader->bits;
+    reader->bits = count > reader->bits ? 0 : reader->bits - count;
+    reader->cache <<= count;
+}
+
+/// @brief Takes the next bits of a bit reader without refilling it
+/// @param reader reader, refilled since at least count bits were taken
+/// @param count number of bits, from 1 to 57
+/// @return next count bits, bits past the end of the buffer are read as 0
+static CONV_ENDIAN_INLINE uint64_t conv_endian_bits_take(conv_endian_bit_reader* reader, unsigned count)
+{
+    uint64_t val = conv_endian_bits_peek(reader, count);
+    conv_endian_bits_consume(reader, count);
+    return val;
+}
+
+/// @brief Reads the next bits of a bit reader, refilling it when needed
+/// @param reader reader
+/// @param count number of bits, from 1 to 57
+/// @return next count bits, bits past the end of the buffer are read as 0
+static CONV_ENDIAN_INLINE uint64_t conv_endian_bits_get(conv_endian_bit_reader* reader, unsigned count)
+{
+    if (reader->bits < count)
+        conv_endian_bits_refill(reader);
+
+    return conv_endian_bits_take(reader, count);
+}
+
+/// @brief Reads one bit of a bit reader
+/// @param reader reader
+/// @return next bit
+static CONV_ENDIAN_INLINE unsigned conv_endian_bits_get_flag(conv_endian_bit_reader* reader)
+{
+    return (unsigned)conv_endian_bits_get(reader, 1);
+}
+
+/// @brief Skips bits of a bit reader
+/// @param reader reader
+/// @param count number of bits to be skipped, may be larger than 57
+static CONV_ENDIAN_INLINE void conv_endian_bits_skip(conv_endian_bit_reader* reader, size_t count)
+{
+    // whole bytes beyond the cache are skipped without loading them
+    if (count > reader->bits + 64)
+    {
+        size_t bytes = (count - reader->bits) >> 3;
+
+        count -= reader->bits + (bytes << 3);
+        reader->cache = 0;
+        reader->bits = 0;
+
+        if (bytes > reader->size - reader->pos)
+        {
+            reader->pos = reader->size;
+            reader->error = 1;
+            return;
+        }
+
+        reader->pos += bytes;
+    }
+
+    while (count > 0)
+    {
+        unsigned step = count > CONV_ENDIAN_BITS_MAX ? CONV_ENDIAN_BITS_MAX : (unsigned)count;
+        conv_endian_bits_get(reader, step);
+        count -= step;
+    }
+}
+
+/// @brief Skips the bits up to the next byte boundary of a bit reader
+/// @param reader reader
+static CONV_ENDIAN_INLINE void conv_endian_bits_align(conv_endian_bit_reader* reader)
+{
+    // every byte of the cache is whole, so the bits left over from the
+    // last byte that was started are the number of bits modulo 8
+    unsigned partial = reader->bits & 7;
+
+    if (partial != 0)
+        conv_endian_bits_consume(reader, partial);
+}
+
+/// @brief Gets the number of bits a bit reader has read
+/// @param reader reader
+/// @return offset in bits of the next bit from the beginning of the buffer
+static CONV_ENDIAN_INLINE size_t conv_endian_bit_reader_position(const conv_endian_bit_reader* reader)
+{
+    return reader->pos * 8 - reader->bits;
+}
+
+/// @brief Checks whether a bit reader has read past the end of its buffer
+/// @param reader reader
+/// @return 1 if a read went past the end of the buffer, 0 otherwise
+static CONV_ENDIAN_INLINE int conv_endian_bit_reader_failed(const conv_endian_bit_reader* reader)
+{
+    return reader->error;
+}
+
+/// @brief Reads an unsigned Exp-Golomb code, ue(v) in H.264
+/// @param reader reader
+/// @return decoded number, or 0 after setting the error flag if the code does not fit in 32 bits
+static CONV_ENDIAN_INLINE uint32_t conv_endian_bits_get_ue(conv_endian_bit_reader* reader)
+{
+    unsigned zeros;
+
+    if (reader->bits < 33)
+        conv_endian_bits_refill(reader);
+
+    // a cache of zeros counts as more zeros than a code can have
+    zeros = conv_endian_clz64(reader->cache | 1);
+
+    if (zeros > 31)
+    {
+        reader->error = 1;
+        return 0;
+    }
+
+    conv_endian_bits_consume(reader, zeros);
+    return (uint32_t)(conv_endian_bits_get(reader, zeros + 1) - 1);
+}
+
+/// @brief Reads a signed Exp-Golomb code, se(v) in H.264
+/// @param reader reader
+/// @return decoded number, or 0 after setting the error flag if the code does not fit in 32 bits
+static CONV_ENDIAN_INLINE int32_t conv_endian_bits_get_se(conv_endian_bit_reader* reader)
+{
+    uint32_t code = conv_endian_bits_get_ue(reader);
+
+    // 1, 2, 3, 4... map to 1, -1, 2, -2...
+    if (code & 1)
+        return (int32_t)((code >> 1) + 1);
+
+    return -(int32_t)(code >> 1);
+}
+
+/*
+
+    Writing
+
+*/
+
+/// @brief Starts a bit writer at the first bit of a buffer
+/// @param writer writer to be started
+/// @param data buffer to be written
+/// @param size number of bytes in data
+static CONV_ENDIAN_INLINE void conv_endian_bit_writer_init(conv_endian_bit_writer* writer, void* data, size_t size)
+{
+    writer->data = (unsigned char*)data;
+    writer->size = size;
+    writer->pos = 0;
+    writer->cache = 0;
+    writer->bits = 0;
+    writer->error = 0;
+}
+
+/// @brief Stores the whole bytes of the cache of a bit writer into its buffer
+/// @param writer writer
+static CONV_ENDIAN_INLINE void conv_endian_bit_writer_drain(conv_endian_bit_writer* writer)
+{
+    unsigned bytes = writer->bits >> 3;
+
+    if (writer->size - writer->pos >= 8)
+    {
+        // the bytes after the whole ones are stored again by the next drain
+        uint64_t out = conv_endian_be64(writer->cache);
+        memcpy(writer->data + writer->pos, &out, sizeof(out));
+    }
+    else if (bytes > writer->size - writer->pos)
+    {
+        writer->error = 1;
+        writer->cache = 0;
+        writer->bits = 0;
+        return;
+    }
+    else
+    {
+        unsigned i;
+
+        for (i = 0; i < bytes; i++)
+            writer->data[writer->pos + i] = (unsigned char)(writer->cache >> (56 - i * 8));
+    }
+
+    writer->pos += bytes;
+    writer->cache = bytes == 8 ? 0 : writer->cache << (bytes << 3);
+    writer->bits &= 7;
+}
+
+/// @brief Writes bits into a bit writer
+/// @param writer writer
+/// @param val number whose lowest count bits are written
+/// @param count number of bits, from 1 to 57
+static CONV_ENDIAN_INLINE void conv_endian_bits_put(conv_endian_bit_writer* writer, uint64_t val, unsigned count)
+{
+    if (writer->bits + count > 64)
+        conv_endian_bit_writer_drain(writer);
+
+    writer->cache |= (val & (((uint64_t)1 << count) - 1)) << (64 - writer->bits - count);
+    writer->bits += count;
+}
+
+/// @brief Writes one bit into a bit writer
+/// @param writer writer
+/// @param flag bit to be written, any value other than 0 writes a 1
+static CONV_ENDIAN_INLINE void conv_endian_bits_put_flag(conv_endian_bit_writer* writer, unsigned flag)
+{
+    conv_endian_bits_put(writer, flag != 0, 1);
+}
+
+/// @brief Writes an unsigned Exp-Golomb code, ue(v) in H.264
+/// @param writer writer
+/// @param val number to be written, at most 4294967294
+static CONV_ENDIAN_INLINE void conv_endian_bits_put_ue(conv_endian_bit_writer* writer, uint32_t val)
+{
+    uint64_t code = (uint64_t)val + 1;
+    unsigned length = 64 - conv_endian_clz64(code);
+
+    if (length > 1)
+        conv_endian_bits_put(writer, 0, length - 1);
+
+    conv_endian_bits_put(writer, code, length);
+}
+
+/// @brief Writes a signed Exp-Golomb code, se(v) in H.264
+/// @param writer writer
+/// @param val number to be written, from -2147483647 to 2147483647
+static CONV_ENDIAN_INLINE void conv_endian_bits_put_se(conv_endian_bit_writer* writer, int32_t val)
+{
+    conv_endian_bits_put_ue(writer, val > 0 ? (uint32_t)val * 2 - 1 : (uint32_t)0 - (uint32_t)val * 2);
+}
+
+/// @brief Writes zero bits up to the next byte boundary of a bit writer
+/// @param writer writer
+static CONV_ENDIAN_INLINE void conv_endian_bits_pad(conv_endian_bit_writer* writer)
+{
+    unsigned partial = writer->bits & 7;
+
+    if (partial != 0)
+        conv_endian_bits_put(writer, 0, 8 - partial);
+}
+
+/// @brief Pads a bit writer to a byte boundary and stores everything it has written
+/// @param writer writer
+/// @return number of bytes written into the buffer, or 0 if the bits did not fit in it
+static CONV_ENDIAN_INLINE size_t conv_endian_bit_writer_finish(conv_endian_bit_writer* writer)
+{
+    conv_endian_bits_pad(writer);
+    conv_endian_bit_writer_drain(writer);
+
+    return writer->error ? 0 : writer->pos;
+}
+
+/// @brief Checks whether a write of a bit writer has failed
+/// @param writer writer
+/// @return 1 if a write did not fit in the buffer, 0 otherwise
+static CONV_ENDIAN_INLINE int conv_endian_bit_writer_failed(const conv_endian_bit_writer* writer)
+{
+    return writer->error;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1456 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_bulk.c
+/// @brief A C portable source code that contains implementation of functions for converting arrays between endianness
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CONV_ENDIAN_X86) && !defined(_MSC_VER)
+#include <cpuid.h>
+#elif defined(CONV_ENDIAN_X86)
+#include <intrin.h>
+#endif
+
+/*
+
+    Scalar kernels
+
+    These handle the machines without a vector kernel and the elements
+    left over after a vector kernel. They are plain C, but swap a whole
+    64-bit word at a time: four 16-bit values by moving the odd bytes down
+    and the even bytes up with masks, or two 32-bit values by reversing the
+    word and rotating the values back into their places. Only the elements
+    after the last whole word are swapped one at a time
+
+*/
+
+static uint64_t swar_bswap16x4(uint64_t val)
+{
+    return ((val & 0x00FF00FF00FF00FFull) << 8) | ((val >> 8) & 0x00FF00FF00FF00FFull);
+}
+
+static uint64_t swar_bswap32x2(uint64_t val)
+{
+    val = conv_endian_bswap64(val);
+    return (val << 32) | (val >> 32);
+}
+
+static void bswap16_scalar(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    size_t i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        uint64_t val;
+        memcpy(&val, src + i * 2, sizeof(val));
+        val = swar_bswap16x4(val);
+        memcpy(dst + i * 2, &val, sizeof(val));
+    }
+
+    for (; i < count; i++)
+    {
+        uint16_t val;
+        memcpy(&val, src + i * 2, sizeof(val));
+        val = conv_endian_bswap16(val);
+        memcpy(dst + i * 2, &val, sizeof(val));
+    }
+}
+
+static void bswap32_scalar(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    size_t i;
+
+    for (i = 0; i + 2 <= count; i += 2)
+    {
+        uint64_t val;
+        memcpy(&val, src + i * 4, sizeof(val));
+        val = swar_bswap32x2(val);
+        memcpy(dst + i * 4, &val, sizeof(val));
+    }
+
+    for (; i < count; i++)
+    {
+        uint32_t val;
+        memcpy(&val, src + i * 4, sizeof(val));
+        val = conv_endian_bswap32(val);
+        memcpy(dst + i * 4, &val, sizeof(val));
+    }
+}
+
+static void bswap64_scalar(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint64_t val;
+        memcpy(&val, src + i * 8, sizeof(val));
+        val = conv_endian_bswap64(val);
+        memcpy(dst + i * 8, &val, sizeof(val));
+    }
+}
+
+/*
+
+    Vector kernels
+
+    Each kernel shuffles whole registers with a byte mask and returns the
+    number of bytes it has converted so that the caller can finish the
+    remaining elements with a scalar kernel
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t bswap_ssse3(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width)
+{
+    __m128i mask;
+    size_t i = 0;
+
+    if (width == 2)
+        mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    else if (width == 4)
+        mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    else
+        mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    for (; i + 32 <= bytes; i += 32)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(src + i + 16));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(a, mask));
+        _mm_storeu_si128((__m128i*)(dst + i + 16), _mm_shuffle_epi8(b, mask));
+    }
+
+    for (; i + 16 <= bytes; i += 16)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(a, mask));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t bswap_avx2(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width)
+{
+    __m256i mask;
+    size_t i = 0;
+
+    if (width == 2)
+        mask = _mm256_setr_epi8(
+            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    else if (width == 4)
+        mask = _mm256_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    else
+        mask = _mm256_setr_epi8(
+            7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+            7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    for (; i + 64 <= bytes; i += 64)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + i + 32));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_shuffle_epi8(a, mask));
+        _mm256_storeu_si256((__m256i*)(dst + i + 32), _mm256_shuffle_epi8(b, mask));
+    }
+
+    for (; i + 32 <= bytes; i += 32)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_shuffle_epi8(a, mask));
+    }
+
+    return i;
+}
+
+// the last partial register is converted with masked loads and stores
+// so there is nothing left over for a scalar kernel
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t bswap_avx512(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width)
+{
+    __m512i mask;
+    size_t i = 0;
+
+    if (width == 2)
+        mask = _mm512_broadcast_i32x4(_mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    else if (width == 4)
+        mask = _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    else
+        mask = _mm512_broadcast_i32x4(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    for (; i + 128 <= bytes; i += 128)
+    {
+        __m512i a = _mm512_loadu_si512((const void*)(src + i));
+        __m512i b = _mm512_loadu_si512((const void*)(src + i + 64));
+        _mm512_storeu_si512((void*)(dst + i), _mm512_shuffle_epi8(a, mask));
+        _mm512_storeu_si512((void*)(dst + i + 64), _mm512_shuffle_epi8(b, mask));
+    }
+
+    for (; i + 64 <= bytes; i += 64)
+    {
+        __m512i a = _mm512_loadu_si512((const void*)(src + i));
+        _mm512_storeu_si512((void*)(dst + i), _mm512_shuffle_epi8(a, mask));
+    }
+
+    if (i < bytes)
+    {
+        __mmask64 tail = (__mmask64)(~0ull >> (64 - (bytes - i)));
+        __m512i a = _mm512_maskz_loadu_epi8(tail, (const void*)(src + i));
+        _mm512_mask_storeu_epi8((void*)(dst + i), tail, _mm512_shuffle_epi8(a, mask));
+        i = bytes;
+    }
+
+    return i;
+}
+
+/*
+
+    Streaming kernels
+
+    These write whole registers with non-temporal stores, which go to
+    memory without first reading the destination into the cache, and
+    prefetch the source ahead of the loads. The destination is aligned to
+    a register with one ordinary store first, so nothing is converted when
+    it cannot be aligned on an element boundary. The caller converts the
+    bytes left over with the ordinary kernels.
+
+*/
+
+#define STREAM_PREFETCH_DISTANCE 1024
+
+static size_t stream_head(const unsigned char* dst, size_t width, size_t alignment)
+{
+    size_t head = (alignment - ((uintptr_t)dst & (alignment - 1))) & (alignment - 1);
+
+    return head % width == 0 ? head : (size_t)-1;
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t stream_ssse3(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width)
+{
+    __m128i mask;
+    size_t i = stream_head(dst, width, 16);
+
+    if (i == (size_t)-1 || bytes < i + 64)
+        return 0;
+
+    if (width == 2)
+        mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    else if (width == 4)
+        mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    else
+        mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    if (i != 0)
+        _mm_storeu_si128((__m128i*)dst, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src), mask));
+
+    for (; i + 64 <= bytes; i += 64)
+    {
+        __m128i a, b, c, d;
+
+        _mm_prefetch((const char*)(src + i + STREAM_PREFETCH_DISTANCE), _MM_HINT_NTA);
+        a = _mm_loadu_si128((const __m128i*)(src + i));
+        b = _mm_loadu_si128((const __m128i*)(src + i + 16));
+        c = _mm_loadu_si128((const __m128i*)(src + i + 32));
+        d = _mm_loadu_si128((const __m128i*)(src + i + 48));
+        _mm_stream_si128((__m128i*)(dst + i), _mm_shuffle_epi8(a, mask));
+        _mm_stream_si128((__m128i*)(dst + i + 16), _mm_shuffle_epi8(b, mask));
+        _mm_stream_si128((__m128i*)(dst + i + 32), _mm_shuffle_epi8(c, mask));
+        _mm_stream_si128((__m128i*)(dst + i + 48), _mm_shuffle_epi8(d, mask));
+    }
+
+    _mm_sfence();
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t stream_avx2(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width)
+{
+    __m256i mask;
+    size_t i = stream_head(dst, width, 32);
+
+    if (i == (size_t)-1 || bytes < i + 64)
+        return 0;
+
+    if (width == 2)
+        mask = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    else if (width == 4)
+        mask = _mm256_broadcastsi128_si256(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    else
+        mask = _mm256_broadcastsi128_si256(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    if (i != 0)
+        _mm256_storeu_si256((__m256i*)dst, _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)src), mask));
+
+    for (; i + 64 <= bytes; i += 64)
+    {
+        __m256i a, b;
+
+        _mm_prefetch((const char*)(src + i + STREAM_PREFETCH_DISTANCE), _MM_HINT_NTA);
+        a = _mm256_loadu_si256((const __m256i*)(src + i));
+        b = _mm256_loadu_si256((const __m256i*)(src + i + 32));
+        _mm256_stream_si256((__m256i*)(dst + i), _mm256_shuffle_epi8(a, mask));
+        _mm256_stream_si256((__m256i*)(dst + i + 32), _mm256_shuffle_epi8(b, mask));
+    }
+
+    _mm_sfence();
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t stream_avx512(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width)
+{
+    __m512i mask;
+    size_t i = stream_head(dst, width, 64);
+
+    if (i == (size_t)-1 || bytes < i + 64)
+        return 0;
+
+    if (width == 2)
+        mask = _mm512_broadcast_i32x4(_mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    else if (width == 4)
+        mask = _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    else
+        mask = _mm512_broadcast_i32x4(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    if (i != 0)
+        _mm512_storeu_si512((void*)dst, _mm512_shuffle_epi8(_mm512_loadu_si512((const void*)src), mask));
+
+    for (; i + 64 <= bytes; i += 64)
+    {
+        _mm_prefetch((const char*)(src + i + STREAM_PREFETCH_DISTANCE), _MM_HINT_NTA);
+        _mm512_stream_si512((void*)(dst + i), _mm512_shuffle_epi8(_mm512_loadu_si512((const void*)(src + i)), mask));
+    }
+
+    _mm_sfence();
+    return i;
+}
+
+/*
+
+    Record permutation kernels
+
+    masks holds one shuffle mask byte for every byte of a period, a number
+    of bytes that is a multiple of both the record size and 64, so every
+    register width starts each period at the same mask. The kernels only
+    convert whole periods so that they always stop at the end of a record
+
+*/
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t permute_ssse3(unsigned char* dst, const unsigned char* src, size_t bytes, const unsigned char* masks, size_t period)
+{
+    size_t end = bytes - bytes % period;
+    size_t i, k = 0;
+
+    for (i = 0; i < end; i += 16)
+    {
+        __m128i mask = _mm_loadu_si128((const __m128i*)(masks + k));
+        __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(a, mask));
+
+        k += 16;
+        if (k == period)
+            k = 0;
+    }
+
+    return end;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t permute_avx2(unsigned char* dst, const unsigned char* src, size_t bytes, const unsigned char* masks, size_t period)
+{
+    size_t end = bytes - bytes % period;
+    size_t i, k = 0;
+
+    for (i = 0; i < end; i += 32)
+    {
+        __m256i mask = _mm256_loadu_si256((const __m256i*)(masks + k));
+        __m256i a = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_shuffle_epi8(a, mask));
+
+        k += 32;
+        if (k == period)
+            k = 0;
+    }
+
+    return end;
+}
+
+// the last partial register is converted with masked loads and stores,
+// which is safe because every byte stays inside its own record
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t permute_avx512(unsigned char* dst, const unsigned char* src, size_t bytes, const unsigned char* masks, size_t period)
+{
+    size_t i, k = 0;
+
+    for (i = 0; i + 64 <= bytes; i += 64)
+    {
+        __m512i mask = _mm512_loadu_si512((const void*)(masks + k));
+        __m512i a = _mm512_loadu_si512((const void*)(src + i));
+        _mm512_storeu_si512((void*)(dst + i), _mm512_shuffle_epi8(a, mask));
+
+        k += 64;
+        if (k == period)
+            k = 0;
+    }
+
+    if (i < bytes)
+    {
+        __mmask64 tail = (__mmask64)(~0ull >> (64 - (bytes - i)));
+        __m512i mask = _mm512_loadu_si512((const void*)(masks + k));
+        __m512i a = _mm512_maskz_loadu_epi8(tail, (const void*)(src + i));
+        _mm512_mask_storeu_epi8((void*)(dst + i), tail, _mm512_shuffle_epi8(a, mask));
+        i = bytes;
+    }
+
+    return i;
+}
+
+#endif
+
+static size_t bswap_none(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width)
+{
+    (void)dst;
+    (void)src;
+    (void)bytes;
+    (void)width;
+
+    return 0;
+}
+
+static size_t permute_none(unsigned char* dst, const unsigned char* src, size_t bytes, const unsigned char* masks, size_t period)
+{
+    (void)dst;
+    (void)src;
+    (void)bytes;
+    (void)masks;
+    (void)period;
+
+    return 0;
+}
+
+/*
+
+    Kernel selection
+
+    The processor is checked once, when the library is loaded on compilers
+    that support constructors or on the first bulk conversion otherwise, and
+    the best kernel it supports is used from then on unless another kernel is
+    chosen with conv_endian_set_kernel
+
+*/
+
+typedef size_t (*bswap_kernel)(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width);
+
+typedef size_t (*permute_kernel)(unsigned char* dst, const unsigned char* src, size_t bytes, const unsigned char* masks, size_t period);
+
+static bswap_kernel bswap_vector = bswap_none;
+static bswap_kernel bswap_stream = bswap_none;
+static permute_kernel permute_vector = permute_none;
+static conv_endian_kernel best_kernel = CONV_ENDIAN_KERNEL_SCALAR;
+static conv_endian_kernel current_kernel = CONV_ENDIAN_KERNEL_SCALAR;
+static size_t stream_threshold = CONV_ENDIAN_STREAM_THRESHOLD;
+static volatile int kernels_resolved = 0;
+#if defined(CONV_ENDIAN_X86)
+static int crc32c_supported = 0;
+static int sse42_supported = 0;
+#endif
+
+#if defined(CONV_ENDIAN_X86)
+
+static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    regs[0] = (uint32_t)info[0];
+    regs[1] = (uint32_t)info[1];
+    regs[2] = (uint32_t)info[2];
+    regs[3] = (uint32_t)info[3];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t xgetbv(void)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+
+static conv_endian_kernel detect_kernel(void)
+{
+    uint32_t regs[4];
+    uint32_t max_leaf;
+    uint64_t xcr0 = 0;
+    int ssse3, f16c, avx, avx2 = 0, avx512 = 0;
+
+    cpuid(0, 0, regs);
+    max_leaf = regs[0];
+
+    cpuid(1, 0, regs);
+    ssse3 = (regs[2] >> 9) & 1;
+    f16c = (regs[2] >> 29) & 1;
+
+    // CRC32C and the other SSE4.1 and SSE4.2 instructions are checked on
+    // their own so that SSSE3 processors without them still swap bytes
+    // with shuffles
+    crc32c_supported = (regs[2] >> 20) & 1;
+    sse42_supported = ((regs[2] >> 19) & 1) && ((regs[2] >> 20) & 1);
+
+    // the operating system has to save the vector registers too
+    if ((regs[2] >> 27) & 1)
+        xcr0 = xgetbv();
+    avx = ((regs[2] >> 28) & 1) && (xcr0 & 0x06) == 0x06;
+
+    if (max_leaf >= 7)
+    {
+        cpuid(7, 0, regs);
+        avx2 = ssse3 && avx && f16c && ((regs[1] >> 5) & 1);
+        avx512 = avx2 && ((regs[1] >> 16) & 1) && ((regs[1] >> 30) & 1) && (xcr0 & 0xE6) == 0xE6;
+    }
+
+    if (avx512)
+        return CONV_ENDIAN_KERNEL_AVX512;
+    if (avx2)
+        return CONV_ENDIAN_KERNEL_AVX2;
+    if (ssse3)
+        return CONV_ENDIAN_KERNEL_SSSE3;
+    return CONV_ENDIAN_KERNEL_SCALAR;
+}
+
+// the size of the largest data cache, or 0 if the processor does not
+// describe its caches
+static size_t detect_cache_size(void)
+{
+    uint32_t regs[4];
+    uint32_t leaf = 4;
+    size_t largest = 0;
+    uint32_t i;
+
+    cpuid(0, 0, regs);
+
+    // AMD processors describe their caches with another leaf
+    if (regs[1] == 0x68747541)
+    {
+        leaf = 0x8000001D;
+        cpuid(0x80000000, 0, regs);
+        if (regs[0] < leaf)
+            return 0;
+    }
+    else if (regs[0] < leaf)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < 16; i++)
+    {
+        size_t size;
+
+        cpuid(leaf, i, regs);
+
+        if ((regs[0] & 0x1F) == 0)
+            break;
+        if ((regs[0] & 0x1F) == 2)
+            continue;
+
+        size = (size_t)((regs[1] >> 22) + 1) * (((regs[1] >> 12) & 0x3FF) + 1) * ((regs[1] & 0xFFF) + 1) * ((size_t)regs[2] + 1);
+        if (size > largest)
+            largest = size;
+    }
+
+    return largest;
+}
+
+#else
+
+static conv_endian_kernel detect_kernel(void)
+{
+    return CONV_ENDIAN_KERNEL_SCALAR;
+}
+
+static size_t detect_cache_size(void)
+{
+    return 0;
+}
+
+#endif
+
+static void bind_kernel(conv_endian_kernel kernel)
+{
+    switch (kernel)
+    {
+#if defined(CONV_ENDIAN_X86)
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        bswap_vector = bswap_ssse3;
+        bswap_stream = stream_ssse3;
+        permute_vector = permute_ssse3;
+        break;
+    case CONV_ENDIAN_KERNEL_AVX2:
+        bswap_vector = bswap_avx2;
+        bswap_stream = stream_avx2;
+        permute_vector = permute_avx2;
+        break;
+    case CONV_ENDIAN_KERNEL_AVX512:
+        bswap_vector = bswap_avx512;
+        bswap_stream = stream_avx512;
+        permute_vector = permute_avx512;
+        break;
+#endif
+    default:
+        bswap_vector = bswap_none;
+        bswap_stream = bswap_none;
+        permute_vector = permute_none;
+        break;
+    }
+
+    current_kernel = kernel;
+}
+
+static void resolve_kernels(void)
+{
+    size_t cache_size;
+
+    if (kernels_resolved)
+        return;
+
+    cache_size = detect_cache_size();
+    if (cache_size != 0)
+        stream_threshold = cache_size;
+
+    best_kernel = detect_kernel();
+    bind_kernel(best_kernel);
+    kernels_resolved = 1;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+static void resolve_kernels_on_load(void)
+{
+    resolve_kernels();
+}
+#endif
+
+#if defined(CONV_ENDIAN_X86)
+
+/// @brief Checks whether the processor has the CRC32 instruction of SSE4.2
+/// @return 1 if it has, 0 otherwise
+int conv_endian_has_crc32c(void)
+{
+    resolve_kernels();
+    return crc32c_supported;
+}
+
+/// @brief Checks whether the processor has SSE4.1 and SSE4.2
+/// @return 1 if it has, 0 otherwise
+int conv_endian_has_sse42(void)
+{
+    resolve_kernels();
+    return sse42_supported;
+}
+
+#endif
+
+/// @brief Gets the fastest kernel that the processor supports
+/// @return fastest supported kernel
+conv_endian_kernel conv_endian_best_kernel(void)
+{
+    resolve_kernels();
+    return best_kernel;
+}
+
+/// @brief Gets the kernel that the bulk conversions currently use
+/// @return kernel in use
+conv_endian_kernel conv_endian_get_kernel(void)
+{
+    resolve_kernels();
+    return current_kernel;
+}
+
+/// @brief Forces the bulk conversions to use a kernel
+/// @param kernel kernel to be used
+/// @return 0 on success or -1 if the processor or the build does not support kernel
+int conv_endian_set_kernel(conv_endian_kernel kernel)
+{
+    resolve_kernels();
+
+    if (kernel < CONV_ENDIAN_KERNEL_SCALAR || kernel > best_kernel)
+        return -1;
+
+    bind_kernel(kernel);
+    return 0;
+}
+
+/// @brief Gets the name of a kernel
+/// @param kernel kernel to be named
+/// @return name of kernel
+const char* conv_endian_kernel_name(conv_endian_kernel kernel)
+{
+    switch (kernel)
+    {
+    case CONV_ENDIAN_KERNEL_SCALAR:
+        return "scalar";
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        return "ssse3";
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return "avx2";
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return "avx512";
+    default:
+        return "unknown";
+    }
+}
+
+/*
+
+    Bulk byte swapping
+
+*/
+
+static void bswap_array(void* dst, const void* src, size_t count, size_t width, int stream)
+{
+    unsigned char* dst_bytes = (unsigned char*)dst;
+    const unsigned char* src_bytes = (const unsigned char*)src;
+    size_t bytes = count * width;
+    conv_endian_operation operation = width == 2 ? CONV_ENDIAN_OPERATION_BSWAP16 : width == 4 ? CONV_ENDIAN_OPERATION_BSWAP32 : CONV_ENDIAN_OPERATION_BSWAP64;
+    size_t done = 0;
+
+    resolve_kernels();
+    CONV_ENDIAN_TRACE_BEGIN(operation, bytes);
+
+    // streaming only pays off when the destination is not read anyway
+    if (dst_bytes != src_bytes && (stream || bytes >= stream_threshold))
+        done = bswap_stream(dst_bytes, src_bytes, bytes, width);
+
+    done += bswap_vector(dst_bytes + done, src_bytes + done, bytes - done, width);
+
+    if (width == 2)
+        bswap16_scalar(dst_bytes + done, src_bytes + done, (bytes - done) / 2);
+    else if (width == 4)
+        bswap32_scalar(dst_bytes + done, src_bytes + done, (bytes - done) / 4);
+    else
+        bswap64_scalar(dst_bytes + done, src_bytes + done, (bytes - done) / 8);
+
+    CONV_ENDIAN_TRACE_END(operation, bytes);
+}
+
+/// @brief Reverses the bytes of every 16-bit value in an array
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+void conv_endian_bswap16_array(void* dst, const void* src, size_t count)
+{
+    bswap_array(dst, src, count, 2, 0);
+}
+
+/// @brief Reverses the bytes of every 32-bit value in an array
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+void conv_endian_bswap32_array(void* dst, const void* src, size_t count)
+{
+    bswap_array(dst, src, count, 4, 0);
+}
+
+/// @brief Reverses the bytes of every 64-bit value in an array
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+void conv_endian_bswap64_array(void* dst, const void* src, size_t count)
+{
+    bswap_array(dst, src, count, 8, 0);
+}
+
+/// @brief Reverses the bytes of every 16-bit value in an array with non-temporal stores whatever its size
+/// @param dst array that receives the byte swapped values, converted like conv_endian_bswap16_array when it is the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+void conv_endian_bswap16_array_stream(void* dst, const void* src, size_t count)
+{
+    bswap_array(dst, src, count, 2, 1);
+}
+
+/// @brief Reverses the bytes of every 32-bit value in an array with non-temporal stores whatever its size
+/// @param dst array that receives the byte swapped values, converted like conv_endian_bswap32_array when it is the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+void conv_endian_bswap32_array_stream(void* dst, const void* src, size_t count)
+{
+    bswap_array(dst, src, count, 4, 1);
+}
+
+/// @brief Reverses the bytes of every 64-bit value in an array with non-temporal stores whatever its size
+/// @param dst array that receives the byte swapped values, converted like conv_endian_bswap64_array when it is the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+void conv_endian_bswap64_array_stream(void* dst, const void* src, size_t count)
+{
+    bswap_array(dst, src, count, 8, 1);
+}
+
+/// @brief Sets the number of bytes from which out of place bulk conversions use non-temporal stores
+/// @param bytes threshold in bytes, 0 to always use them or SIZE_MAX to never use them
+void conv_endian_set_stream_threshold(size_t bytes)
+{
+    resolve_kernels();
+    stream_threshold = bytes;
+}
+
+/// @brief Gets the number of bytes from which out of place bulk conversions use non-temporal stores
+/// @return threshold in bytes
+size_t conv_endian_get_stream_threshold(void)
+{
+    resolve_kernels();
+    return stream_threshold;
+}
+
+/*
+
+    Record permutation
+
+*/
+
+static size_t greatest_common_divisor(size_t a, size_t b)
+{
+    while (b != 0)
+    {
+        size_t r = a % b;
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+/// @brief Builds the shuffle masks of a record permutation
+/// @param masks receives CONV_ENDIAN_PERMUTE_MAX_PERIOD mask bytes
+/// @return number of bytes in a period, or 0 if the permutation cannot be done with byte shuffles
+static size_t build_permute_masks(unsigned char* masks, size_t record_size, const uint16_t* perm)
+{
+    size_t period, i;
+
+    if (record_size == 0)
+        return 0;
+
+    period = record_size / greatest_common_divisor(record_size, 64) * 64;
+    if (period > CONV_ENDIAN_PERMUTE_MAX_PERIOD)
+        return 0;
+
+    for (i = 0; i < period; i++)
+    {
+        size_t source = i - i % record_size + perm[i % record_size];
+
+        // byte shuffles cannot move bytes between 16-byte lanes
+        if (source / 16 != i / 16)
+            return 0;
+
+        masks[i] = (unsigned char)(source % 16);
+    }
+
+    return period;
+}
+
+/// @brief Checks whether a record permutation can be done with byte shuffles
+/// @param record_size number of bytes in a record
+/// @param perm record_size byte indices
+/// @return 1 if conv_endian_permute_records uses byte shuffles for this permutation whenever a vector kernel is in use, 0 otherwise
+int conv_endian_permute_fits_shuffles(size_t record_size, const uint16_t* perm)
+{
+    unsigned char masks[CONV_ENDIAN_PERMUTE_MAX_PERIOD];
+
+    return build_permute_masks(masks, record_size, perm) != 0;
+}
+
+/// @brief Rearranges the bytes of every record in an array of fixed size records
+/// @param dst array that receives the rearranged records, may be the same array as src
+/// @param src array of records
+/// @param count number of records in src
+/// @param record_size number of bytes in a record
+/// @param perm record_size byte indices, byte i of every record in dst is byte perm[i] of the same record in src
+/// @return 0 on success or -1, without converting anything, if memory for converting records larger than 256 bytes in place could not be allocated
+int conv_endian_permute_records(void* dst, const void* src, size_t count, size_t record_size, const uint16_t* perm)
+{
+    unsigned char masks[CONV_ENDIAN_PERMUTE_MAX_PERIOD];
+    unsigned char record[256];
+    unsigned char* scratch = record;
+    unsigned char* dst_bytes = (unsigned char*)dst;
+    const unsigned char* src_bytes = (const unsigned char*)src;
+    size_t bytes = count * record_size;
+    size_t period, done = 0, i;
+
+    // converting in place needs a copy of the record being rearranged
+    if (dst_bytes == src_bytes && record_size > sizeof(record))
+    {
+        scratch = (unsigned char*)malloc(record_size);
+        if (scratch == NULL)
+            return -1;
+    }
+
+    resolve_kernels();
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PERMUTE, bytes);
+
+    period = build_permute_masks(masks, record_size, perm);
+    if (period != 0)
+        done = permute_vector(dst_bytes, src_bytes, bytes, masks, period);
+
+    for (; done < bytes; done += record_size)
+    {
+        const unsigned char* in = src_bytes + done;
+
+        if (dst_bytes == src_bytes)
+        {
+            memcpy(scratch, in, record_size);
+            in = scratch;
+        }
+
+        for (i = 0; i < record_size; i++)
+            dst_bytes[done + i] = in[perm[i]];
+    }
+
+    if (scratch != record)
+        free(scratch);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PERMUTE, bytes);
+    return 0;
+}
+
+/*
+
+    Conversions between the endianness of the machine and little or big endian
+
+    Converting to and from an endianness is the same operation: either
+    the bytes are swapped or the values are copied as they are
+
+*/
+
+static void copy_array(void* dst, const void* src, size_t bytes)
+{
+    if (dst != src)
+        memmove(dst, src, bytes);
+}
+
+static void convert_le16(void* dst, const void* src, size_t count)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    copy_array(dst, src, count * 2);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    conv_endian_bswap16_array(dst, src, count);
+#else
+    if (conv_endian_host_is_little())
+        copy_array(dst, src, count * 2);
+    else
+        conv_endian_bswap16_array(dst, src, count);
+#endif
+}
+
+static void convert_be16(void* dst, const void* src, size_t count)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    conv_endian_bswap16_array(dst, src, count);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    copy_array(dst, src, count * 2);
+#else
+    if (conv_endian_host_is_little())
+        conv_endian_bswap16_array(dst, src, count);
+    else
+        copy_array(dst, src, count * 2);
+#endif
+}
+
+static void convert_le32(void* dst, const void* src, size_t count)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    copy_array(dst, src, count * 4);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    conv_endian_bswap32_array(dst, src, count);
+#else
+    if (conv_endian_host_is_little())
+        copy_array(dst, src, count * 4);
+    else
+        conv_endian_bswap32_array(dst, src, count);
+#endif
+}
+
+static void convert_be32(void* dst, const void* src, size_t count)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    conv_endian_bswap32_array(dst, src, count);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    copy_array(dst, src, count * 4);
+#else
+    if (conv_endian_host_is_little())
+        conv_endian_bswap32_array(dst, src, count);
+    else
+        copy_array(dst, src, count * 4);
+#endif
+}
+
+static void convert_le64(void* dst, const void* src, size_t count)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    copy_array(dst, src, count * 8);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    conv_endian_bswap64_array(dst, src, count);
+#else
+    if (conv_endian_host_is_little())
+        copy_array(dst, src, count * 8);
+    else
+        conv_endian_bswap64_array(dst, src, count);
+#endif
+}
+
+static void convert_be64(void* dst, const void* src, size_t count)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    conv_endian_bswap64_array(dst, src, count);
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    copy_array(dst, src, count * 8);
+#else
+    if (conv_endian_host_is_little())
+        conv_endian_bswap64_array(dst, src, count);
+    else
+        copy_array(dst, src, count * 8);
+#endif
+}
+
+/*
+
+    16-bit arrays
+
+*/
+
+/// @brief Reads an array of 16-bit unsigned little endian integers
+void read_le_u16_array(uint16_t* dst, const uint16_t* src, size_t count)
+{
+    convert_le16(dst, src, count);
+}
+
+/// @brief Reads an array of 16-bit unsigned little endian integers in place
+void read_le_u16_array_inplace(uint16_t* buf, size_t count)
+{
+    convert_le16(buf, buf, count);
+}
+
+/// @brief Writes an array of 16-bit unsigned little endian integers
+void convert_to_le_u16_array(uint16_t* dst, const uint16_t* src, size_t count)
+{
+    convert_le16(dst, src, count);
+}
+
+/// @brief Writes an array of 16-bit unsigned little endian integers in place
+void convert_to_le_u16_array_inplace(uint16_t* buf, size_t count)
+{
+    convert_le16(buf, buf, count);
+}
+
+/// @brief Reads an array of 16-bit unsigned big endian integers
+void read_be_u16_array(uint16_t* dst, const uint16_t* src, size_t count)
+{
+    convert_be16(dst, src, count);
+}
+
+/// @brief Reads an array of 16-bit unsigned big endian integers in place
+void read_be_u16_array_inplace(uint16_t* buf, size_t count)
+{
+    convert_be16(buf, buf, count);
+}
+
+/// @brief Writes an array of 16-bit unsigned big endian integers
+void convert_to_be_u16_array(uint16_t* dst, const uint16_t* src, size_t count)
+{
+    convert_be16(dst, src, count);
+}
+
+/// @brief Writes an array of 16-bit unsigned big endian integers in place
+void convert_to_be_u16_array_inplace(uint16_t* buf, size_t count)
+{
+    convert_be16(buf, buf, count);
+}
+
+/// @brief Reads an array of 16-bit signed little endian integers
+void read_le_s16_array(int16_t* dst, const int16_t* src, size_t count)
+{
+    convert_le16(dst, src, count);
+}
+
+/// @brief Reads an array of 16-bit signed little endian integers in place
+void read_le_s16_array_inplace(int16_t* buf, size_t count)
+{
+    convert_le16(buf, buf, count);
+}
+
+/// @brief Writes an array of 16-bit signed little endian integers
+void convert_to_le_s16_array(int16_t* dst, const int16_t* src, size_t count)
+{
+    convert_le16(dst, src, count);
+}
+
+/// @brief Writes an array of 16-bit signed little endian integers in place
+void convert_to_le_s16_array_inplace(int16_t* buf, size_t count)
+{
+    convert_le16(buf, buf, count);
+}
+
+/// @brief Reads an array of 16-bit signed big endian integers
+void read_be_s16_array(int16_t* dst, const int16_t* src, size_t count)
+{
+    convert_be16(dst, src, count);
+}
+
+/// @brief Reads an array of 16-bit signed big endian integers in place
+void read_be_s16_array_inplace(int16_t* buf, size_t count)
+{
+    convert_be16(buf, buf, count);
+}
+
+/// @brief Writes an array of 16-bit signed big endian integers
+void convert_to_be_s16_array(int16_t* dst, const int16_t* src, size_t count)
+{
+    convert_be16(dst, src, count);
+}
+
+/// @brief Writes an array of 16-bit signed big endian integers in place
+void convert_to_be_s16_array_inplace(int16_t* buf, size_t count)
+{
+    convert_be16(buf, buf, count);
+}
+
+/*
+
+    32-bit arrays
+
+*/
+
+/// @brief Reads an array of 32-bit unsigned little endian integers
+void read_le_u32_array(uint32_t* dst, const uint32_t* src, size_t count)
+{
+    convert_le32(dst, src, count);
+}
+
+/// @brief Reads an array of 32-bit unsigned little endian integers in place
+void read_le_u32_array_inplace(uint32_t* buf, size_t count)
+{
+    convert_le32(buf, buf, count);
+}
+
+/// @brief Writes an array of 32-bit unsigned little endian integers
+void convert_to_le_u32_array(uint32_t* dst, const uint32_t* src, size_t count)
+{
+    convert_le32(dst, src, count);
+}
+
+/// @brief Writes an array of 32-bit unsigned little endian integers in place
+void convert_to_le_u32_array_inplace(uint32_t* buf, size_t count)
+{
+    convert_le32(buf, buf, count);
+}
+
+/// @brief Reads an array of 32-bit unsigned big endian integers
+void read_be_u32_array(uint32_t* dst, const uint32_t* src, size_t count)
+{
+    convert_be32(dst, src, count);
+}
+
+/// @brief Reads an array of 32-bit unsigned big endian integers in place
+void read_be_u32_array_inplace(uint32_t* buf, size_t count)
+{
+    convert_be32(buf, buf, count);
+}
+
+/// @brief Writes an array of 32-bit unsigned big endian integers
+void convert_to_be_u32_array(uint32_t* dst, const uint32_t* src, size_t count)
+{
+    convert_be32(dst, src, count);
+}
+
+/// @brief Writes an array of 32-bit unsigned big endian integers in place
+void convert_to_be_u32_array_inplace(uint32_t* buf, size_t count)
+{
+    convert_be32(buf, buf, count);
+}
+
+/// @brief Reads an array of 32-bit signed little endian integers
+void read_le_s32_array(int32_t* dst, const int32_t* src, size_t count)
+{
+    convert_le32(dst, src, count);
+}
+
+/// @brief Reads an array of 32-bit signed little endian integers in place
+void read_le_s32_array_inplace(int32_t* buf, size_t count)
+{
+    convert_le32(buf, buf, count);
+}
+
+/// @brief Writes an array of 32-bit signed little endian integers
+void convert_to_le_s32_array(int32_t* dst, const int32_t* src, size_t count)
+{
+    convert_le32(dst, src, count);
+}
+
+/// @brief Writes an array of 32-bit signed little endian integers in place
+void convert_to_le_s32_array_inplace(int32_t* buf, size_t count)
+{
+    convert_le32(buf, buf, count);
+}
+
+/// @brief Reads an array of 32-bit signed big endian integers
+void read_be_s32_array(int32_t* dst, const int32_t* src, size_t count)
+{
+    convert_be32(dst, src, count);
+}
+
+/// @brief Reads an array of 32-bit signed big endian integers in place
+void read_be_s32_array_inplace(int32_t* buf, size_t count)
+{
+    convert_be32(buf, buf, count);
+}
+
+/// @brief Writes an array of 32-bit signed big endian integers
+void convert_to_be_s32_array(int32_t* dst, const int32_t* src, size_t count)
+{
+    convert_be32(dst, src, count);
+}
+
+/// @brief Writes an array of 32-bit signed big endian integers in place
+void convert_to_be_s32_array_inplace(int32_t* buf, size_t count)
+{
+    convert_be32(buf, buf, count);
+}
+
+/// @brief Reads an array of 32-bit little endian floating point numbers
+void read_le_f32_array(float* dst, const float* src, size_t count)
+{
+    convert_le32(dst, src, count);
+}
+
+/// @brief Reads an array of 32-bit little endian floating point numbers in place
+void read_le_f32_array_inplace(float* buf, size_t count)
+{
+    convert_le32(buf, buf, count);
+}
+
+/// @brief Writes an array of 32-bit little endian floating point numbers
+void convert_to_le_f32_array(float* dst, const float* src, size_t count)
+{
+    convert_le32(dst, src, count);
+}
+
+/// @brief Writes an array of 32-bit little endian floating point numbers in place
+void convert_to_le_f32_array_inplace(float* buf, size_t count)
+{
+    convert_le32(buf, buf, count);
+}
+
+/// @brief Reads an array of 32-bit big endian floating point numbers
+void read_be_f32_array(float* dst, const float* src, size_t count)
+{
+    convert_be32(dst, src, count);
+}
+
+/// @brief Reads an array of 32-bit big endian floating point numbers in place
+void read_be_f32_array_inplace(float* buf, size_t count)
+{
+    convert_be32(buf, buf, count);
+}
+
+/// @brief Writes an array of 32-bit big endian floating point numbers
+void convert_to_be_f32_array(float* dst, const float* src, size_t count)
+{
+    convert_be32(dst, src, count);
+}
+
+/// @brief Writes an array of 32-bit big endian floating point numbers in place
+void convert_to_be_f32_array_inplace(float* buf, size_t count)
+{
+    convert_be32(buf, buf, count);
+}
+
+/*
+
+    64-bit arrays
+
+*/
+
+/// @brief Reads an array of 64-bit unsigned little endian integers
+void read_le_u64_array(uint64_t* dst, const uint64_t* src, size_t count)
+{
+    convert_le64(dst, src, count);
+}
+
+/// @brief Reads an array of 64-bit unsigned little endian integers in place
+void read_le_u64_array_inplace(uint64_t* buf, size_t count)
+{
+    convert_le64(buf, buf, count);
+}
+
+/// @brief Writes an array of 64-bit unsigned little endian integers
+void convert_to_le_u64_array(uint64_t* dst, const uint64_t* src, size_t count)
+{
+    convert_le64(dst, src, count);
+}
+
+/// @brief Writes an array of 64-bit unsigned little endian integers in place
+void convert_to_le_u64_array_inplace(uint64_t* buf, size_t count)
+{
+    convert_le64(buf, buf, count);
+}
+
+/// @brief Reads an array of 64-bit unsigned big endian integers
+void read_be_u64_array(uint64_t* dst, const uint64_t* src, size_t count)
+{
+    convert_be64(dst, src, count);
+}
+
+/// @brief Reads an array of 64-bit unsigned big endian integers in place
+void read_be_u64_array_inplace(uint64_t* buf, size_t count)
+{
+    convert_be64(buf, buf, count);
+}
+
+/// @brief Writes an array of 64-bit unsigned big endian integers
+void convert_to_be_u64_array(uint64_t* dst, const uint64_t* src, size_t count)
+{
+    convert_be64(dst, src, count);
+}
+
+/// @brief Writes an array of 64-bit unsigned big endian integers in place
+void convert_to_be_u64_array_inplace(uint64_t* buf, size_t count)
+{
+    convert_be64(buf, buf, count);
+}
+
+/// @brief Reads an array of 64-bit signed little endian integers
+void read_le_s64_array(int64_t* dst, const int64_t* src, size_t count)
+{
+    convert_le64(dst, src, count);
+}
+
+/// @brief Reads an array of 64-bit signed little endian integers in place
+void read_le_s64_array_inplace(int64_t* buf, size_t count)
+{
+    convert_le64(buf, buf, count);
+}
+
+/// @brief Writes an array of 64-bit signed little endian integers
+void convert_to_le_s64_array(int64_t* dst, const int64_t* src, size_t count)
+{
+    convert_le64(dst, src, count);
+}
+
+/// @brief Writes an array of 64-bit signed little endian integers in place
+void convert_to_le_s64_array_inplace(int64_t* buf, size_t count)
+{
+    convert_le64(buf, buf, count);
+}
+
+/// @brief Reads an array of 64-bit signed big endian integers
+void read_be_s64_array(int64_t* dst, const int64_t* src, size_t count)
+{
+    convert_be64(dst, src, count);
+}
+
+/// @brief Reads an array of 64-bit signed big endian integers in place
+void read_be_s64_array_inplace(int64_t* buf, size_t count)
+{
+    convert_be64(buf, buf, count);
+}
+
+/// @brief Writes an array of 64-bit signed big endian integers
+void convert_to_be_s64_array(int64_t* dst, const int64_t* src, size_t count)
+{
+    convert_be64(dst, src, count);
+}
+
+/// @brief Writes an array of 64-bit signed big endian integers in place
+void convert_to_be_s64_array_inplace(int64_t* buf, size_t count)
+{
+    convert_be64(buf, buf, count);
+}
+
+/// @brief Reads an array of 64-bit little endian floating point numbers
+void read_le_f64_array(double* dst, const double* src, size_t count)
+{
+    convert_le64(dst, src, count);
+}
+
+/// @brief Reads an array of 64-bit little endian floating point numbers in place
+void read_le_f64_array_inplace(double* buf, size_t count)
+{
+    convert_le64(buf, buf, count);
+}
+
+/// @brief Writes an array of 64-bit little endian floating point numbers
+void convert_to_le_f64_array(double* dst, const double* src, size_t count)
+{
+    convert_le64(dst, src, count);
+}
+
+/// @brief Writes an array of 64-bit little endian floating point numbers in place
+void convert_to_le_f64_array_inplace(double* buf, size_t count)
+{
+    convert_le64(buf, buf, count);
+}
+
+/// @brief Reads an array of 64-bit big endian floating point numbers
+void read_be_f64_array(double* dst, const double* src, size_t count)
+{
+    convert_be64(dst, src, count);
+}
+
+/// @brief Reads an array of 64-bit big endian floating point numbers in place
+void read_be_f64_array_inplace(double* buf, size_t count)
+{
+    convert_be64(buf, buf, count);
+}
+
+/// @brief Writes an array of 64-bit big endian floating point numbers
+void convert_to_be_f64_array(double* dst, const double* src, size_t count)
+{
+    convert_be64(dst, src, count);
+}
+
+/// @brief Writes an array of 64-bit big endian floating point numbers in place
+void convert_to_be_f64_array_inplace(double* buf, size_t count)
+{
+    convert_be64(buf, buf, count);
+}
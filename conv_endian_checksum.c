@@ -0,0 +1,690 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_checksum.c
+/// @brief A C portable source code that contains implementation of functions for byte swapping arrays and checksumming them in the same pass
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Scalar checksums
+
+    CRC32C is the reflected CRC with the Castagnoli polynomial 0x1EDC6F41
+    used by iSCSI, SCTP and ext4, computed a byte at a time from a table
+    when the processor has no CRC32 instruction.
+
+    The Internet checksum of RFC 1071 is the one's complement sum of the
+    big endian 16-bit words of the data. Since 0x10000 is 1 modulo 0xFFFF,
+    wider words can be added into a 64-bit accumulator and folded into 16
+    bits at the end, which is the same sum as adding 16-bit words with end
+    around carries. Every piece of data except the last must therefore
+    start at an even offset.
+
+*/
+
+static const uint32_t crc32c_table[256] =
+{
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351
+};
+
+static uint32_t crc_table(uint32_t crc, const unsigned char* data, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i++)
+        crc = crc32c_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+    return crc;
+}
+
+static uint64_t sum_scalar(uint64_t acc, const unsigned char* data, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i + 4 <= size; i += 4)
+        acc += load_be_u32(data + i);
+
+    if (i + 2 <= size)
+    {
+        acc += load_be_u16(data + i);
+        i += 2;
+    }
+
+    // an odd last byte is the high byte of a word padded with zero
+    if (i < size)
+        acc += (uint64_t)data[i] << 8;
+
+    return acc;
+}
+
+static uint16_t sum_fold(uint64_t acc)
+{
+    while (acc >> 16)
+        acc = (acc & 0xFFFF) + (acc >> 16);
+
+    return (uint16_t)acc;
+}
+
+/*
+
+    Word kernels
+
+    Eight bytes are swapped at a time in a 64-bit integer, which finishes
+    what the vector kernels leave over and is the whole conversion when no
+    vector kernel is in use.
+
+*/
+
+static uint64_t swap_word(uint64_t val, size_t width)
+{
+    switch (width)
+    {
+    case 2:
+        return ((val >> 8) & 0x00FF00FF00FF00FF) | ((val & 0x00FF00FF00FF00FF) << 8);
+    case 4:
+        val = conv_endian_bswap64(val);
+        return (val >> 32) | (val << 32);
+    default:
+        return conv_endian_bswap64(val);
+    }
+}
+
+static size_t crc_swap_word(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width, int out, uint32_t* crc)
+{
+    uint32_t val = *crc;
+    size_t i;
+
+    for (i = 0; i + 8 <= bytes; i += 8)
+    {
+        unsigned char word[8];
+        uint64_t in, swapped;
+
+        memcpy(&in, src + i, sizeof(in));
+        swapped = swap_word(in, width);
+        memcpy(word, out ? &swapped : &in, sizeof(word));
+        memcpy(dst + i, &swapped, sizeof(swapped));
+        val = crc_table(val, word, sizeof(word));
+    }
+
+    *crc = val;
+    return i;
+}
+
+static size_t sum_swap_word(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width, int out, uint64_t* acc)
+{
+    uint64_t sum = *acc;
+    size_t i;
+
+    for (i = 0; i + 8 <= bytes; i += 8)
+    {
+        uint64_t in, swapped, val;
+
+        memcpy(&in, src + i, sizeof(in));
+        swapped = swap_word(in, width);
+        memcpy(dst + i, &swapped, sizeof(swapped));
+
+        // two big endian 32-bit words
+        val = conv_endian_be64(out ? swapped : in);
+        sum += (val >> 32) + (val & 0xFFFFFFFF);
+    }
+
+    *acc = sum;
+    return i;
+}
+
+/*
+
+    Vector kernels
+
+    Every kernel loads a block of the source, byte swaps it with a shuffle,
+    stores it and adds either the loaded block or the swapped block to the
+    checksum while it is still in a register, so the data is only read
+    once.
+
+    CRC32C uses the CRC32 instruction of SSE4.2, which the vector kernels
+    do not require: use_crc_sse42 only uses it when conv_endian_has_crc32c
+    reports SSE4.2 and uses the table otherwise. Its latency limits a
+    single CRC to 8 bytes every 3 cycles whatever the width of the vectors,
+    so all vector kernels share the 16-byte loop. The Internet checksum adds the bytes at even and odd
+    offsets separately with sums of absolute differences against zero,
+    which collect them into 64-bit lanes so that no carry is ever lost.
+
+    Each kernel returns the number of bytes it has converted so that the
+    caller can finish the rest one value at a time. A kernel that is given
+    no destination only checksums the source.
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i swap_mask_128(size_t width)
+{
+    switch (width)
+    {
+    case 2:
+        return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    case 4:
+        return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    case 8:
+        return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    default:
+        return _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    }
+}
+
+CONV_ENDIAN_TARGET("sse4.2")
+static uint32_t crc_step_sse42(uint32_t crc, uint64_t val)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    return (uint32_t)_mm_crc32_u64(crc, val);
+#else
+    crc = _mm_crc32_u32(crc, (uint32_t)val);
+    return _mm_crc32_u32(crc, (uint32_t)(val >> 32));
+#endif
+}
+
+CONV_ENDIAN_TARGET("sse4.2")
+static uint32_t crc_sse42(uint32_t crc, const unsigned char* data, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i + 8 <= size; i += 8)
+    {
+        uint64_t val;
+        memcpy(&val, data + i, sizeof(val));
+        crc = crc_step_sse42(crc, val);
+    }
+
+    for (; i < size; i++)
+        crc = _mm_crc32_u8(crc, data[i]);
+
+    return crc;
+}
+
+CONV_ENDIAN_TARGET("ssse3,sse4.2")
+static size_t crc_swap_sse42(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width, int out, uint32_t* crc)
+{
+    __m128i mask = swap_mask_128(width);
+    uint32_t val = *crc;
+    size_t i;
+
+    for (i = 0; i + 16 <= bytes; i += 16)
+    {
+        uint64_t lanes[2];
+        __m128i in = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i swapped = _mm_shuffle_epi8(in, mask);
+
+        _mm_storeu_si128((__m128i*)(dst + i), swapped);
+        _mm_storeu_si128((__m128i*)lanes, out ? swapped : in);
+        val = crc_step_sse42(val, lanes[0]);
+        val = crc_step_sse42(val, lanes[1]);
+    }
+
+    *crc = val;
+    return i;
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t sum_swap_ssse3(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width, int out, uint64_t* acc)
+{
+    __m128i mask = swap_mask_128(width);
+    __m128i low = _mm_set1_epi16(0xFF);
+    __m128i zero = _mm_setzero_si128();
+    __m128i even = zero;
+    __m128i odd = zero;
+    uint64_t lanes[4];
+    size_t i;
+
+    for (i = 0; i + 16 <= bytes; i += 16)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i swapped = _mm_shuffle_epi8(in, mask);
+        __m128i val = out ? swapped : in;
+
+        if (dst != NULL)
+            _mm_storeu_si128((__m128i*)(dst + i), swapped);
+
+        even = _mm_add_epi64(even, _mm_sad_epu8(_mm_and_si128(val, low), zero));
+        odd = _mm_add_epi64(odd, _mm_sad_epu8(_mm_srli_epi16(val, 8), zero));
+    }
+
+    _mm_storeu_si128((__m128i*)lanes, even);
+    _mm_storeu_si128((__m128i*)(lanes + 2), odd);
+    *acc += ((lanes[0] + lanes[1]) << 8) + lanes[2] + lanes[3];
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static __m256i swap_mask_256(size_t width)
+{
+    __m128i mask = swap_mask_128(width);
+    return _mm256_broadcastsi128_si256(mask);
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t sum_swap_avx2(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width, int out, uint64_t* acc)
+{
+    __m256i mask = swap_mask_256(width);
+    __m256i low = _mm256_set1_epi16(0xFF);
+    __m256i zero = _mm256_setzero_si256();
+    __m256i even = zero;
+    __m256i odd = zero;
+    uint64_t lanes[8];
+    size_t i;
+
+    for (i = 0; i + 32 <= bytes; i += 32)
+    {
+        __m256i in = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i swapped = _mm256_shuffle_epi8(in, mask);
+        __m256i val = out ? swapped : in;
+
+        if (dst != NULL)
+            _mm256_storeu_si256((__m256i*)(dst + i), swapped);
+
+        even = _mm256_add_epi64(even, _mm256_sad_epu8(_mm256_and_si256(val, low), zero));
+        odd = _mm256_add_epi64(odd, _mm256_sad_epu8(_mm256_srli_epi16(val, 8), zero));
+    }
+
+    _mm256_storeu_si256((__m256i*)lanes, even);
+    _mm256_storeu_si256((__m256i*)(lanes + 4), odd);
+    *acc += ((lanes[0] + lanes[1] + lanes[2] + lanes[3]) << 8) + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t sum_swap_avx512(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width, int out, uint64_t* acc)
+{
+    __m512i mask = _mm512_broadcast_i32x4(swap_mask_128(width));
+    __m512i low = _mm512_set1_epi16(0xFF);
+    __m512i zero = _mm512_setzero_si512();
+    __m512i even = zero;
+    __m512i odd = zero;
+    size_t i;
+
+    for (i = 0; i + 64 <= bytes; i += 64)
+    {
+        __m512i in = _mm512_loadu_si512((const void*)(src + i));
+        __m512i swapped = _mm512_shuffle_epi8(in, mask);
+        __m512i val = out ? swapped : in;
+
+        if (dst != NULL)
+            _mm512_storeu_si512((void*)(dst + i), swapped);
+
+        even = _mm512_add_epi64(even, _mm512_sad_epu8(_mm512_and_si512(val, low), zero));
+        odd = _mm512_add_epi64(odd, _mm512_sad_epu8(_mm512_srli_epi16(val, 8), zero));
+    }
+
+    *acc += ((uint64_t)_mm512_reduce_add_epi64(even) << 8) + (uint64_t)_mm512_reduce_add_epi64(odd);
+    return i;
+}
+
+#endif
+
+/*
+
+    Kernel selection
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+static int use_crc_sse42(void)
+{
+    return conv_endian_get_kernel() != CONV_ENDIAN_KERNEL_SCALAR && conv_endian_has_crc32c();
+}
+#endif
+
+static uint32_t crc_update(uint32_t crc, const unsigned char* data, size_t size)
+{
+#if defined(CONV_ENDIAN_X86)
+    if (use_crc_sse42())
+        return crc_sse42(crc, data, size);
+#endif
+
+    return crc_table(crc, data, size);
+}
+
+static size_t crc_swap(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width, int out, uint32_t* crc)
+{
+#if defined(CONV_ENDIAN_X86)
+    if (use_crc_sse42())
+        return crc_swap_sse42(dst, src, bytes, width, out, crc);
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)bytes;
+    (void)width;
+    (void)out;
+    (void)crc;
+    return 0;
+}
+
+static size_t sum_swap(unsigned char* dst, const unsigned char* src, size_t bytes, size_t width, int out, uint64_t* acc)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return sum_swap_avx512(dst, src, bytes, width, out, acc);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return sum_swap_avx2(dst, src, bytes, width, out, acc);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        return sum_swap_ssse3(dst, src, bytes, width, out, acc);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)bytes;
+    (void)width;
+    (void)out;
+    (void)acc;
+    return 0;
+}
+
+/*
+
+    Fused conversions
+
+    out selects whether the source, as it was before the conversion, or
+    the destination is checksummed. The values that are left over by the
+    word kernels are swapped one at a time.
+
+*/
+
+static void swap_value(unsigned char* val, const unsigned char* src, size_t width)
+{
+    size_t i;
+
+    for (i = 0; i < width; i++)
+        val[i] = src[width - 1 - i];
+}
+
+static uint32_t swap_crc32c(void* dst, const void* src, size_t count, size_t width, int out, uint32_t crc)
+{
+    unsigned char* dst_bytes = (unsigned char*)dst;
+    const unsigned char* src_bytes = (const unsigned char*)src;
+    size_t bytes = count * width;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_CHECKSUM, bytes);
+
+    crc = ~crc;
+
+    i = crc_swap(dst_bytes, src_bytes, bytes, width, out, &crc);
+    i += crc_swap_word(dst_bytes + i, src_bytes + i, bytes - i, width, out, &crc);
+
+    for (; i < bytes; i += width)
+    {
+        unsigned char val[8];
+
+        swap_value(val, src_bytes + i, width);
+        crc = crc_update(crc, out ? val : src_bytes + i, width);
+        memcpy(dst_bytes + i, val, width);
+    }
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_CHECKSUM, bytes);
+    return ~crc;
+}
+
+static uint16_t swap_inet_sum(void* dst, const void* src, size_t count, size_t width, int out, uint16_t sum)
+{
+    unsigned char* dst_bytes = (unsigned char*)dst;
+    const unsigned char* src_bytes = (const unsigned char*)src;
+    size_t bytes = count * width;
+    uint64_t acc = sum;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_CHECKSUM, bytes);
+
+    i = sum_swap(dst_bytes, src_bytes, bytes, width, out, &acc);
+    i += sum_swap_word(dst_bytes + i, src_bytes + i, bytes - i, width, out, &acc);
+
+    for (; i < bytes; i += width)
+    {
+        unsigned char val[8];
+
+        swap_value(val, src_bytes + i, width);
+        acc = sum_scalar(acc, out ? val : src_bytes + i, width);
+        memcpy(dst_bytes + i, val, width);
+    }
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_CHECKSUM, bytes);
+    return sum_fold(acc);
+}
+
+/*
+
+    Checksums
+
+*/
+
+/// @brief Computes the CRC32C of a buffer
+/// @param data buffer to be checksummed
+/// @param size number of bytes in data
+/// @param crc CRC32C of the data before this buffer, or 0 for the first buffer
+/// @return CRC32C of the data up to the end of this buffer
+uint32_t conv_endian_crc32c(const void* data, size_t size, uint32_t crc)
+{
+    return ~crc_update(~crc, (const unsigned char*)data, size);
+}
+
+/// @brief Computes the Internet checksum sum of a buffer
+/// @param data buffer to be checksummed, which must have an even size unless it is the last buffer
+/// @param size number of bytes in data
+/// @param sum sum of the data before this buffer, or 0 for the first buffer
+/// @return one's complement sum of the big endian 16-bit words up to the end of this buffer, whose complement is the checksum
+uint16_t conv_endian_inet_sum(const void* data, size_t size, uint16_t sum)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t acc = sum;
+    size_t done = sum_swap(NULL, bytes, size, 1, 0, &acc);
+
+    return sum_fold(sum_scalar(acc, bytes + done, size - done));
+}
+
+/*
+
+    Byte swapping with a CRC32C
+
+*/
+
+/// @brief Reverses the bytes of every 16-bit value in an array and computes the CRC32C of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before src, or 0
+/// @return CRC32C of the data up to the end of src, as it was before the conversion
+uint32_t conv_endian_bswap16_array_crc32c(void* dst, const void* src, size_t count, uint32_t crc)
+{
+    return swap_crc32c(dst, src, count, 2, 0, crc);
+}
+
+/// @brief Reverses the bytes of every 32-bit value in an array and computes the CRC32C of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before src, or 0
+/// @return CRC32C of the data up to the end of src, as it was before the conversion
+uint32_t conv_endian_bswap32_array_crc32c(void* dst, const void* src, size_t count, uint32_t crc)
+{
+    return swap_crc32c(dst, src, count, 4, 0, crc);
+}
+
+/// @brief Reverses the bytes of every 64-bit value in an array and computes the CRC32C of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before src, or 0
+/// @return CRC32C of the data up to the end of src, as it was before the conversion
+uint32_t conv_endian_bswap64_array_crc32c(void* dst, const void* src, size_t count, uint32_t crc)
+{
+    return swap_crc32c(dst, src, count, 8, 0, crc);
+}
+
+/// @brief Reverses the bytes of every 16-bit value in an array and computes the CRC32C of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before dst, or 0
+/// @return CRC32C of the data up to the end of dst
+uint32_t conv_endian_bswap16_array_crc32c_dst(void* dst, const void* src, size_t count, uint32_t crc)
+{
+    return swap_crc32c(dst, src, count, 2, 1, crc);
+}
+
+/// @brief Reverses the bytes of every 32-bit value in an array and computes the CRC32C of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before dst, or 0
+/// @return CRC32C of the data up to the end of dst
+uint32_t conv_endian_bswap32_array_crc32c_dst(void* dst, const void* src, size_t count, uint32_t crc)
+{
+    return swap_crc32c(dst, src, count, 4, 1, crc);
+}
+
+/// @brief Reverses the bytes of every 64-bit value in an array and computes the CRC32C of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+/// @param crc CRC32C of the data before dst, or 0
+/// @return CRC32C of the data up to the end of dst
+uint32_t conv_endian_bswap64_array_crc32c_dst(void* dst, const void* src, size_t count, uint32_t crc)
+{
+    return swap_crc32c(dst, src, count, 8, 1, crc);
+}
+
+/*
+
+    Byte swapping with an Internet checksum
+
+*/
+
+/// @brief Reverses the bytes of every 16-bit value in an array and computes the Internet checksum sum of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before src, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of src, as it was before the conversion
+uint16_t conv_endian_bswap16_array_inet_sum(void* dst, const void* src, size_t count, uint16_t sum)
+{
+    return swap_inet_sum(dst, src, count, 2, 0, sum);
+}
+
+/// @brief Reverses the bytes of every 32-bit value in an array and computes the Internet checksum sum of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before src, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of src, as it was before the conversion
+uint16_t conv_endian_bswap32_array_inet_sum(void* dst, const void* src, size_t count, uint16_t sum)
+{
+    return swap_inet_sum(dst, src, count, 4, 0, sum);
+}
+
+/// @brief Reverses the bytes of every 64-bit value in an array and computes the Internet checksum sum of the source
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before src, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of src, as it was before the conversion
+uint16_t conv_endian_bswap64_array_inet_sum(void* dst, const void* src, size_t count, uint16_t sum)
+{
+    return swap_inet_sum(dst, src, count, 8, 0, sum);
+}
+
+/// @brief Reverses the bytes of every 16-bit value in an array and computes the Internet checksum sum of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before dst, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of dst
+uint16_t conv_endian_bswap16_array_inet_sum_dst(void* dst, const void* src, size_t count, uint16_t sum)
+{
+    return swap_inet_sum(dst, src, count, 2, 1, sum);
+}
+
+/// @brief Reverses the bytes of every 32-bit value in an array and computes the Internet checksum sum of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before dst, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of dst
+uint16_t conv_endian_bswap32_array_inet_sum_dst(void* dst, const void* src, size_t count, uint16_t sum)
+{
+    return swap_inet_sum(dst, src, count, 4, 1, sum);
+}
+
+/// @brief Reverses the bytes of every 64-bit value in an array and computes the Internet checksum sum of the destination
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+/// @param sum sum of the data before dst, or 0
+/// @return one's complement sum of the big endian 16-bit words up to the end of dst
+uint16_t conv_endian_bswap64_array_inet_sum_dst(void* dst, const void* src, size_t count, uint16_t sum)
+{
+    return swap_inet_sum(dst, src, count, 8, 1, sum);
+}
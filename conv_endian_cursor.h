@@ -0,0 +1,499 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_cursor.h
+/// @brief A C portable header that contains inline cursors for reading and writing numbers one after another in a buffer
+
+
+#ifndef CONV_ENDIAN_CURSOR_H
+#define CONV_ENDIAN_CURSOR_H
+
+#include "conv_endian.h"
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Cursors
+
+    A reader walks a buffer of received bytes and a writer walks a buffer
+    that is being filled, each keeping its position so that no offsets have
+    to be computed by hand:
+
+        conv_endian_reader r;
+        conv_endian_reader_init(&r, packet, packet_size);
+
+        type = conv_endian_get_u8(&r);
+        length = conv_endian_get_be_u16(&r);
+
+        // one bounds check for the next 14 bytes
+        if (conv_endian_reader_reserve(&r, 14))
+        {
+            id = conv_endian_get_be_u32_unchecked(&r);
+            time = conv_endian_get_be_u64_unchecked(&r);
+            flags = conv_endian_get_be_u16_unchecked(&r);
+        }
+
+        if (conv_endian_reader_failed(&r))
+            return -1;
+
+    Every number type of conv_endian.h has a get function for readers and a
+    put function for writers in both endiannesses, such as
+    conv_endian_get_le_f32, conv_endian_get_be_s24 and
+    conv_endian_put_be_u128, and 8-bit numbers have conv_endian_get_u8,
+    conv_endian_get_s8, conv_endian_put_u8 and conv_endian_put_s8.
+
+    The checked functions check that the number fits in the rest of the
+    buffer. When it does not, or when an earlier check has failed, they
+    read 0 or write nothing and set the error flag of the cursor, which
+    stays set. A parser can therefore read a whole message and check the
+    flag once at the end.
+
+    The _unchecked functions do not check anything. They are only safe
+    after conv_endian_reader_reserve or conv_endian_writer_reserve has
+    returned 1 for at least as many bytes as they read or write.
+
+    Everything here is inline and only uses the inline helpers of
+    conv_endian.h, so it does not depend on CONV_ENDIAN_HEADER_ONLY.
+
+*/
+
+/// @brief A cursor that reads numbers one after another from a buffer
+typedef struct conv_endian_reader
+{
+    const unsigned char* data; ///< first byte of the buffer
+    size_t size; ///< number of bytes in the buffer
+    size_t pos; ///< offset of the next byte to be read
+    int error; ///< set when a read did not fit in the buffer, and stays set
+} conv_endian_reader;
+
+/// @brief A cursor that writes numbers one after another into a buffer
+typedef struct conv_endian_writer
+{
+    unsigned char* data; ///< first byte of the buffer
+    size_t size; ///< number of bytes in the buffer
+    size_t pos; ///< offset of the next byte to be written
+    int error; ///< set when a write did not fit in the buffer, and stays set
+} conv_endian_writer;
+
+/// @brief Starts a reader at the beginning of a buffer
+/// @param reader reader to be started
+/// @param data buffer to be read
+/// @param size number of bytes in data
+static CONV_ENDIAN_INLINE void conv_endian_reader_init(conv_endian_reader* reader, const void* data, size_t size)
+{
+    reader->data = (const unsigned char*)data;
+    reader->size = size;
+    reader->pos = 0;
+    reader->error = 0;
+}
+
+/// @brief Starts a writer at the beginning of a buffer
+/// @param writer writer to be started
+/// @param data buffer to be written
+/// @param size number of bytes in data
+static CONV_ENDIAN_INLINE void conv_endian_writer_init(conv_endian_writer* writer, void* data, size_t size)
+{
+    writer->data = (unsigned char*)data;
+    writer->size = size;
+    writer->pos = 0;
+    writer->error = 0;
+}
+
+/// @brief Gets the number of bytes a reader has not read yet
+/// @param reader reader
+/// @return number of bytes left in the buffer
+static CONV_ENDIAN_INLINE size_t conv_endian_reader_remaining(const conv_endian_reader* reader)
+{
+    return reader->size - reader->pos;
+}
+
+/// @brief Gets the number of bytes a writer has not written yet
+/// @param writer writer
+/// @return number of bytes left in the buffer
+static CONV_ENDIAN_INLINE size_t conv_endian_writer_remaining(const conv_endian_writer* writer)
+{
+    return writer->size - writer->pos;
+}
+
+/// @brief Checks whether a read of a reader has failed
+/// @param reader reader
+/// @return 1 if a read did not fit in the buffer, 0 otherwise
+static CONV_ENDIAN_INLINE int conv_endian_reader_failed(const conv_endian_reader* reader)
+{
+    return reader->error;
+}
+
+/// @brief Checks whether a write of a writer has failed
+/// @param writer writer
+/// @return 1 if a write did not fit in the buffer, 0 otherwise
+static CONV_ENDIAN_INLINE int conv_endian_writer_failed(const conv_endian_writer* writer)
+{
+    return writer->error;
+}
+
+/// @brief Checks that a number of bytes can be read with the _unchecked functions
+/// @param reader reader
+/// @param bytes number of bytes to be read
+/// @return 1 if the bytes are left in the buffer and no read has failed, 0 after setting the error flag otherwise
+static CONV_ENDIAN_INLINE int conv_endian_reader_reserve(conv_endian_reader* reader, size_t bytes)
+{
+    if (reader->error || bytes > reader->size - reader->pos)
+    {
+        reader->error = 1;
+        return 0;
+    }
+
+    return 1;
+}
+
+/// @brief Checks that a number of bytes can be written with the _unchecked functions
+/// @param writer writer
+/// @param bytes number of bytes to be written
+/// @return 1 if the bytes are left in the buffer and no write has failed, 0 after setting the error flag otherwise
+static CONV_ENDIAN_INLINE int conv_endian_writer_reserve(conv_endian_writer* writer, size_t bytes)
+{
+    if (writer->error || bytes > writer->size - writer->pos)
+    {
+        writer->error = 1;
+        return 0;
+    }
+
+    return 1;
+}
+
+/// @brief Skips bytes of a reader
+/// @param reader reader
+/// @param bytes number of bytes to be skipped
+static CONV_ENDIAN_INLINE void conv_endian_reader_skip(conv_endian_reader* reader, size_t bytes)
+{
+    if (conv_endian_reader_reserve(reader, bytes))
+        reader->pos += bytes;
+}
+
+/// @brief Reads bytes from a reader without converting them
+/// @param reader reader
+/// @param dst array that receives the bytes, left unchanged when they do not fit in the buffer
+/// @param bytes number of bytes to be read
+static CONV_ENDIAN_INLINE void conv_endian_get_bytes(conv_endian_reader* reader, void* dst, size_t bytes)
+{
+    if (conv_endian_reader_reserve(reader, bytes))
+    {
+        memcpy(dst, reader->data + reader->pos, bytes);
+        reader->pos += bytes;
+    }
+}
+
+/// @brief Writes bytes into a writer without converting them
+/// @param writer writer
+/// @param src array of bytes to be written
+/// @param bytes number of bytes to be written
+static CONV_ENDIAN_INLINE void conv_endian_put_bytes(conv_endian_writer* writer, const void* src, size_t bytes)
+{
+    if (conv_endian_writer_reserve(writer, bytes))
+    {
+        memcpy(writer->data + writer->pos, src, bytes);
+        writer->pos += bytes;
+    }
+}
+
+/*
+
+    Numbers of 8, 16, 32 and 64 bits
+
+    CONV_ENDIAN_CURSOR_NUMBER defines the four functions of one number type
+    in one endianness: a load of the bits, the conversion helper of
+    conv_endian.h that matches the endianness, then a cast or a
+    reinterpretation into the type
+
+*/
+
+#define CONV_ENDIAN_CURSOR_NUMBER(name, type, bits, swap, from_bits, to_bits) \
+    static CONV_ENDIAN_INLINE type conv_endian_get_##name##_unchecked(conv_endian_reader* reader) \
+    { \
+        uint##bits##_t val; \
+        memcpy(&val, reader->data + reader->pos, sizeof(val)); \
+        reader->pos += sizeof(val); \
+        return from_bits(swap(val)); \
+    } \
+    static CONV_ENDIAN_INLINE type conv_endian_get_##name(conv_endian_reader* reader) \
+    { \
+        if (!conv_endian_reader_reserve(reader, bits / 8)) \
+            return 0; \
+        return conv_endian_get_##name##_unchecked(reader); \
+    } \
+    static CONV_ENDIAN_INLINE void conv_endian_put_##name##_unchecked(conv_endian_writer* writer, type val) \
+    { \
+        uint##bits##_t out = swap(to_bits(val)); \
+        memcpy(writer->data + writer->pos, &out, sizeof(out)); \
+        writer->pos += sizeof(out); \
+    } \
+    static CONV_ENDIAN_INLINE void conv_endian_put_##name(conv_endian_writer* writer, type val) \
+    { \
+        if (conv_endian_writer_reserve(writer, bits / 8)) \
+            conv_endian_put_##name##_unchecked(writer, val); \
+    }
+
+#define CONV_ENDIAN_CURSOR_SAME(val) (val)
+#define CONV_ENDIAN_CURSOR_U8(val) ((uint8_t)(val))
+#define CONV_ENDIAN_CURSOR_S8(val) ((int8_t)(val))
+#define CONV_ENDIAN_CURSOR_U16(val) ((uint16_t)(val))
+#define CONV_ENDIAN_CURSOR_S16(val) ((int16_t)(val))
+#define CONV_ENDIAN_CURSOR_U32(val) ((uint32_t)(val))
+#define CONV_ENDIAN_CURSOR_S32(val) ((int32_t)(val))
+#define CONV_ENDIAN_CURSOR_U64(val) ((uint64_t)(val))
+#define CONV_ENDIAN_CURSOR_S64(val) ((int64_t)(val))
+
+CONV_ENDIAN_CURSOR_NUMBER(u8, uint8_t, 8, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_CURSOR_NUMBER(s8, int8_t, 8, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_S8, CONV_ENDIAN_CURSOR_U8)
+
+CONV_ENDIAN_CURSOR_NUMBER(le_u16, uint16_t, 16, conv_endian_le16, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_CURSOR_NUMBER(be_u16, uint16_t, 16, conv_endian_be16, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_CURSOR_NUMBER(le_s16, int16_t, 16, conv_endian_le16, CONV_ENDIAN_CURSOR_S16, CONV_ENDIAN_CURSOR_U16)
+CONV_ENDIAN_CURSOR_NUMBER(be_s16, int16_t, 16, conv_endian_be16, CONV_ENDIAN_CURSOR_S16, CONV_ENDIAN_CURSOR_U16)
+
+CONV_ENDIAN_CURSOR_NUMBER(le_u32, uint32_t, 32, conv_endian_le32, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_CURSOR_NUMBER(be_u32, uint32_t, 32, conv_endian_be32, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_CURSOR_NUMBER(le_s32, int32_t, 32, conv_endian_le32, CONV_ENDIAN_CURSOR_S32, CONV_ENDIAN_CURSOR_U32)
+CONV_ENDIAN_CURSOR_NUMBER(be_s32, int32_t, 32, conv_endian_be32, CONV_ENDIAN_CURSOR_S32, CONV_ENDIAN_CURSOR_U32)
+CONV_ENDIAN_CURSOR_NUMBER(le_f32, float, 32, conv_endian_le32, conv_endian_bits_f32, conv_endian_f32_bits)
+CONV_ENDIAN_CURSOR_NUMBER(be_f32, float, 32, conv_endian_be32, conv_endian_bits_f32, conv_endian_f32_bits)
+
+CONV_ENDIAN_CURSOR_NUMBER(le_u64, uint64_t, 64, conv_endian_le64, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_CURSOR_NUMBER(be_u64, uint64_t, 64, conv_endian_be64, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_CURSOR_NUMBER(le_s64, int64_t, 64, conv_endian_le64, CONV_ENDIAN_CURSOR_S64, CONV_ENDIAN_CURSOR_U64)
+CONV_ENDIAN_CURSOR_NUMBER(be_s64, int64_t, 64, conv_endian_be64, CONV_ENDIAN_CURSOR_S64, CONV_ENDIAN_CURSOR_U64)
+CONV_ENDIAN_CURSOR_NUMBER(le_f64, double, 64, conv_endian_le64, conv_endian_bits_f64, conv_endian_f64_bits)
+CONV_ENDIAN_CURSOR_NUMBER(be_f64, double, 64, conv_endian_be64, conv_endian_bits_f64, conv_endian_f64_bits)
+
+/*
+
+    Packed and 16-bit floating point numbers
+
+    These are made of the numbers above, CONV_ENDIAN_CURSOR_COMPOSITE
+    defines the checked functions on top of the _unchecked ones
+
+*/
+
+#define CONV_ENDIAN_CURSOR_COMPOSITE(name, type, bytes) \
+    static CONV_ENDIAN_INLINE type conv_endian_get_##name(conv_endian_reader* reader) \
+    { \
+        if (!conv_endian_reader_reserve(reader, bytes)) \
+        { \
+            type none; \
+            memset(&none, 0, sizeof(none)); \
+            return none; \
+        } \
+        return conv_endian_get_##name##_unchecked(reader); \
+    } \
+    static CONV_ENDIAN_INLINE void conv_endian_put_##name(conv_endian_writer* writer, type val) \
+    { \
+        if (conv_endian_writer_reserve(writer, bytes)) \
+            conv_endian_put_##name##_unchecked(writer, val); \
+    }
+
+static CONV_ENDIAN_INLINE uint32_t conv_endian_get_le_u24_unchecked(conv_endian_reader* reader)
+{
+    uint32_t lo = conv_endian_get_le_u16_unchecked(reader);
+    return lo | ((uint32_t)conv_endian_get_u8_unchecked(reader) << 16);
+}
+
+static CONV_ENDIAN_INLINE uint32_t conv_endian_get_be_u24_unchecked(conv_endian_reader* reader)
+{
+    uint32_t hi = conv_endian_get_be_u16_unchecked(reader);
+    return (hi << 8) | conv_endian_get_u8_unchecked(reader);
+}
+
+static CONV_ENDIAN_INLINE int32_t conv_endian_get_le_s24_unchecked(conv_endian_reader* reader)
+{
+    return (int32_t)(conv_endian_get_le_u24_unchecked(reader) ^ 0x800000) - 0x800000;
+}
+
+static CONV_ENDIAN_INLINE int32_t conv_endian_get_be_s24_unchecked(conv_endian_reader* reader)
+{
+    return (int32_t)(conv_endian_get_be_u24_unchecked(reader) ^ 0x800000) - 0x800000;
+}
+
+static CONV_ENDIAN_INLINE uint64_t conv_endian_get_le_u48_unchecked(conv_endian_reader* reader)
+{
+    uint64_t lo = conv_endian_get_le_u32_unchecked(reader);
+    return lo | ((uint64_t)conv_endian_get_le_u16_unchecked(reader) << 32);
+}
+
+static CONV_ENDIAN_INLINE uint64_t conv_endian_get_be_u48_unchecked(conv_endian_reader* reader)
+{
+    uint64_t hi = conv_endian_get_be_u32_unchecked(reader);
+    return (hi << 16) | conv_endian_get_be_u16_unchecked(reader);
+}
+
+static CONV_ENDIAN_INLINE int64_t conv_endian_get_le_s48_unchecked(conv_endian_reader* reader)
+{
+    return (int64_t)(conv_endian_get_le_u48_unchecked(reader) ^ 0x800000000000) - 0x800000000000;
+}
+
+static CONV_ENDIAN_INLINE int64_t conv_endian_get_be_s48_unchecked(conv_endian_reader* reader)
+{
+    return (int64_t)(conv_endian_get_be_u48_unchecked(reader) ^ 0x800000000000) - 0x800000000000;
+}
+
+static CONV_ENDIAN_INLINE conv_endian_u128 conv_endian_get_le_u128_unchecked(conv_endian_reader* reader)
+{
+    conv_endian_u128 val;
+    val.lo = conv_endian_get_le_u64_unchecked(reader);
+    val.hi = conv_endian_get_le_u64_unchecked(reader);
+    return val;
+}
+
+static CONV_ENDIAN_INLINE conv_endian_u128 conv_endian_get_be_u128_unchecked(conv_endian_reader* reader)
+{
+    conv_endian_u128 val;
+    val.hi = conv_endian_get_be_u64_unchecked(reader);
+    val.lo = conv_endian_get_be_u64_unchecked(reader);
+    return val;
+}
+
+static CONV_ENDIAN_INLINE float conv_endian_get_le_f16_unchecked(conv_endian_reader* reader)
+{
+    return conv_endian_half_to_float(conv_endian_get_le_u16_unchecked(reader));
+}
+
+static CONV_ENDIAN_INLINE float conv_endian_get_be_f16_unchecked(conv_endian_reader* reader)
+{
+    return conv_endian_half_to_float(conv_endian_get_be_u16_unchecked(reader));
+}
+
+static CONV_ENDIAN_INLINE float conv_endian_get_le_bf16_unchecked(conv_endian_reader* reader)
+{
+    return conv_endian_bfloat_to_float(conv_endian_get_le_u16_unchecked(reader));
+}
+
+static CONV_ENDIAN_INLINE float conv_endian_get_be_bf16_unchecked(conv_endian_reader* reader)
+{
+    return conv_endian_bfloat_to_float(conv_endian_get_be_u16_unchecked(reader));
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_le_u24_unchecked(conv_endian_writer* writer, uint32_t val)
+{
+    conv_endian_put_le_u16_unchecked(writer, (uint16_t)val);
+    conv_endian_put_u8_unchecked(writer, (uint8_t)(val >> 16));
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_be_u24_unchecked(conv_endian_writer* writer, uint32_t val)
+{
+    conv_endian_put_be_u16_unchecked(writer, (uint16_t)(val >> 8));
+    conv_endian_put_u8_unchecked(writer, (uint8_t)val);
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_le_s24_unchecked(conv_endian_writer* writer, int32_t val)
+{
+    conv_endian_put_le_u24_unchecked(writer, (uint32_t)val);
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_be_s24_unchecked(conv_endian_writer* writer, int32_t val)
+{
+    conv_endian_put_be_u24_unchecked(writer, (uint32_t)val);
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_le_u48_unchecked(conv_endian_writer* writer, uint64_t val)
+{
+    conv_endian_put_le_u32_unchecked(writer, (uint32_t)val);
+    conv_endian_put_le_u16_unchecked(writer, (uint16_t)(val >> 32));
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_be_u48_unchecked(conv_endian_writer* writer, uint64_t val)
+{
+    conv_endian_put_be_u32_unchecked(writer, (uint32_t)(val >> 16));
+    conv_endian_put_be_u16_unchecked(writer, (uint16_t)val);
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_le_s48_unchecked(conv_endian_writer* writer, int64_t val)
+{
+    conv_endian_put_le_u48_unchecked(writer, (uint64_t)val);
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_be_s48_unchecked(conv_endian_writer* writer, int64_t val)
+{
+    conv_endian_put_be_u48_unchecked(writer, (uint64_t)val);
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_le_u128_unchecked(conv_endian_writer* writer, conv_endian_u128 val)
+{
+    conv_endian_put_le_u64_unchecked(writer, val.lo);
+    conv_endian_put_le_u64_unchecked(writer, val.hi);
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_be_u128_unchecked(conv_endian_writer* writer, conv_endian_u128 val)
+{
+    conv_endian_put_be_u64_unchecked(writer, val.hi);
+    conv_endian_put_be_u64_unchecked(writer, val.lo);
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_le_f16_unchecked(conv_endian_writer* writer, float val)
+{
+    conv_endian_put_le_u16_unchecked(writer, conv_endian_float_to_half(val));
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_be_f16_unchecked(conv_endian_writer* writer, float val)
+{
+    conv_endian_put_be_u16_unchecked(writer, conv_endian_float_to_half(val));
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_le_bf16_unchecked(conv_endian_writer* writer, float val)
+{
+    conv_endian_put_le_u16_unchecked(writer, conv_endian_float_to_bfloat(val));
+}
+
+static CONV_ENDIAN_INLINE void conv_endian_put_be_bf16_unchecked(conv_endian_writer* writer, float val)
+{
+    conv_endian_put_be_u16_unchecked(writer, conv_endian_float_to_bfloat(val));
+}
+
+CONV_ENDIAN_CURSOR_COMPOSITE(le_u24, uint32_t, 3)
+CONV_ENDIAN_CURSOR_COMPOSITE(be_u24, uint32_t, 3)
+CONV_ENDIAN_CURSOR_COMPOSITE(le_s24, int32_t, 3)
+CONV_ENDIAN_CURSOR_COMPOSITE(be_s24, int32_t, 3)
+CONV_ENDIAN_CURSOR_COMPOSITE(le_u48, uint64_t, 6)
+CONV_ENDIAN_CURSOR_COMPOSITE(be_u48, uint64_t, 6)
+CONV_ENDIAN_CURSOR_COMPOSITE(le_s48, int64_t, 6)
+CONV_ENDIAN_CURSOR_COMPOSITE(be_s48, int64_t, 6)
+CONV_ENDIAN_CURSOR_COMPOSITE(le_u128, conv_endian_u128, 16)
+CONV_ENDIAN_CURSOR_COMPOSITE(be_u128, conv_endian_u128, 16)
+CONV_ENDIAN_CURSOR_COMPOSITE(le_f16, float, 2)
+CONV_ENDIAN_CURSOR_COMPOSITE(be_f16, float, 2)
+CONV_ENDIAN_CURSOR_COMPOSITE(le_bf16, float, 2)
+CONV_ENDIAN_CURSOR_COMPOSITE(be_bf16, float, 2)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
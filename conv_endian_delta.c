@@ -0,0 +1,695 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_delta.c
+/// @brief A C portable source code that contains implementation of functions for decoding and encoding delta coded arrays
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Scalar coding
+
+    Values are kept in 64-bit integers whatever their width, since sums and
+    differences modulo 2^64 are also correct modulo 2^32 once 32-bit
+    values are truncated when they are stored.
+
+*/
+
+static uint64_t delta_load(const unsigned char* ptr, size_t width, int big)
+{
+    if (width == 4)
+        return big ? load_be_u32(ptr) : load_le_u32(ptr);
+
+    return big ? load_be_u64(ptr) : load_le_u64(ptr);
+}
+
+static void delta_store(unsigned char* ptr, uint64_t val, size_t width, int big)
+{
+    if (width == 4)
+    {
+        if (big)
+            store_be_u32(ptr, (uint32_t)val);
+        else
+            store_le_u32(ptr, (uint32_t)val);
+    }
+    else if (big)
+        store_be_u64(ptr, val);
+    else
+        store_le_u64(ptr, val);
+}
+
+static uint64_t host_load(const unsigned char* ptr, size_t width)
+{
+    if (width == 4)
+    {
+        uint32_t val;
+        memcpy(&val, ptr, 4);
+        return val;
+    }
+    else
+    {
+        uint64_t val;
+        memcpy(&val, ptr, 8);
+        return val;
+    }
+}
+
+static void host_store(unsigned char* ptr, uint64_t val, size_t width)
+{
+    if (width == 4)
+    {
+        uint32_t narrow = (uint32_t)val;
+        memcpy(ptr, &narrow, 4);
+    }
+    else
+        memcpy(ptr, &val, 8);
+}
+
+static void decode_one(unsigned char* dst, const unsigned char* src, size_t width, int big, conv_endian_delta_coding coding, conv_endian_delta_state* state)
+{
+    uint64_t val = delta_load(src, width, big);
+
+    if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+        val = (val >> 1) ^ (0 - (val & 1));
+
+    if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+    {
+        state->delta += val;
+        val = state->delta;
+    }
+
+    state->last += val;
+    host_store(dst, state->last, width);
+}
+
+static void encode_one(unsigned char* dst, uint64_t val, size_t width, int big, conv_endian_delta_coding coding, conv_endian_delta_state* state)
+{
+    uint64_t diff = val - state->last;
+
+    state->last = val;
+
+    if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+    {
+        uint64_t delta = diff;
+        diff -= state->delta;
+        state->delta = delta;
+    }
+
+    if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+        diff = (diff << 1) ^ (0 - ((diff >> (8 * width - 1)) & 1));
+
+    delta_store(dst, diff, width, big);
+}
+
+/*
+
+    Vector kernels
+
+    Decoding adds up a register of differences with a prefix sum of
+    log2(lanes) shifted additions, adds the last value of the previous
+    register, which is kept broadcast into every lane, and broadcasts its
+    own last value for the next one. Delta of delta coding does the same
+    twice. AVX2 shifts only move lanes within 16-byte halves, so the last
+    value of the lower half is added into the upper half afterwards.
+
+    Encoding has no dependency between values: every register of
+    differences is the source minus the source loaded one and two values
+    earlier. The caller encodes the first values of the array itself.
+
+    Each kernel returns the number of values it has converted so that the
+    caller can finish the rest one at a time.
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i swap_mask_128(size_t width, int big)
+{
+    if (!big)
+        return _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    if (width == 4)
+        return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i scan32_128(__m128i val)
+{
+    val = _mm_add_epi32(val, _mm_slli_si128(val, 4));
+    return _mm_add_epi32(val, _mm_slli_si128(val, 8));
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t decode_ssse3(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, conv_endian_delta_coding coding, conv_endian_delta_state* state)
+{
+    __m128i mask = swap_mask_128(width, big);
+    __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    if (width == 4)
+    {
+        __m128i one = _mm_set1_epi32(1);
+        __m128i last = _mm_set1_epi32((int)(uint32_t)state->last);
+        __m128i delta = _mm_set1_epi32((int)(uint32_t)state->delta);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 4)), mask);
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm_xor_si128(_mm_srli_epi32(val, 1), _mm_sub_epi32(zero, _mm_and_si128(val, one)));
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+            {
+                val = _mm_add_epi32(scan32_128(val), delta);
+                delta = _mm_shuffle_epi32(val, 0xFF);
+            }
+
+            last = _mm_add_epi32(scan32_128(val), last);
+            _mm_storeu_si128((__m128i*)(dst + i * 4), last);
+            last = _mm_shuffle_epi32(last, 0xFF);
+        }
+
+        state->last = (uint32_t)_mm_cvtsi128_si32(last);
+        state->delta = (uint32_t)_mm_cvtsi128_si32(delta);
+    }
+    else
+    {
+        __m128i one = _mm_set_epi32(0, 1, 0, 1);
+        __m128i last = _mm_set1_epi64x((long long)state->last);
+        __m128i delta = _mm_set1_epi64x((long long)state->delta);
+
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 8)), mask);
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm_xor_si128(_mm_srli_epi64(val, 1), _mm_sub_epi64(zero, _mm_and_si128(val, one)));
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+            {
+                val = _mm_add_epi64(_mm_add_epi64(val, _mm_slli_si128(val, 8)), delta);
+                delta = _mm_shuffle_epi32(val, 0xEE);
+            }
+
+            last = _mm_add_epi64(_mm_add_epi64(val, _mm_slli_si128(val, 8)), last);
+            _mm_storeu_si128((__m128i*)(dst + i * 8), last);
+            last = _mm_shuffle_epi32(last, 0xEE);
+        }
+
+        _mm_storel_epi64((__m128i*)&state->last, last);
+        _mm_storel_epi64((__m128i*)&state->delta, delta);
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t encode_ssse3(unsigned char* dst, const unsigned char* src, size_t start, size_t count, size_t width, int big, conv_endian_delta_coding coding)
+{
+    __m128i mask = swap_mask_128(width, big);
+    __m128i zero = _mm_setzero_si128();
+    size_t i = start;
+
+    if (width == 4)
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i prev = _mm_loadu_si128((const __m128i*)(src + i * 4 - 4));
+            __m128i val = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(src + i * 4)), prev);
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+                val = _mm_sub_epi32(val, _mm_sub_epi32(prev, _mm_loadu_si128((const __m128i*)(src + i * 4 - 8))));
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm_xor_si128(_mm_slli_epi32(val, 1), _mm_sub_epi32(zero, _mm_srli_epi32(val, 31)));
+
+            _mm_storeu_si128((__m128i*)(dst + i * 4), _mm_shuffle_epi8(val, mask));
+        }
+    }
+    else
+    {
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128i prev = _mm_loadu_si128((const __m128i*)(src + i * 8 - 8));
+            __m128i val = _mm_sub_epi64(_mm_loadu_si128((const __m128i*)(src + i * 8)), prev);
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+                val = _mm_sub_epi64(val, _mm_sub_epi64(prev, _mm_loadu_si128((const __m128i*)(src + i * 8 - 16))));
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm_xor_si128(_mm_slli_epi64(val, 1), _mm_sub_epi64(zero, _mm_srli_epi64(val, 63)));
+
+            _mm_storeu_si128((__m128i*)(dst + i * 8), _mm_shuffle_epi8(val, mask));
+        }
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static __m256i scan32_256(__m256i val)
+{
+    val = _mm256_add_epi32(val, _mm256_slli_si256(val, 4));
+    val = _mm256_add_epi32(val, _mm256_slli_si256(val, 8));
+    return _mm256_add_epi32(val, _mm256_blend_epi32(_mm256_setzero_si256(), _mm256_permutevar8x32_epi32(val, _mm256_set1_epi32(3)), 0xF0));
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static __m256i scan64_256(__m256i val)
+{
+    val = _mm256_add_epi64(val, _mm256_slli_si256(val, 8));
+    return _mm256_add_epi64(val, _mm256_blend_epi32(_mm256_setzero_si256(), _mm256_permute4x64_epi64(val, 0x55), 0xF0));
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t decode_avx2(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, conv_endian_delta_coding coding, conv_endian_delta_state* state)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(swap_mask_128(width, big));
+    __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+
+    if (width == 4)
+    {
+        __m256i one = _mm256_set1_epi32(1);
+        __m256i top = _mm256_set1_epi32(7);
+        __m256i last = _mm256_set1_epi32((int)(uint32_t)state->last);
+        __m256i delta = _mm256_set1_epi32((int)(uint32_t)state->delta);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 4)), mask);
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm256_xor_si256(_mm256_srli_epi32(val, 1), _mm256_sub_epi32(zero, _mm256_and_si256(val, one)));
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+            {
+                val = _mm256_add_epi32(scan32_256(val), delta);
+                delta = _mm256_permutevar8x32_epi32(val, top);
+            }
+
+            last = _mm256_add_epi32(scan32_256(val), last);
+            _mm256_storeu_si256((__m256i*)(dst + i * 4), last);
+            last = _mm256_permutevar8x32_epi32(last, top);
+        }
+
+        state->last = (uint32_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(last));
+        state->delta = (uint32_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(delta));
+    }
+    else
+    {
+        __m256i one = _mm256_set1_epi64x(1);
+        __m256i last = _mm256_set1_epi64x((long long)state->last);
+        __m256i delta = _mm256_set1_epi64x((long long)state->delta);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 8)), mask);
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm256_xor_si256(_mm256_srli_epi64(val, 1), _mm256_sub_epi64(zero, _mm256_and_si256(val, one)));
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+            {
+                val = _mm256_add_epi64(scan64_256(val), delta);
+                delta = _mm256_permute4x64_epi64(val, 0xFF);
+            }
+
+            last = _mm256_add_epi64(scan64_256(val), last);
+            _mm256_storeu_si256((__m256i*)(dst + i * 8), last);
+            last = _mm256_permute4x64_epi64(last, 0xFF);
+        }
+
+        _mm_storel_epi64((__m128i*)&state->last, _mm256_castsi256_si128(last));
+        _mm_storel_epi64((__m128i*)&state->delta, _mm256_castsi256_si128(delta));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t encode_avx2(unsigned char* dst, const unsigned char* src, size_t start, size_t count, size_t width, int big, conv_endian_delta_coding coding)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(swap_mask_128(width, big));
+    __m256i zero = _mm256_setzero_si256();
+    size_t i = start;
+
+    if (width == 4)
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i prev = _mm256_loadu_si256((const __m256i*)(src + i * 4 - 4));
+            __m256i val = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)(src + i * 4)), prev);
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+                val = _mm256_sub_epi32(val, _mm256_sub_epi32(prev, _mm256_loadu_si256((const __m256i*)(src + i * 4 - 8))));
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm256_xor_si256(_mm256_slli_epi32(val, 1), _mm256_sub_epi32(zero, _mm256_srli_epi32(val, 31)));
+
+            _mm256_storeu_si256((__m256i*)(dst + i * 4), _mm256_shuffle_epi8(val, mask));
+        }
+    }
+    else
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256i prev = _mm256_loadu_si256((const __m256i*)(src + i * 8 - 8));
+            __m256i val = _mm256_sub_epi64(_mm256_loadu_si256((const __m256i*)(src + i * 8)), prev);
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+                val = _mm256_sub_epi64(val, _mm256_sub_epi64(prev, _mm256_loadu_si256((const __m256i*)(src + i * 8 - 16))));
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm256_xor_si256(_mm256_slli_epi64(val, 1), _mm256_sub_epi64(zero, _mm256_srli_epi64(val, 63)));
+
+            _mm256_storeu_si256((__m256i*)(dst + i * 8), _mm256_shuffle_epi8(val, mask));
+        }
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static __m512i scan32_512(__m512i val)
+{
+    __m512i zero = _mm512_setzero_si512();
+
+    val = _mm512_add_epi32(val, _mm512_alignr_epi32(val, zero, 15));
+    val = _mm512_add_epi32(val, _mm512_alignr_epi32(val, zero, 14));
+    val = _mm512_add_epi32(val, _mm512_alignr_epi32(val, zero, 12));
+    return _mm512_add_epi32(val, _mm512_alignr_epi32(val, zero, 8));
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static __m512i scan64_512(__m512i val)
+{
+    __m512i zero = _mm512_setzero_si512();
+
+    val = _mm512_add_epi64(val, _mm512_alignr_epi64(val, zero, 7));
+    val = _mm512_add_epi64(val, _mm512_alignr_epi64(val, zero, 6));
+    return _mm512_add_epi64(val, _mm512_alignr_epi64(val, zero, 4));
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t decode_avx512(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, conv_endian_delta_coding coding, conv_endian_delta_state* state)
+{
+    __m512i mask = _mm512_broadcast_i32x4(swap_mask_128(width, big));
+    __m512i zero = _mm512_setzero_si512();
+    size_t i = 0;
+
+    if (width == 4)
+    {
+        __m512i one = _mm512_set1_epi32(1);
+        __m512i top = _mm512_set1_epi32(15);
+        __m512i last = _mm512_set1_epi32((int)(uint32_t)state->last);
+        __m512i delta = _mm512_set1_epi32((int)(uint32_t)state->delta);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i val = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*)(src + i * 4)), mask);
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm512_xor_si512(_mm512_srli_epi32(val, 1), _mm512_sub_epi32(zero, _mm512_and_si512(val, one)));
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+            {
+                val = _mm512_add_epi32(scan32_512(val), delta);
+                delta = _mm512_permutexvar_epi32(top, val);
+            }
+
+            last = _mm512_add_epi32(scan32_512(val), last);
+            _mm512_storeu_si512((void*)(dst + i * 4), last);
+            last = _mm512_permutexvar_epi32(top, last);
+        }
+
+        state->last = (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(last));
+        state->delta = (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(delta));
+    }
+    else
+    {
+        __m512i one = _mm512_set1_epi64(1);
+        __m512i top = _mm512_set1_epi64(7);
+        __m512i last = _mm512_set1_epi64((long long)state->last);
+        __m512i delta = _mm512_set1_epi64((long long)state->delta);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m512i val = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*)(src + i * 8)), mask);
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm512_xor_si512(_mm512_srli_epi64(val, 1), _mm512_sub_epi64(zero, _mm512_and_si512(val, one)));
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+            {
+                val = _mm512_add_epi64(scan64_512(val), delta);
+                delta = _mm512_permutexvar_epi64(top, val);
+            }
+
+            last = _mm512_add_epi64(scan64_512(val), last);
+            _mm512_storeu_si512((void*)(dst + i * 8), last);
+            last = _mm512_permutexvar_epi64(top, last);
+        }
+
+        _mm_storel_epi64((__m128i*)&state->last, _mm512_castsi512_si128(last));
+        _mm_storel_epi64((__m128i*)&state->delta, _mm512_castsi512_si128(delta));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t encode_avx512(unsigned char* dst, const unsigned char* src, size_t start, size_t count, size_t width, int big, conv_endian_delta_coding coding)
+{
+    __m512i mask = _mm512_broadcast_i32x4(swap_mask_128(width, big));
+    __m512i zero = _mm512_setzero_si512();
+    size_t i = start;
+
+    if (width == 4)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i prev = _mm512_loadu_si512((const void*)(src + i * 4 - 4));
+            __m512i val = _mm512_sub_epi32(_mm512_loadu_si512((const void*)(src + i * 4)), prev);
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+                val = _mm512_sub_epi32(val, _mm512_sub_epi32(prev, _mm512_loadu_si512((const void*)(src + i * 4 - 8))));
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm512_xor_si512(_mm512_slli_epi32(val, 1), _mm512_sub_epi32(zero, _mm512_srli_epi32(val, 31)));
+
+            _mm512_storeu_si512((void*)(dst + i * 4), _mm512_shuffle_epi8(val, mask));
+        }
+    }
+    else
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m512i prev = _mm512_loadu_si512((const void*)(src + i * 8 - 8));
+            __m512i val = _mm512_sub_epi64(_mm512_loadu_si512((const void*)(src + i * 8)), prev);
+
+            if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+                val = _mm512_sub_epi64(val, _mm512_sub_epi64(prev, _mm512_loadu_si512((const void*)(src + i * 8 - 16))));
+
+            if (coding & CONV_ENDIAN_DELTA_ZIGZAG)
+                val = _mm512_xor_si512(_mm512_slli_epi64(val, 1), _mm512_sub_epi64(zero, _mm512_srli_epi64(val, 63)));
+
+            _mm512_storeu_si512((void*)(dst + i * 8), _mm512_shuffle_epi8(val, mask));
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+/*
+
+    Kernel selection
+
+*/
+
+static size_t delta_decode(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, conv_endian_delta_coding coding, conv_endian_delta_state* state)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return decode_avx512(dst, src, count, width, big, coding, state);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return decode_avx2(dst, src, count, width, big, coding, state);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        return decode_ssse3(dst, src, count, width, big, coding, state);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)width;
+    (void)big;
+    (void)coding;
+    (void)state;
+    return 0;
+}
+
+static size_t delta_encode(unsigned char* dst, const unsigned char* src, size_t start, size_t count, size_t width, int big, conv_endian_delta_coding coding)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return encode_avx512(dst, src, start, count, width, big, coding);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return encode_avx2(dst, src, start, count, width, big, coding);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        return encode_ssse3(dst, src, start, count, width, big, coding);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)width;
+    (void)big;
+    (void)coding;
+    return start;
+}
+
+/*
+
+    Delta coding
+
+*/
+
+static int delta_supported(size_t width, conv_endian_delta_coding coding)
+{
+    return (width == 4 || width == 8) && (unsigned)coding <= CONV_ENDIAN_DELTA_OF_DELTA_ZIGZAG;
+}
+
+static void delta_finish(conv_endian_delta_state* state, size_t width)
+{
+    if (width == 4)
+    {
+        state->last = (uint32_t)state->last;
+        state->delta = (uint32_t)state->delta;
+    }
+}
+
+/// @brief Decodes an array of delta coded unsigned integer numbers
+/// @param dst array that receives count values in their endianness of their machine, may be the same array as src
+/// @param src array of count stored differences
+/// @param count number of values in src
+/// @param width number of bytes in a value: 4 or 8
+/// @param order endianness of the stored differences
+/// @param coding how the differences are stored
+/// @param state state of the series before src, updated to the end of src, or NULL for a series that starts and ends in src
+/// @return 0 on success or -1 if width or coding is not supported
+int conv_endian_delta_decode(void* dst, const void* src, size_t count, size_t width, conv_endian_order order, conv_endian_delta_coding coding, conv_endian_delta_state* state)
+{
+    unsigned char* out = (unsigned char*)dst;
+    const unsigned char* in = (const unsigned char*)src;
+    int big = order == CONV_ENDIAN_ORDER_BIG;
+    conv_endian_delta_state start = {0, 0};
+    size_t i;
+
+    if (!delta_supported(width, coding))
+        return -1;
+
+    if (state == NULL)
+        state = &start;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_DELTA_DECODE, count * width);
+
+    for (i = delta_decode(out, in, count, width, big, coding, state); i < count; i++)
+        decode_one(out + i * width, in + i * width, width, big, coding, state);
+
+    delta_finish(state, width);
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_DELTA_DECODE, count * width);
+    return 0;
+}
+
+/// @brief Encodes an array of unsigned integer numbers as delta coded numbers
+/// @param dst array that receives count stored differences, must not overlap src
+/// @param src array of count values in their endianness of their machine
+/// @param count number of values in src
+/// @param width number of bytes in a value: 4 or 8
+/// @param order endianness the differences are stored in
+/// @param coding how the differences are stored
+/// @param state state of the series before src, updated to the end of src, or NULL for a series that starts and ends in src
+/// @return 0 on success or -1 if width or coding is not supported
+int conv_endian_delta_encode(void* dst, const void* src, size_t count, size_t width, conv_endian_order order, conv_endian_delta_coding coding, conv_endian_delta_state* state)
+{
+    unsigned char* out = (unsigned char*)dst;
+    const unsigned char* in = (const unsigned char*)src;
+    int big = order == CONV_ENDIAN_ORDER_BIG;
+    size_t lead = (coding & CONV_ENDIAN_DELTA_OF_DELTA) ? 2 : 1;
+    conv_endian_delta_state start = {0, 0};
+    size_t i, end;
+
+    if (!delta_supported(width, coding))
+        return -1;
+
+    if (state == NULL)
+        state = &start;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_DELTA_ENCODE, count * width);
+
+    // the kernels take the differences with the values before them in src
+    for (i = 0; i < count && i < lead; i++)
+        encode_one(out + i * width, host_load(in + i * width, width), width, big, coding, state);
+
+    end = delta_encode(out, in, i, count, width, big, coding);
+
+    if (end > i)
+    {
+        i = end;
+        state->last = host_load(in + (i - 1) * width, width);
+
+        if (coding & CONV_ENDIAN_DELTA_OF_DELTA)
+            state->delta = state->last - host_load(in + (i - 2) * width, width);
+    }
+
+    for (; i < count; i++)
+        encode_one(out + i * width, host_load(in + i * width, width), width, big, coding, state);
+
+    delta_finish(state, width);
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_DELTA_ENCODE, count * width);
+    return 0;
+}
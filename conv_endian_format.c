@@ -0,0 +1,518 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_format.c
+/// @brief A C portable source code that contains implementation of functions for converting records described by a format string
+
+
+#include "conv_endian_format.h"
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+
+    Compiled plans
+
+*/
+
+/// @brief A run of neighbouring numbers of the same width in a record
+typedef struct format_run
+{
+    size_t offset; ///< offset of the first number in the record
+    size_t width; ///< width of every number, 1 for bytes that are only copied
+    size_t count; ///< number of numbers in the run
+} format_run;
+
+struct conv_endian_format
+{
+    size_t size; ///< number of bytes in a record
+    int swap; ///< 0 when the format is in their endianness of their machine
+    size_t uniform_width; ///< width of every number when the record has no bytes that are only copied, 0 otherwise
+    format_run* runs;
+    size_t run_count;
+    uint16_t* perm; ///< byte permutation of a record, NULL when the record is too large
+    int fits_shuffles; ///< whether perm can be done with byte shuffles
+};
+
+// arrays smaller than this are not worth setting up the shuffle masks for
+#define FORMAT_SHUFFLE_MIN_BYTES 256
+
+// runs at least this long are converted with the bulk byte swapping functions
+#define FORMAT_BULK_MIN_COUNT 16
+
+static int format_add_run(conv_endian_format* format, size_t* capacity, size_t width, size_t count)
+{
+    format_run* last = format->run_count > 0 ? &format->runs[format->run_count - 1] : NULL;
+
+    if (count == 0)
+        return 0;
+
+    // neighbouring fields of the same width are converted as one run
+    if (last != NULL && last->width == width)
+    {
+        last->count += count;
+        format->size += width * count;
+        return 0;
+    }
+
+    if (format->run_count == *capacity)
+    {
+        size_t new_capacity = *capacity == 0 ? 8 : *capacity * 2;
+        format_run* runs = (format_run*)realloc(format->runs, new_capacity * sizeof(format_run));
+
+        if (runs == NULL)
+            return -1;
+
+        format->runs = runs;
+        *capacity = new_capacity;
+    }
+
+    format->runs[format->run_count].offset = format->size;
+    format->runs[format->run_count].width = width;
+    format->runs[format->run_count].count = count;
+    format->run_count++;
+    format->size += width * count;
+
+    return 0;
+}
+
+static int format_parse(conv_endian_format* format, const char* fmt)
+{
+    size_t capacity = 0;
+    const char* p = fmt;
+
+    switch (*p)
+    {
+    case '<':
+        format->swap = !conv_endian_host_is_little();
+        p++;
+        break;
+    case '>':
+    case '!':
+        format->swap = conv_endian_host_is_little();
+        p++;
+        break;
+    case '=':
+    case '@':
+        format->swap = 0;
+        p++;
+        break;
+    default:
+        format->swap = 0;
+        break;
+    }
+
+    while (*p != '\0')
+    {
+        size_t count = 1;
+        size_t width;
+
+        if (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')
+        {
+            p++;
+            continue;
+        }
+
+        if (*p >= '0' && *p <= '9')
+        {
+            count = 0;
+            while (*p >= '0' && *p <= '9')
+            {
+                if (count > (SIZE_MAX - 9) / 10)
+                    return -1;
+                count = count * 10 + (size_t)(*p - '0');
+                p++;
+            }
+        }
+
+        switch (*p)
+        {
+        case 'x':
+        case 'c':
+        case 'b':
+        case 'B':
+        case '?':
+        case 's':
+        case 'p':
+            width = 1;
+            break;
+        case 'h':
+        case 'H':
+        case 'e':
+            width = 2;
+            break;
+        case 'i':
+        case 'I':
+        case 'l':
+        case 'L':
+        case 'f':
+            width = 4;
+            break;
+        case 'q':
+        case 'Q':
+        case 'd':
+            width = 8;
+            break;
+        default:
+            return -1;
+        }
+
+        if (count > (SIZE_MAX - format->size) / width)
+            return -1;
+
+        if (format_add_run(format, &capacity, width, count) != 0)
+            return -1;
+
+        p++;
+    }
+
+    return format->size == 0 ? -1 : 0;
+}
+
+static void format_plan(conv_endian_format* format)
+{
+    size_t i, j, k;
+
+    format->uniform_width = format->runs[0].width;
+    for (i = 1; i < format->run_count; i++)
+    {
+        if (format->runs[i].width != format->uniform_width)
+            format->uniform_width = 0;
+    }
+
+    if (format->uniform_width == 1)
+        format->uniform_width = 0;
+
+    if (format->size > 65535)
+        return;
+
+    format->perm = (uint16_t*)malloc(format->size * sizeof(uint16_t));
+    if (format->perm == NULL)
+        return;
+
+    for (i = 0; i < format->run_count; i++)
+    {
+        const format_run* run = &format->runs[i];
+
+        for (j = 0; j < run->count; j++)
+        {
+            size_t offset = run->offset + j * run->width;
+
+            for (k = 0; k < run->width; k++)
+                format->perm[offset + k] = (uint16_t)(offset + run->width - 1 - k);
+        }
+    }
+
+    format->fits_shuffles = conv_endian_permute_fits_shuffles(format->size, format->perm);
+}
+
+/// @brief Compiles a format string into a plan that is not cached
+/// @param fmt format string
+/// @return compiled plan that has to be released with conv_endian_format_free, or NULL if fmt is not a valid format string or memory could not be allocated
+conv_endian_format* conv_endian_format_compile(const char* fmt)
+{
+    conv_endian_format* format;
+
+    if (fmt == NULL)
+        return NULL;
+
+    format = (conv_endian_format*)calloc(1, sizeof(conv_endian_format));
+    if (format == NULL)
+        return NULL;
+
+    if (format_parse(format, fmt) != 0)
+    {
+        conv_endian_format_free(format);
+        return NULL;
+    }
+
+    format_plan(format);
+
+    return format;
+}
+
+/// @brief Releases a plan returned by conv_endian_format_compile
+/// @param format plan to be released, may be NULL
+void conv_endian_format_free(conv_endian_format* format)
+{
+    if (format == NULL)
+        return;
+
+    free(format->runs);
+    free(format->perm);
+    free(format);
+}
+
+/// @brief Gets the number of bytes in a record of a format
+/// @param format compiled plan
+/// @return number of bytes in a record
+size_t conv_endian_format_size(const conv_endian_format* format)
+{
+    return format->size;
+}
+
+/*
+
+    Plan cache
+
+*/
+
+#define FORMAT_CACHE_BUCKETS 64
+
+typedef struct format_cache_entry
+{
+    struct format_cache_entry* next;
+    conv_endian_format* format;
+    char* fmt;
+} format_cache_entry;
+
+static format_cache_entry* format_cache[FORMAT_CACHE_BUCKETS];
+static conv_endian_lock format_cache_lock;
+
+static size_t format_hash(const char* fmt)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+
+    while (*fmt != '\0')
+    {
+        hash ^= (unsigned char)*fmt++;
+        hash *= 16777619u;
+    }
+
+    return hash % FORMAT_CACHE_BUCKETS;
+}
+
+/// @brief Gets the compiled plan of a format string, compiling it only the first time it is used
+/// @param fmt format string
+/// @return compiled plan that stays valid until conv_endian_format_cache_clear is called, or NULL if fmt is not a valid format string
+const conv_endian_format* conv_endian_format_get(const char* fmt)
+{
+    format_cache_entry* entry;
+    size_t bucket, length;
+
+    if (fmt == NULL)
+        return NULL;
+
+    bucket = format_hash(fmt);
+
+    conv_endian_lock_acquire(&format_cache_lock);
+
+    for (entry = format_cache[bucket]; entry != NULL; entry = entry->next)
+    {
+        if (strcmp(entry->fmt, fmt) == 0)
+        {
+            conv_endian_lock_release(&format_cache_lock);
+            return entry->format;
+        }
+    }
+
+    length = strlen(fmt);
+    entry = (format_cache_entry*)malloc(sizeof(format_cache_entry) + length + 1);
+    if (entry == NULL)
+    {
+        conv_endian_lock_release(&format_cache_lock);
+        return NULL;
+    }
+
+    entry->format = conv_endian_format_compile(fmt);
+    if (entry->format == NULL)
+    {
+        free(entry);
+        conv_endian_lock_release(&format_cache_lock);
+        return NULL;
+    }
+
+    entry->fmt = (char*)(entry + 1);
+    memcpy(entry->fmt, fmt, length + 1);
+    entry->next = format_cache[bucket];
+    format_cache[bucket] = entry;
+
+    conv_endian_lock_release(&format_cache_lock);
+
+    return entry->format;
+}
+
+/// @brief Releases every cached plan, no plan returned by conv_endian_format_get may be in use
+void conv_endian_format_cache_clear(void)
+{
+    size_t i;
+
+    conv_endian_lock_acquire(&format_cache_lock);
+
+    for (i = 0; i < FORMAT_CACHE_BUCKETS; i++)
+    {
+        format_cache_entry* entry = format_cache[i];
+
+        while (entry != NULL)
+        {
+            format_cache_entry* next = entry->next;
+            conv_endian_format_free(entry->format);
+            free(entry);
+            entry = next;
+        }
+
+        format_cache[i] = NULL;
+    }
+
+    conv_endian_lock_release(&format_cache_lock);
+}
+
+/*
+
+    Converting records
+
+    Packing and unpacking are the same operation since converting to and
+    from an endianness either swaps the bytes of every number or copies them
+
+*/
+
+static void convert_run(unsigned char* dst, const unsigned char* src, const format_run* run)
+{
+    size_t i;
+
+    switch (run->width)
+    {
+    case 1:
+        if (dst != src)
+            memcpy(dst, src, run->count);
+        break;
+    case 2:
+        if (run->count >= FORMAT_BULK_MIN_COUNT)
+        {
+            conv_endian_bswap16_array(dst, src, run->count);
+            break;
+        }
+        for (i = 0; i < run->count; i++)
+        {
+            uint16_t val;
+            memcpy(&val, src + i * 2, sizeof(val));
+            val = conv_endian_bswap16(val);
+            memcpy(dst + i * 2, &val, sizeof(val));
+        }
+        break;
+    case 4:
+        if (run->count >= FORMAT_BULK_MIN_COUNT)
+        {
+            conv_endian_bswap32_array(dst, src, run->count);
+            break;
+        }
+        for (i = 0; i < run->count; i++)
+        {
+            uint32_t val;
+            memcpy(&val, src + i * 4, sizeof(val));
+            val = conv_endian_bswap32(val);
+            memcpy(dst + i * 4, &val, sizeof(val));
+        }
+        break;
+    default:
+        if (run->count >= FORMAT_BULK_MIN_COUNT)
+        {
+            conv_endian_bswap64_array(dst, src, run->count);
+            break;
+        }
+        for (i = 0; i < run->count; i++)
+        {
+            uint64_t val;
+            memcpy(&val, src + i * 8, sizeof(val));
+            val = conv_endian_bswap64(val);
+            memcpy(dst + i * 8, &val, sizeof(val));
+        }
+        break;
+    }
+}
+
+static int format_convert(const conv_endian_format* format, void* dst, const void* src, size_t count)
+{
+    unsigned char* dst_bytes = (unsigned char*)dst;
+    const unsigned char* src_bytes = (const unsigned char*)src;
+    size_t bytes = count * format->size;
+    size_t i, j;
+
+    if (!format->swap || (format->run_count == 1 && format->runs[0].width == 1))
+    {
+        if (dst != src)
+            memmove(dst, src, bytes);
+        return 0;
+    }
+
+    // records made of numbers of one width are one long array of numbers
+    switch (format->uniform_width)
+    {
+    case 2:
+        conv_endian_bswap16_array(dst, src, bytes / 2);
+        return 0;
+    case 4:
+        conv_endian_bswap32_array(dst, src, bytes / 4);
+        return 0;
+    case 8:
+        conv_endian_bswap64_array(dst, src, bytes / 8);
+        return 0;
+    default:
+        break;
+    }
+
+    if (format->fits_shuffles && bytes >= FORMAT_SHUFFLE_MIN_BYTES && conv_endian_get_kernel() != CONV_ENDIAN_KERNEL_SCALAR)
+        return conv_endian_permute_records(dst, src, count, format->size, format->perm);
+
+    for (i = 0; i < count; i++)
+    {
+        size_t base = i * format->size;
+
+        for (j = 0; j < format->run_count; j++)
+        {
+            const format_run* run = &format->runs[j];
+            convert_run(dst_bytes + base + run->offset, src_bytes + base + run->offset, run);
+        }
+    }
+
+    return 0;
+}
+
+/// @brief Converts records from the endianness of a format into their endianness of their machine
+/// @param format compiled plan
+/// @param dst array that receives the converted records, may be the same array as src
+/// @param src array of records in the endianness of the format
+/// @param count number of records in src
+/// @return 0 on success or -1 if memory could not be allocated
+int conv_endian_unpack(const conv_endian_format* format, void* dst, const void* src, size_t count)
+{
+    return format_convert(format, dst, src, count);
+}
+
+/// @brief Converts records from their endianness of their machine into the endianness of a format
+/// @param format compiled plan
+/// @param dst array that receives the converted records, may be the same array as src
+/// @param src array of records in their endianness of their machine
+/// @param count number of records in src
+/// @return 0 on success or -1 if memory could not be allocated
+int conv_endian_pack(const conv_endian_format* format, void* dst, const void* src, size_t count)
+{
+    return format_convert(format, dst, src, count);
+}
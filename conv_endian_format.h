@@ -0,0 +1,117 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_format.h
+/// @brief A C portable header that contains declarations of functions for converting records described by a format string
+
+
+#ifndef CONV_ENDIAN_FORMAT_H
+#define CONV_ENDIAN_FORMAT_H
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+
+    Format strings
+
+    A format string describes a record the same way as the format strings
+    of Python's struct module, with standard sizes and no alignment:
+
+        <       little endian
+        > or !  big endian
+        = or @  endianness of their machine (also used without a prefix)
+
+        x       pad byte, copied without being converted
+        c b B ? 8-bit numbers, copied without being converted
+        s p     bytes, the count is the number of bytes
+        h H e   16-bit numbers (e is a half-precision floating point number)
+        i I l L 32-bit numbers
+        f       32-bit floating point number
+        q Q     64-bit numbers
+        d       64-bit floating point number
+
+    Every code may be preceded by a count, for example ">IhHd4xq" or
+    "<16H". Whitespace between codes is ignored.
+
+    A format is compiled once into a plan that merges neighbouring fields of
+    the same width and, where the layout allows it, into byte shuffle masks
+    for whole arrays of records. Unpacking converts records from the
+    endianness of the format into their endianness of their machine and
+    packing converts them back; the records keep the same layout.
+
+*/
+
+/// @brief A compiled format string
+typedef struct conv_endian_format conv_endian_format;
+
+/// @brief Gets the compiled plan of a format string, compiling it only the first time it is used
+/// @param fmt format string
+/// @return compiled plan that stays valid until conv_endian_format_cache_clear is called, or NULL if fmt is not a valid format string
+const conv_endian_format* conv_endian_format_get(const char* fmt);
+
+/// @brief Compiles a format string into a plan that is not cached
+/// @param fmt format string
+/// @return compiled plan that has to be released with conv_endian_format_free, or NULL if fmt is not a valid format string or memory could not be allocated
+conv_endian_format* conv_endian_format_compile(const char* fmt);
+
+/// @brief Releases a plan returned by conv_endian_format_compile
+/// @param format plan to be released, may be NULL
+void conv_endian_format_free(conv_endian_format* format);
+
+/// @brief Releases every cached plan, no plan returned by conv_endian_format_get may be in use
+void conv_endian_format_cache_clear(void);
+
+/// @brief Gets the number of bytes in a record of a format
+/// @param format compiled plan
+/// @return number of bytes in a record
+size_t conv_endian_format_size(const conv_endian_format* format);
+
+/// @brief Converts records from the endianness of a format into their endianness of their machine
+/// @param format compiled plan
+/// @param dst array that receives the converted records, may be the same array as src
+/// @param src array of records in the endianness of the format
+/// @param count number of records in src
+/// @return 0 on success or -1 if memory could not be allocated
+int conv_endian_unpack(const conv_endian_format* format, void* dst, const void* src, size_t count);
+
+/// @brief Converts records from their endianness of their machine into the endianness of a format
+/// @param format compiled plan
+/// @param dst array that receives the converted records, may be the same array as src
+/// @param src array of records in their endianness of their machine
+/// @param count number of records in src
+/// @return 0 on success or -1 if memory could not be allocated
+int conv_endian_pack(const conv_endian_format* format, void* dst, const void* src, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
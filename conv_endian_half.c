@@ -0,0 +1,497 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_half.c
+/// @brief A C portable source code that contains implementation of functions for converting arrays of 16-bit floating point numbers
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Vector kernels
+
+    Every kernel swaps the bytes of the 16-bit numbers with the same byte
+    shuffle that widens or narrows them, so an array is only read once.
+    The shuffle keeps the bytes in place for little endian arrays.
+
+    Half precision numbers are converted with F16C, which the AVX2 and
+    AVX-512 kernels require. bfloat16 numbers are the highest 16 bits of a
+    32-bit floating point number, so they only need integer instructions:
+    narrowing rounds to the nearest even number by adding 0x7FFF plus the
+    lowest bit that is kept, and sets the quiet bit of NaNs instead so
+    that rounding cannot turn them into infinities.
+
+    Each kernel returns the number of values it has converted so that the
+    caller can finish the rest one at a time.
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i swap_mask_128(int big)
+{
+    if (big)
+        return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    return _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+}
+
+// the highest 16 bits of four 32-bit numbers into the lowest 8 bytes
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i narrow_mask_128(int big)
+{
+    if (big)
+        return _mm_setr_epi8(3, 2, 7, 6, 11, 10, 15, 14, -128, -128, -128, -128, -128, -128, -128, -128);
+
+    return _mm_setr_epi8(2, 3, 6, 7, 10, 11, 14, 15, -128, -128, -128, -128, -128, -128, -128, -128);
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t bfloat_widen_ssse3(float* dst, const unsigned char* src, size_t count, int big)
+{
+    __m128i mask = swap_mask_128(big);
+    __m128i zero = _mm_setzero_si128();
+    size_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 2)), mask);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi16(zero, val));
+        _mm_storeu_si128((__m128i*)(dst + i + 4), _mm_unpackhi_epi16(zero, val));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i bfloat_round_ssse3(__m128i bits)
+{
+    __m128i lsb = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+    __m128i rounded = _mm_add_epi32(bits, _mm_add_epi32(lsb, _mm_set1_epi32(0x7FFF)));
+    __m128i nan = _mm_cmpgt_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+    __m128i quiet = _mm_or_si128(bits, _mm_set1_epi32(0x400000));
+
+    return _mm_or_si128(_mm_and_si128(nan, quiet), _mm_andnot_si128(nan, rounded));
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t bfloat_narrow_ssse3(unsigned char* dst, const float* src, size_t count, int big)
+{
+    __m128i mask = narrow_mask_128(big);
+    size_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        __m128i lo = bfloat_round_ssse3(_mm_loadu_si128((const __m128i*)(src + i)));
+        __m128i hi = bfloat_round_ssse3(_mm_loadu_si128((const __m128i*)(src + i + 4)));
+        __m128i val = _mm_unpacklo_epi64(_mm_shuffle_epi8(lo, mask), _mm_shuffle_epi8(hi, mask));
+        _mm_storeu_si128((__m128i*)(dst + i * 2), val);
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2,f16c")
+static size_t half_widen_avx2(float* dst, const unsigned char* src, size_t count, int big)
+{
+    __m128i mask = swap_mask_128(big);
+    size_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 2)), mask);
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(val));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2,f16c")
+static size_t half_narrow_avx2(unsigned char* dst, const float* src, size_t count, int big)
+{
+    __m128i mask = swap_mask_128(big);
+    size_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        __m128i val = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)(dst + i * 2), _mm_shuffle_epi8(val, mask));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t bfloat_widen_avx2(float* dst, const unsigned char* src, size_t count, int big)
+{
+    __m128i mask = swap_mask_128(big);
+    size_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 2)), mask);
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_slli_epi32(_mm256_cvtepu16_epi32(val), 16));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t bfloat_narrow_avx2(unsigned char* dst, const float* src, size_t count, int big)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(narrow_mask_128(big));
+    size_t i;
+
+    for (i = 0; i + 8 <= count; i += 8)
+    {
+        __m256i bits = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+        __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF)));
+        __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF)), _mm256_set1_epi32(0x7F800000));
+        __m256i val = _mm256_blendv_epi8(rounded, _mm256_or_si256(bits, _mm256_set1_epi32(0x400000)), nan);
+
+        // both halves of the register hold 8 bytes, which are moved together
+        val = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(val, mask), 0x08);
+        _mm_storeu_si128((__m128i*)(dst + i * 2), _mm256_castsi256_si128(val));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw,f16c")
+static size_t half_widen_avx512(float* dst, const unsigned char* src, size_t count, int big)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(swap_mask_128(big));
+    size_t i;
+
+    for (i = 0; i + 16 <= count; i += 16)
+    {
+        __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 2)), mask);
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(val));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw,f16c")
+static size_t half_narrow_avx512(unsigned char* dst, const float* src, size_t count, int big)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(swap_mask_128(big));
+    size_t i;
+
+    for (i = 0; i + 16 <= count; i += 16)
+    {
+        __m256i val = _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm256_storeu_si256((__m256i*)(dst + i * 2), _mm256_shuffle_epi8(val, mask));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t bfloat_widen_avx512(float* dst, const unsigned char* src, size_t count, int big)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(swap_mask_128(big));
+    size_t i;
+
+    for (i = 0; i + 16 <= count; i += 16)
+    {
+        __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 2)), mask);
+        _mm512_storeu_si512((void*)(dst + i), _mm512_slli_epi32(_mm512_cvtepu16_epi32(val), 16));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t bfloat_narrow_avx512(unsigned char* dst, const float* src, size_t count, int big)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(swap_mask_128(big));
+    size_t i;
+
+    for (i = 0; i + 16 <= count; i += 16)
+    {
+        __m512i bits = _mm512_loadu_si512((const void*)(src + i));
+        __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+        __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7FFF)));
+        __mmask16 nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(bits, _mm512_set1_epi32(0x7FFFFFFF)), _mm512_set1_epi32(0x7F800000));
+        __m512i val = _mm512_mask_or_epi32(rounded, nan, bits, _mm512_set1_epi32(0x400000));
+
+        val = _mm512_srli_epi32(val, 16);
+        _mm256_storeu_si256((__m256i*)(dst + i * 2), _mm256_shuffle_epi8(_mm512_cvtepi32_epi16(val), mask));
+    }
+
+    return i;
+}
+
+#endif
+
+/*
+
+    Kernel selection
+
+*/
+
+static size_t half_widen(float* dst, const void* src, size_t count, int big)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return half_widen_avx512(dst, (const unsigned char*)src, count, big);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return half_widen_avx2(dst, (const unsigned char*)src, count, big);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)big;
+    return 0;
+}
+
+static size_t half_narrow(void* dst, const float* src, size_t count, int big)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return half_narrow_avx512((unsigned char*)dst, src, count, big);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return half_narrow_avx2((unsigned char*)dst, src, count, big);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)big;
+    return 0;
+}
+
+static size_t bfloat_widen(float* dst, const void* src, size_t count, int big)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return bfloat_widen_avx512(dst, (const unsigned char*)src, count, big);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return bfloat_widen_avx2(dst, (const unsigned char*)src, count, big);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        return bfloat_widen_ssse3(dst, (const unsigned char*)src, count, big);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)big;
+    return 0;
+}
+
+static size_t bfloat_narrow(void* dst, const float* src, size_t count, int big)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return bfloat_narrow_avx512((unsigned char*)dst, src, count, big);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return bfloat_narrow_avx2((unsigned char*)dst, src, count, big);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        return bfloat_narrow_ssse3((unsigned char*)dst, src, count, big);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)big;
+    return 0;
+}
+
+/*
+
+    Half precision arrays
+
+*/
+
+/// @brief Reads an array of half precision little endian floating point numbers into an array of 32-bit floating point numbers
+/// @param dst array that receives the widened values
+/// @param src array of count 16-bit floating point numbers in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_f16_array(float* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_HALF_READ, count * 2);
+
+    for (i = half_widen(dst, src, count, 0); i < count; i++)
+        dst[i] = load_le_f16(bytes + i * 2);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_HALF_READ, count * 2);
+}
+
+/// @brief Writes an array of 32-bit floating point numbers as half precision little endian floating point numbers
+/// @param dst array that receives count 16-bit floating point numbers in little endian, must not overlap src
+/// @param src array of 32-bit floating point numbers that are rounded to the nearest half precision numbers, ties to even
+/// @param count number of values in src
+void convert_to_le_f16_array(void* dst, const float* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_HALF_WRITE, count * sizeof(float));
+
+    for (i = half_narrow(dst, src, count, 0); i < count; i++)
+        store_le_f16(bytes + i * 2, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_HALF_WRITE, count * sizeof(float));
+}
+
+/// @brief Reads an array of half precision big endian floating point numbers into an array of 32-bit floating point numbers
+/// @param dst array that receives the widened values
+/// @param src array of count 16-bit floating point numbers in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_f16_array(float* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_HALF_READ, count * 2);
+
+    for (i = half_widen(dst, src, count, 1); i < count; i++)
+        dst[i] = load_be_f16(bytes + i * 2);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_HALF_READ, count * 2);
+}
+
+/// @brief Writes an array of 32-bit floating point numbers as half precision big endian floating point numbers
+/// @param dst array that receives count 16-bit floating point numbers in big endian, must not overlap src
+/// @param src array of 32-bit floating point numbers that are rounded to the nearest half precision numbers, ties to even
+/// @param count number of values in src
+void convert_to_be_f16_array(void* dst, const float* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_HALF_WRITE, count * sizeof(float));
+
+    for (i = half_narrow(dst, src, count, 1); i < count; i++)
+        store_be_f16(bytes + i * 2, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_HALF_WRITE, count * sizeof(float));
+}
+
+/*
+
+    bfloat16 arrays
+
+*/
+
+/// @brief Reads an array of bfloat16 little endian floating point numbers into an array of 32-bit floating point numbers
+/// @param dst array that receives the widened values
+/// @param src array of count 16-bit floating point numbers in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_bf16_array(float* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_HALF_READ, count * 2);
+
+    for (i = bfloat_widen(dst, src, count, 0); i < count; i++)
+        dst[i] = load_le_bf16(bytes + i * 2);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_HALF_READ, count * 2);
+}
+
+/// @brief Writes an array of 32-bit floating point numbers as bfloat16 little endian floating point numbers
+/// @param dst array that receives count 16-bit floating point numbers in little endian, must not overlap src
+/// @param src array of 32-bit floating point numbers that are rounded to the nearest bfloat16 numbers, ties to even
+/// @param count number of values in src
+void convert_to_le_bf16_array(void* dst, const float* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_HALF_WRITE, count * sizeof(float));
+
+    for (i = bfloat_narrow(dst, src, count, 0); i < count; i++)
+        store_le_bf16(bytes + i * 2, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_HALF_WRITE, count * sizeof(float));
+}
+
+/// @brief Reads an array of bfloat16 big endian floating point numbers into an array of 32-bit floating point numbers
+/// @param dst array that receives the widened values
+/// @param src array of count 16-bit floating point numbers in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_bf16_array(float* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_HALF_READ, count * 2);
+
+    for (i = bfloat_widen(dst, src, count, 1); i < count; i++)
+        dst[i] = load_be_bf16(bytes + i * 2);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_HALF_READ, count * 2);
+}
+
+/// @brief Writes an array of 32-bit floating point numbers as bfloat16 big endian floating point numbers
+/// @param dst array that receives count 16-bit floating point numbers in big endian, must not overlap src
+/// @param src array of 32-bit floating point numbers that are rounded to the nearest bfloat16 numbers, ties to even
+/// @param count number of values in src
+void convert_to_be_bf16_array(void* dst, const float* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_HALF_WRITE, count * sizeof(float));
+
+    for (i = bfloat_narrow(dst, src, count, 1); i < count; i++)
+        store_be_bf16(bytes + i * 2, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_HALF_WRITE, count * sizeof(float));
+}
@@ -0,0 +1,317 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_instrument.c
+/// @brief A C portable source code that contains implementation of the counters of the bulk conversions
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CONV_ENDIAN_INSTRUMENT) && defined(_WIN32)
+#include <windows.h>
+#elif defined(CONV_ENDIAN_INSTRUMENT)
+#include <pthread.h>
+#endif
+
+#define KERNEL_COUNT (CONV_ENDIAN_KERNEL_AVX512 + 1)
+
+#if defined(CONV_ENDIAN_INSTRUMENT)
+
+/*
+
+    Counters of a thread
+
+    Every thread that converts gets its own counters the first time it
+    converts, so that counting is only a pair of additions to memory that
+    no other thread writes. The counters of all threads are kept in a list
+    for taking snapshots, and when a thread exits its counts are added to
+    the counts of the threads that have exited before its counters are
+    freed
+
+*/
+
+typedef struct trace_counters
+{
+    conv_endian_counter operations[CONV_ENDIAN_OPERATION_COUNT];
+    conv_endian_counter kernels[KERNEL_COUNT];
+    struct trace_counters* prev;
+    struct trace_counters* next;
+} trace_counters;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define TRACE_THREAD_LOCAL __thread
+#endif
+
+static TRACE_THREAD_LOCAL trace_counters* local_counters = NULL;
+static trace_counters* live_counters = NULL;
+static conv_endian_snapshot exited_counts;
+static conv_endian_lock counters_lock = 0;
+
+// only the thread that owns a counter writes it, snapshots read it at the same time
+static void counter_add(uint64_t* counter, uint64_t val)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    *(volatile uint64_t*)counter += val;
+#else
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + val, __ATOMIC_RELAXED);
+#endif
+}
+
+static uint64_t counter_load(const uint64_t* counter)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return *(const volatile uint64_t*)counter;
+#else
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+#endif
+}
+
+static void add_counts(conv_endian_snapshot* snapshot, const trace_counters* counters)
+{
+    size_t i;
+
+    for (i = 0; i < CONV_ENDIAN_OPERATION_COUNT; i++)
+    {
+        snapshot->operations[i].calls += counter_load(&counters->operations[i].calls);
+        snapshot->operations[i].bytes += counter_load(&counters->operations[i].bytes);
+    }
+
+    for (i = 0; i < KERNEL_COUNT; i++)
+    {
+        snapshot->kernels[i].calls += counter_load(&counters->kernels[i].calls);
+        snapshot->kernels[i].bytes += counter_load(&counters->kernels[i].bytes);
+    }
+}
+
+static void release_counters(void* arg)
+{
+    trace_counters* counters = (trace_counters*)arg;
+
+    if (counters == NULL)
+        return;
+
+    // a destructor that runs after this one may still convert
+    local_counters = NULL;
+
+    conv_endian_lock_acquire(&counters_lock);
+
+    add_counts(&exited_counts, counters);
+
+    if (counters->prev != NULL)
+        counters->prev->next = counters->next;
+    else
+        live_counters = counters->next;
+
+    if (counters->next != NULL)
+        counters->next->prev = counters->prev;
+
+    conv_endian_lock_release(&counters_lock);
+
+    free(counters);
+}
+
+/*
+
+    Releasing the counters when a thread exits
+
+    A thread local variable cannot run code when its thread exits, so the
+    counters are also stored in a fiber local slot on Windows or a thread
+    specific key on POSIX systems, whose destructor releases them
+
+*/
+
+#if defined(_WIN32)
+
+static DWORD exit_slot = FLS_OUT_OF_INDEXES;
+
+static void __stdcall release_counters_on_exit(void* arg)
+{
+    release_counters(arg);
+}
+
+static void watch_thread_exit(trace_counters* counters)
+{
+    if (exit_slot == FLS_OUT_OF_INDEXES)
+        exit_slot = FlsAlloc(release_counters_on_exit);
+
+    if (exit_slot != FLS_OUT_OF_INDEXES)
+        FlsSetValue(exit_slot, counters);
+}
+
+#else
+
+static pthread_key_t exit_key;
+static int exit_key_created = 0;
+
+static void watch_thread_exit(trace_counters* counters)
+{
+    if (!exit_key_created)
+        exit_key_created = pthread_key_create(&exit_key, release_counters) == 0;
+
+    if (exit_key_created)
+        pthread_setspecific(exit_key, counters);
+}
+
+#endif
+
+static trace_counters* acquire_counters(void)
+{
+    trace_counters* counters = (trace_counters*)calloc(1, sizeof(trace_counters));
+
+    if (counters == NULL)
+        return NULL;
+
+    conv_endian_lock_acquire(&counters_lock);
+
+    counters->next = live_counters;
+    if (live_counters != NULL)
+        live_counters->prev = counters;
+    live_counters = counters;
+
+    // the lock also makes sure that only one thread creates the key
+    watch_thread_exit(counters);
+
+    conv_endian_lock_release(&counters_lock);
+
+    return counters;
+}
+
+/// @brief Counts a call and its bytes for the calling thread
+/// @param operation operation being called
+/// @param bytes number of bytes the call reads
+/// @return kernel the call is counted for
+conv_endian_kernel conv_endian_trace_count(conv_endian_operation operation, size_t bytes)
+{
+    conv_endian_kernel kernel = conv_endian_get_kernel();
+    trace_counters* counters = local_counters;
+
+    if (counters == NULL)
+    {
+        counters = acquire_counters();
+
+        // a call that cannot be counted is still converted
+        if (counters == NULL)
+            return kernel;
+
+        local_counters = counters;
+    }
+
+    counter_add(&counters->operations[operation].calls, 1);
+    counter_add(&counters->operations[operation].bytes, bytes);
+    counter_add(&counters->kernels[kernel].calls, 1);
+    counter_add(&counters->kernels[kernel].bytes, bytes);
+
+    return kernel;
+}
+
+#endif
+
+/*
+
+    Snapshots
+
+*/
+
+/// @brief Checks whether the library was compiled with CONV_ENDIAN_INSTRUMENT
+/// @return 1 if the conversions are counted, 0 otherwise
+int conv_endian_instrumented(void)
+{
+#if defined(CONV_ENDIAN_INSTRUMENT)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/// @brief Adds up the counts of all threads, including the threads that have exited
+/// @param snapshot snapshot that receives the counts
+void conv_endian_take_snapshot(conv_endian_snapshot* snapshot)
+{
+#if defined(CONV_ENDIAN_INSTRUMENT)
+    const trace_counters* counters;
+
+    conv_endian_lock_acquire(&counters_lock);
+
+    *snapshot = exited_counts;
+
+    for (counters = live_counters; counters != NULL; counters = counters->next)
+        add_counts(snapshot, counters);
+
+    conv_endian_lock_release(&counters_lock);
+#else
+    memset(snapshot, 0, sizeof(*snapshot));
+#endif
+}
+
+/// @brief Gets the name of an operation
+/// @param operation operation to be named
+/// @return name of operation
+const char* conv_endian_operation_name(conv_endian_operation operation)
+{
+    switch (operation)
+    {
+    case CONV_ENDIAN_OPERATION_BSWAP16:
+        return "bswap16";
+    case CONV_ENDIAN_OPERATION_BSWAP32:
+        return "bswap32";
+    case CONV_ENDIAN_OPERATION_BSWAP64:
+        return "bswap64";
+    case CONV_ENDIAN_OPERATION_PERMUTE:
+        return "permute";
+    case CONV_ENDIAN_OPERATION_GATHER:
+        return "gather";
+    case CONV_ENDIAN_OPERATION_SCATTER:
+        return "scatter";
+    case CONV_ENDIAN_OPERATION_CHECKSUM:
+        return "checksum";
+    case CONV_ENDIAN_OPERATION_PCM_DECODE:
+        return "pcm_decode";
+    case CONV_ENDIAN_OPERATION_PCM_ENCODE:
+        return "pcm_encode";
+    case CONV_ENDIAN_OPERATION_DELTA_DECODE:
+        return "delta_decode";
+    case CONV_ENDIAN_OPERATION_DELTA_ENCODE:
+        return "delta_encode";
+    case CONV_ENDIAN_OPERATION_STATS:
+        return "stats";
+    case CONV_ENDIAN_OPERATION_PACKED_READ:
+        return "packed_read";
+    case CONV_ENDIAN_OPERATION_PACKED_WRITE:
+        return "packed_write";
+    case CONV_ENDIAN_OPERATION_HALF_READ:
+        return "half_read";
+    case CONV_ENDIAN_OPERATION_HALF_WRITE:
+        return "half_write";
+    default:
+        return "unknown";
+    }
+}
@@ -0,0 +1,201 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_internal.h
+/// @brief Declarations shared between the source files of the library that are not part of its interface
+
+
+#ifndef CONV_ENDIAN_INTERNAL_H
+#define CONV_ENDIAN_INTERNAL_H
+
+/*
+
+    Vector kernels are compiled for x86 processors unless CONV_ENDIAN_NO_SIMD
+    is defined. Each kernel is compiled for its own instruction set with
+    CONV_ENDIAN_TARGET so that the rest of the library does not need any
+    compiler flags, and is only called after the processor has been checked
+    to support it
+
+*/
+
+#if !defined(CONV_ENDIAN_NO_SIMD) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)) && \
+    (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define CONV_ENDIAN_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CONV_ENDIAN_TARGET(features) __attribute__((target(features)))
+#else
+#define CONV_ENDIAN_TARGET(features)
+#endif
+
+#if defined(CONV_ENDIAN_X86)
+
+/// @brief Checks whether the processor has the CRC32 instruction of SSE4.2, which the SSSE3 kernel does not require
+/// @return 1 if it has, 0 otherwise
+int conv_endian_has_crc32c(void);
+
+/// @brief Checks whether the processor has SSE4.1 and SSE4.2, which the SSSE3 kernel does not require either
+/// @return 1 if it has, 0 otherwise
+int conv_endian_has_sse42(void);
+
+#endif
+
+/*
+
+    The endianness of the machine, known at compile time when conv_endian.h
+    could detect it and checked at run time otherwise
+
+*/
+
+/// @brief Checks whether the machine is little endian
+/// @return 1 if it is little endian, 0 if it is big endian
+static CONV_ENDIAN_INLINE int conv_endian_host_is_little(void)
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    return 1;
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    return 0;
+#else
+    const uint16_t probe = 1;
+    return *(const unsigned char*)&probe == 1;
+#endif
+}
+
+/// @brief Checks whether numbers have to be byte swapped to be converted between an endianness and the endianness of the machine
+/// @param width number of bytes in a number
+/// @param order endianness of the numbers
+/// @return 1 if they have to be swapped, 0 otherwise
+static CONV_ENDIAN_INLINE int conv_endian_needs_swap(size_t width, conv_endian_order order)
+{
+    if (width == 1)
+        return 0;
+
+    return conv_endian_host_is_little() ? order == CONV_ENDIAN_ORDER_BIG : order == CONV_ENDIAN_ORDER_LITTLE;
+}
+
+/*
+
+    A spin lock for the few places where the library keeps global state
+    that is changed after it has been loaded, such as caches
+
+*/
+
+#if defined(_MSC_VER) && !defined(__clang__)
+
+#include <intrin.h>
+
+typedef volatile long conv_endian_lock;
+
+static __inline void conv_endian_lock_acquire(conv_endian_lock* lock)
+{
+    while (_InterlockedExchange(lock, 1) != 0)
+    {
+        while (*lock != 0)
+        {
+        }
+    }
+}
+
+static __inline void conv_endian_lock_release(conv_endian_lock* lock)
+{
+    _InterlockedExchange(lock, 0);
+}
+
+#else
+
+typedef int conv_endian_lock;
+
+static inline void conv_endian_lock_acquire(conv_endian_lock* lock)
+{
+    while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE) != 0)
+    {
+        while (__atomic_load_n(lock, __ATOMIC_RELAXED) != 0)
+        {
+        }
+    }
+}
+
+static inline void conv_endian_lock_release(conv_endian_lock* lock)
+{
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+}
+
+#endif
+
+/*
+
+    Instrumentation hooks around the bulk conversions, which compile to
+    nothing unless CONV_ENDIAN_INSTRUMENT is defined. A conversion calls
+    CONV_ENDIAN_TRACE_BEGIN once it has checked its arguments, which counts
+    the call, and CONV_ENDIAN_TRACE_END when it is done. Where <sys/sdt.h>
+    is available both also fire a USDT probe,
+    conv_endian:convert__start with the operation, the kernel and the
+    number of bytes, and conv_endian:convert__done with the operation and
+    the number of bytes
+
+*/
+
+#if defined(CONV_ENDIAN_INSTRUMENT)
+
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define CONV_ENDIAN_PROBE_START(operation, kernel, bytes) DTRACE_PROBE3(conv_endian, convert__start, (int)(operation), (int)(kernel), (size_t)(bytes))
+#define CONV_ENDIAN_PROBE_DONE(operation, bytes) DTRACE_PROBE2(conv_endian, convert__done, (int)(operation), (size_t)(bytes))
+#endif
+#endif
+
+#if !defined(CONV_ENDIAN_PROBE_START)
+#define CONV_ENDIAN_PROBE_START(operation, kernel, bytes) ((void)(kernel))
+#define CONV_ENDIAN_PROBE_DONE(operation, bytes) ((void)(operation), (void)(bytes))
+#endif
+
+/// @brief Counts a call and its bytes for the calling thread
+/// @param operation operation being called
+/// @param bytes number of bytes the call reads
+/// @return kernel the call is counted for
+conv_endian_kernel conv_endian_trace_count(conv_endian_operation operation, size_t bytes);
+
+#define CONV_ENDIAN_TRACE_BEGIN(operation, bytes) \
+    do \
+    { \
+        conv_endian_kernel trace_kernel = conv_endian_trace_count((operation), (bytes)); \
+        CONV_ENDIAN_PROBE_START((operation), trace_kernel, (bytes)); \
+    } while (0)
+
+#define CONV_ENDIAN_TRACE_END(operation, bytes) CONV_ENDIAN_PROBE_DONE((operation), (bytes))
+
+#else
+
+#define CONV_ENDIAN_TRACE_BEGIN(operation, bytes) ((void)(operation), (void)(bytes))
+#define CONV_ENDIAN_TRACE_END(operation, bytes) ((void)(operation), (void)(bytes))
+
+#endif
+
+#endif
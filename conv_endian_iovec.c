@@ -0,0 +1,349 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_iovec.c
+/// @brief A C portable source code that contains implementation of functions for converting numbers in chains of scattered buffers
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include "conv_endian_iovec.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Walking chains
+
+    A cursor may be left at the end of a fragment, or before empty
+    fragments, so every walk starts by skipping whatever is left of the
+    current fragment when it is empty.
+
+*/
+
+// number of bytes from a position in a chain to its end, stopping once
+// enough bytes have been found so that long chains are not walked in full
+static size_t chain_remaining(const conv_endian_iovec* iov, size_t iovcnt, size_t index, size_t pos, size_t enough)
+{
+    size_t total = 0;
+
+    for (; index < iovcnt && total < enough; index++, pos = 0)
+        total += iov[index].iov_len - pos;
+
+    return total;
+}
+
+static void convert_values(void* dst, const void* src, size_t count, size_t width, int swap)
+{
+    if (!swap)
+    {
+        memcpy(dst, src, count * width);
+        return;
+    }
+
+    switch (width)
+    {
+    case 2:
+        conv_endian_bswap16_array(dst, src, count);
+        break;
+    case 4:
+        conv_endian_bswap32_array(dst, src, count);
+        break;
+    default:
+        conv_endian_bswap64_array(dst, src, count);
+        break;
+    }
+}
+
+/*
+
+    Bytes
+
+*/
+
+/// @brief Reads bytes that are split between fragments
+/// @param reader reader
+/// @param dst array that receives the bytes, left unchanged when they do not fit in the chain
+/// @param bytes number of bytes to be read
+/// @return 1 on success, 0 after setting the error flag otherwise
+int conv_endian_iov_read_split(conv_endian_iov_reader* reader, void* dst, size_t bytes)
+{
+    unsigned char* dst_bytes = (unsigned char*)dst;
+
+    if (reader->error || chain_remaining(reader->iov, reader->iovcnt, reader->index, reader->pos, bytes) < bytes)
+    {
+        reader->error = 1;
+        return 0;
+    }
+
+    while (bytes > 0)
+    {
+        const conv_endian_iovec* seg = reader->iov + reader->index;
+        size_t step = seg->iov_len - reader->pos;
+
+        if (step == 0)
+        {
+            reader->index++;
+            reader->pos = 0;
+            continue;
+        }
+
+        if (step > bytes)
+            step = bytes;
+
+        memcpy(dst_bytes, (const unsigned char*)seg->iov_base + reader->pos, step);
+        dst_bytes += step;
+        reader->pos += step;
+        bytes -= step;
+    }
+
+    return 1;
+}
+
+/// @brief Writes bytes that are split between fragments
+/// @param writer writer
+/// @param src array of bytes to be written, nothing is written when they do not fit in the chain
+/// @param bytes number of bytes to be written
+/// @return 1 on success, 0 after setting the error flag otherwise
+int conv_endian_iov_write_split(conv_endian_iov_writer* writer, const void* src, size_t bytes)
+{
+    const unsigned char* src_bytes = (const unsigned char*)src;
+
+    if (writer->error || chain_remaining(writer->iov, writer->iovcnt, writer->index, writer->pos, bytes) < bytes)
+    {
+        writer->error = 1;
+        return 0;
+    }
+
+    while (bytes > 0)
+    {
+        const conv_endian_iovec* seg = writer->iov + writer->index;
+        size_t step = seg->iov_len - writer->pos;
+
+        if (step == 0)
+        {
+            writer->index++;
+            writer->pos = 0;
+            continue;
+        }
+
+        if (step > bytes)
+            step = bytes;
+
+        memcpy((unsigned char*)seg->iov_base + writer->pos, src_bytes, step);
+        src_bytes += step;
+        writer->pos += step;
+        bytes -= step;
+    }
+
+    return 1;
+}
+
+/// @brief Gets the number of bytes a reader has not read yet
+/// @param reader reader
+/// @return number of bytes left in the chain
+size_t conv_endian_iov_reader_remaining(const conv_endian_iov_reader* reader)
+{
+    return chain_remaining(reader->iov, reader->iovcnt, reader->index, reader->pos, SIZE_MAX);
+}
+
+/// @brief Gets the number of bytes a writer has not written yet
+/// @param writer writer
+/// @return number of bytes left in the chain
+size_t conv_endian_iov_writer_remaining(const conv_endian_iov_writer* writer)
+{
+    return chain_remaining(writer->iov, writer->iovcnt, writer->index, writer->pos, SIZE_MAX);
+}
+
+// moves a position forward without touching the bytes, the caller has
+// checked that they are in the chain
+static void chain_advance(const conv_endian_iovec* iov, size_t* index, size_t* pos, size_t bytes)
+{
+    while (bytes > 0)
+    {
+        size_t step = iov[*index].iov_len - *pos;
+
+        if (step == 0)
+        {
+            (*index)++;
+            *pos = 0;
+            continue;
+        }
+
+        if (step > bytes)
+            step = bytes;
+
+        *pos += step;
+        bytes -= step;
+    }
+}
+
+/// @brief Skips bytes of a reader
+/// @param reader reader
+/// @param bytes number of bytes to be skipped
+void conv_endian_iov_reader_skip(conv_endian_iov_reader* reader, size_t bytes)
+{
+    if (reader->error || chain_remaining(reader->iov, reader->iovcnt, reader->index, reader->pos, bytes) < bytes)
+    {
+        reader->error = 1;
+        return;
+    }
+
+    chain_advance(reader->iov, &reader->index, &reader->pos, bytes);
+}
+
+/// @brief Skips bytes of a writer, leaving them as they are
+/// @param writer writer
+/// @param bytes number of bytes to be skipped
+void conv_endian_iov_writer_skip(conv_endian_iov_writer* writer, size_t bytes)
+{
+    if (writer->error || chain_remaining(writer->iov, writer->iovcnt, writer->index, writer->pos, bytes) < bytes)
+    {
+        writer->error = 1;
+        return;
+    }
+
+    chain_advance(writer->iov, &writer->index, &writer->pos, bytes);
+}
+
+/*
+
+    Arrays
+
+    The values that lie within a fragment are converted with the bulk
+    functions straight between the fragment and the dense array, and a
+    value that is split between fragments is gathered into a small buffer
+    first.
+
+*/
+
+/// @brief Reads an array of numbers from a reader
+/// @param reader reader
+/// @param dst array that receives count numbers in their endianness of their machine
+/// @param count number of numbers to be read
+/// @param width number of bytes in a number: 1, 2, 4 or 8
+/// @param order endianness of the numbers in the chain
+/// @return 0 on success or -1 if width is not supported or the numbers do not fit in the chain, which also sets the error flag
+int conv_endian_iov_read_array(conv_endian_iov_reader* reader, void* dst, size_t count, size_t width, conv_endian_order order)
+{
+    unsigned char* dst_bytes = (unsigned char*)dst;
+    int swap = conv_endian_needs_swap(width, order);
+
+    if ((width != 1 && width != 2 && width != 4 && width != 8) || count > SIZE_MAX / width || reader->error ||
+        chain_remaining(reader->iov, reader->iovcnt, reader->index, reader->pos, count * width) < count * width)
+    {
+        reader->error = 1;
+        return -1;
+    }
+
+    while (count > 0)
+    {
+        const conv_endian_iovec* seg = reader->iov + reader->index;
+        size_t whole = (seg->iov_len - reader->pos) / width;
+
+        if (whole > count)
+            whole = count;
+
+        if (whole > 0)
+        {
+            convert_values(dst_bytes, (const unsigned char*)seg->iov_base + reader->pos, whole, width, swap);
+            reader->pos += whole * width;
+        }
+        else if (reader->pos == seg->iov_len)
+        {
+            reader->index++;
+            reader->pos = 0;
+            continue;
+        }
+        else
+        {
+            unsigned char val[8];
+
+            conv_endian_iov_read_split(reader, val, width);
+            convert_values(dst_bytes, val, 1, width, swap);
+            whole = 1;
+        }
+
+        dst_bytes += whole * width;
+        count -= whole;
+    }
+
+    return 0;
+}
+
+/// @brief Writes an array of numbers into a writer
+/// @param writer writer
+/// @param src array of count numbers in their endianness of their machine
+/// @param count number of numbers to be written
+/// @param width number of bytes in a number: 1, 2, 4 or 8
+/// @param order endianness the numbers are written in
+/// @return 0 on success or -1 if width is not supported or the numbers do not fit in the chain, which also sets the error flag
+int conv_endian_iov_write_array(conv_endian_iov_writer* writer, const void* src, size_t count, size_t width, conv_endian_order order)
+{
+    const unsigned char* src_bytes = (const unsigned char*)src;
+    int swap = conv_endian_needs_swap(width, order);
+
+    if ((width != 1 && width != 2 && width != 4 && width != 8) || count > SIZE_MAX / width || writer->error ||
+        chain_remaining(writer->iov, writer->iovcnt, writer->index, writer->pos, count * width) < count * width)
+    {
+        writer->error = 1;
+        return -1;
+    }
+
+    while (count > 0)
+    {
+        const conv_endian_iovec* seg = writer->iov + writer->index;
+        size_t whole = (seg->iov_len - writer->pos) / width;
+
+        if (whole > count)
+            whole = count;
+
+        if (whole > 0)
+        {
+            convert_values((unsigned char*)seg->iov_base + writer->pos, src_bytes, whole, width, swap);
+            writer->pos += whole * width;
+        }
+        else if (writer->pos == seg->iov_len)
+        {
+            writer->index++;
+            writer->pos = 0;
+            continue;
+        }
+        else
+        {
+            unsigned char val[8];
+
+            convert_values(val, src_bytes, 1, width, swap);
+            conv_endian_iov_write_split(writer, val, width);
+            whole = 1;
+        }
+
+        src_bytes += whole * width;
+        count -= whole;
+    }
+
+    return 0;
+}
@@ -0,0 +1,334 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_iovec.h
+/// @brief A C portable header that contains cursors for reading and writing numbers in chains of scattered buffers
+
+
+#ifndef CONV_ENDIAN_IOVEC_H
+#define CONV_ENDIAN_IOVEC_H
+
+#include "conv_endian.h"
+#include "conv_endian_cursor.h"
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <sys/uio.h>
+#endif
+
+/*
+
+    Scatter/gather cursors
+
+    Network stacks hand received data over as chains of fragments, and a
+    number may start in one fragment and end in the next. An iovec reader
+    walks such a chain like conv_endian_reader walks a single buffer, and
+    an iovec writer fills one:
+
+        conv_endian_iov_reader r;
+        conv_endian_iov_reader_init(&r, fragments, fragment_count);
+
+        type = conv_endian_iov_get_u8(&r);
+        length = conv_endian_iov_get_be_u16(&r);
+        conv_endian_iov_read_array(&r, samples, length, 4, CONV_ENDIAN_ORDER_BIG);
+
+        if (conv_endian_iov_reader_failed(&r))
+            return -1;
+
+    A number that lies within one fragment is loaded inline like with a
+    cursor. Only numbers that are split between fragments are assembled
+    byte by byte, in conv_endian_iovec.c. Arrays are converted with the
+    bulk functions one fragment at a time, so every fragment is vectorized
+    and only the values split between fragments are converted one by one.
+
+    Like cursors, a read or write that does not fit in the rest of the
+    chain reads 0 or writes nothing and sets an error flag that stays set.
+
+    conv_endian_iovec is struct iovec on systems that have it, so the
+    chains of readv, recvmsg and io_uring can be used as they are.
+
+*/
+
+#if defined(_WIN32)
+/// @brief A fragment of a chain of buffers, laid out like struct iovec
+typedef struct conv_endian_iovec
+{
+    void* iov_base; ///< first byte of the fragment
+    size_t iov_len; ///< number of bytes in the fragment
+} conv_endian_iovec;
+#else
+typedef struct iovec conv_endian_iovec;
+#endif
+
+/// @brief A cursor that reads numbers one after another from a chain of buffers
+typedef struct conv_endian_iov_reader
+{
+    const conv_endian_iovec* iov; ///< fragments of the chain
+    size_t iovcnt; ///< number of fragments
+    size_t index; ///< fragment of the next byte to be read
+    size_t pos; ///< offset of the next byte to be read in its fragment
+    int error; ///< set when a read did not fit in the chain, and stays set
+} conv_endian_iov_reader;
+
+/// @brief A cursor that writes numbers one after another into a chain of buffers
+typedef struct conv_endian_iov_writer
+{
+    const conv_endian_iovec* iov; ///< fragments of the chain
+    size_t iovcnt; ///< number of fragments
+    size_t index; ///< fragment of the next byte to be written
+    size_t pos; ///< offset of the next byte to be written in its fragment
+    int error; ///< set when a write did not fit in the chain, and stays set
+} conv_endian_iov_writer;
+
+/// @brief Reads bytes that are split between fragments, use conv_endian_iov_get_bytes instead
+/// @param reader reader
+/// @param dst array that receives the bytes, left unchanged when they do not fit in the chain
+/// @param bytes number of bytes to be read
+/// @return 1 on success, 0 after setting the error flag otherwise
+int conv_endian_iov_read_split(conv_endian_iov_reader* reader, void* dst, size_t bytes);
+
+/// @brief Writes bytes that are split between fragments, use conv_endian_iov_put_bytes instead
+/// @param writer writer
+/// @param src array of bytes to be written, nothing is written when they do not fit in the chain
+/// @param bytes number of bytes to be written
+/// @return 1 on success, 0 after setting the error flag otherwise
+int conv_endian_iov_write_split(conv_endian_iov_writer* writer, const void* src, size_t bytes);
+
+/// @brief Gets the number of bytes a reader has not read yet
+/// @param reader reader
+/// @return number of bytes left in the chain
+size_t conv_endian_iov_reader_remaining(const conv_endian_iov_reader* reader);
+
+/// @brief Gets the number of bytes a writer has not written yet
+/// @param writer writer
+/// @return number of bytes left in the chain
+size_t conv_endian_iov_writer_remaining(const conv_endian_iov_writer* writer);
+
+/// @brief Skips bytes of a reader
+/// @param reader reader
+/// @param bytes number of bytes to be skipped
+void conv_endian_iov_reader_skip(conv_endian_iov_reader* reader, size_t bytes);
+
+/// @brief Skips bytes of a writer, leaving them as they are
+/// @param writer writer
+/// @param bytes number of bytes to be skipped
+void conv_endian_iov_writer_skip(conv_endian_iov_writer* writer, size_t bytes);
+
+/// @brief Reads an array of numbers from a reader
+/// @param reader reader
+/// @param dst array that receives count numbers in their endianness of their machine
+/// @param count number of numbers to be read
+/// @param width number of bytes in a number: 1, 2, 4 or 8
+/// @param order endianness of the numbers in the chain
+/// @return 0 on success or -1 if width is not supported or the numbers do not fit in the chain, which also sets the error flag
+int conv_endian_iov_read_array(conv_endian_iov_reader* reader, void* dst, size_t count, size_t width, conv_endian_order order);
+
+/// @brief Writes an array of numbers into a writer
+/// @param writer writer
+/// @param src array of count numbers in their endianness of their machine
+/// @param count number of numbers to be written
+/// @param width number of bytes in a number: 1, 2, 4 or 8
+/// @param order endianness the numbers are written in
+/// @return 0 on success or -1 if width is not supported or the numbers do not fit in the chain, which also sets the error flag
+int conv_endian_iov_write_array(conv_endian_iov_writer* writer, const void* src, size_t count, size_t width, conv_endian_order order);
+
+/// @brief Starts a reader at the beginning of a chain of buffers
+/// @param reader reader to be started
+/// @param iov fragments of the chain, which must stay valid while the reader is used
+/// @param iovcnt number of fragments
+static CONV_ENDIAN_INLINE void conv_endian_iov_reader_init(conv_endian_iov_reader* reader, const conv_endian_iovec* iov, size_t iovcnt)
+{
+    reader->iov = iov;
+    reader->iovcnt = iovcnt;
+    reader->index = 0;
+    reader->pos = 0;
+    reader->error = 0;
+}
+
+/// @brief Starts a writer at the beginning of a chain of buffers
+/// @param writer writer to be started
+/// @param iov fragments of the chain, which must stay valid while the writer is used
+/// @param iovcnt number of fragments
+static CONV_ENDIAN_INLINE void conv_endian_iov_writer_init(conv_endian_iov_writer* writer, const conv_endian_iovec* iov, size_t iovcnt)
+{
+    writer->iov = iov;
+    writer->iovcnt = iovcnt;
+    writer->index = 0;
+    writer->pos = 0;
+    writer->error = 0;
+}
+
+/// @brief Checks whether a read of a reader has failed
+/// @param reader reader
+/// @return 1 if a read did not fit in the chain, 0 otherwise
+static CONV_ENDIAN_INLINE int conv_endian_iov_reader_failed(const conv_endian_iov_reader* reader)
+{
+    return reader->error;
+}
+
+/// @brief Checks whether a write of a writer has failed
+/// @param writer writer
+/// @return 1 if a write did not fit in the chain, 0 otherwise
+static CONV_ENDIAN_INLINE int conv_endian_iov_writer_failed(const conv_endian_iov_writer* writer)
+{
+    return writer->error;
+}
+
+/// @brief Reads bytes from a reader without converting them
+/// @param reader reader
+/// @param dst array that receives the bytes, left unchanged when they do not fit in the chain
+/// @param bytes number of bytes to be read
+/// @return 1 on success, 0 after setting the error flag otherwise
+static CONV_ENDIAN_INLINE int conv_endian_iov_get_bytes(conv_endian_iov_reader* reader, void* dst, size_t bytes)
+{
+    if (!reader->error && reader->index < reader->iovcnt &&
+        bytes <= reader->iov[reader->index].iov_len - reader->pos)
+    {
+        memcpy(dst, (const unsigned char*)reader->iov[reader->index].iov_base + reader->pos, bytes);
+        reader->pos += bytes;
+        return 1;
+    }
+
+    return conv_endian_iov_read_split(reader, dst, bytes);
+}
+
+/// @brief Writes bytes into a writer without converting them
+/// @param writer writer
+/// @param src array of bytes to be written, nothing is written when they do not fit in the chain
+/// @param bytes number of bytes to be written
+/// @return 1 on success, 0 after setting the error flag otherwise
+static CONV_ENDIAN_INLINE int conv_endian_iov_put_bytes(conv_endian_iov_writer* writer, const void* src, size_t bytes)
+{
+    if (!writer->error && writer->index < writer->iovcnt &&
+        bytes <= writer->iov[writer->index].iov_len - writer->pos)
+    {
+        memcpy((unsigned char*)writer->iov[writer->index].iov_base + writer->pos, src, bytes);
+        writer->pos += bytes;
+        return 1;
+    }
+
+    return conv_endian_iov_write_split(writer, src, bytes);
+}
+
+/*
+
+    Numbers of 8, 16, 32 and 64 bits
+
+    CONV_ENDIAN_IOV_NUMBER defines the get and put functions of one number
+    type in one endianness with the conversion helpers of
+    conv_endian_cursor.h
+
+*/
+
+#define CONV_ENDIAN_IOV_NUMBER(name, type, bits, swap, from_bits, to_bits) \
+    static CONV_ENDIAN_INLINE type conv_endian_iov_get_##name(conv_endian_iov_reader* reader) \
+    { \
+        uint##bits##_t val; \
+        if (!conv_endian_iov_get_bytes(reader, &val, sizeof(val))) \
+            return 0; \
+        return from_bits(swap(val)); \
+    } \
+    static CONV_ENDIAN_INLINE void conv_endian_iov_put_##name(conv_endian_iov_writer* writer, type val) \
+    { \
+        uint##bits##_t out = swap(to_bits(val)); \
+        conv_endian_iov_put_bytes(writer, &out, sizeof(out)); \
+    }
+
+CONV_ENDIAN_IOV_NUMBER(u8, uint8_t, 8, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_IOV_NUMBER(s8, int8_t, 8, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_S8, CONV_ENDIAN_CURSOR_U8)
+
+CONV_ENDIAN_IOV_NUMBER(le_u16, uint16_t, 16, conv_endian_le16, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_IOV_NUMBER(be_u16, uint16_t, 16, conv_endian_be16, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_IOV_NUMBER(le_s16, int16_t, 16, conv_endian_le16, CONV_ENDIAN_CURSOR_S16, CONV_ENDIAN_CURSOR_U16)
+CONV_ENDIAN_IOV_NUMBER(be_s16, int16_t, 16, conv_endian_be16, CONV_ENDIAN_CURSOR_S16, CONV_ENDIAN_CURSOR_U16)
+
+CONV_ENDIAN_IOV_NUMBER(le_u32, uint32_t, 32, conv_endian_le32, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_IOV_NUMBER(be_u32, uint32_t, 32, conv_endian_be32, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_IOV_NUMBER(le_s32, int32_t, 32, conv_endian_le32, CONV_ENDIAN_CURSOR_S32, CONV_ENDIAN_CURSOR_U32)
+CONV_ENDIAN_IOV_NUMBER(be_s32, int32_t, 32, conv_endian_be32, CONV_ENDIAN_CURSOR_S32, CONV_ENDIAN_CURSOR_U32)
+CONV_ENDIAN_IOV_NUMBER(le_f32, float, 32, conv_endian_le32, conv_endian_bits_f32, conv_endian_f32_bits)
+CONV_ENDIAN_IOV_NUMBER(be_f32, float, 32, conv_endian_be32, conv_endian_bits_f32, conv_endian_f32_bits)
+
+CONV_ENDIAN_IOV_NUMBER(le_u64, uint64_t, 64, conv_endian_le64, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_IOV_NUMBER(be_u64, uint64_t, 64, conv_endian_be64, CONV_ENDIAN_CURSOR_SAME, CONV_ENDIAN_CURSOR_SAME)
+CONV_ENDIAN_IOV_NUMBER(le_s64, int64_t, 64, conv_endian_le64, CONV_ENDIAN_CURSOR_S64, CONV_ENDIAN_CURSOR_U64)
+CONV_ENDIAN_IOV_NUMBER(be_s64, int64_t, 64, conv_endian_be64, CONV_ENDIAN_CURSOR_S64, CONV_ENDIAN_CURSOR_U64)
+CONV_ENDIAN_IOV_NUMBER(le_f64, double, 64, conv_endian_le64, conv_endian_bits_f64, conv_endian_f64_bits)
+CONV_ENDIAN_IOV_NUMBER(be_f64, double, 64, conv_endian_be64, conv_endian_bits_f64, conv_endian_f64_bits)
+
+/*
+
+    Packed and 16-bit floating point numbers
+
+    CONV_ENDIAN_IOV_COMPOSITE gathers the bytes of one number and converts
+    them with the load and store functions of conv_endian.h
+
+*/
+
+#define CONV_ENDIAN_IOV_COMPOSITE(name, type, bytes) \
+    static CONV_ENDIAN_INLINE type conv_endian_iov_get_##name(conv_endian_iov_reader* reader) \
+    { \
+        unsigned char buf[bytes]; \
+        type none; \
+        if (conv_endian_iov_get_bytes(reader, buf, bytes)) \
+            return load_##name(buf); \
+        memset(&none, 0, sizeof(none)); \
+        return none; \
+    } \
+    static CONV_ENDIAN_INLINE void conv_endian_iov_put_##name(conv_endian_iov_writer* writer, type val) \
+    { \
+        unsigned char buf[bytes]; \
+        store_##name(buf, val); \
+        conv_endian_iov_put_bytes(writer, buf, bytes); \
+    }
+
+CONV_ENDIAN_IOV_COMPOSITE(le_u24, uint32_t, 3)
+CONV_ENDIAN_IOV_COMPOSITE(be_u24, uint32_t, 3)
+CONV_ENDIAN_IOV_COMPOSITE(le_s24, int32_t, 3)
+CONV_ENDIAN_IOV_COMPOSITE(be_s24, int32_t, 3)
+CONV_ENDIAN_IOV_COMPOSITE(le_u48, uint64_t, 6)
+CONV_ENDIAN_IOV_COMPOSITE(be_u48, uint64_t, 6)
+CONV_ENDIAN_IOV_COMPOSITE(le_s48, int64_t, 6)
+CONV_ENDIAN_IOV_COMPOSITE(be_s48, int64_t, 6)
+CONV_ENDIAN_IOV_COMPOSITE(le_u128, conv_endian_u128, 16)
+CONV_ENDIAN_IOV_COMPOSITE(be_u128, conv_endian_u128, 16)
+CONV_ENDIAN_IOV_COMPOSITE(le_f16, float, 2)
+CONV_ENDIAN_IOV_COMPOSITE(be_f16, float, 2)
+CONV_ENDIAN_IOV_COMPOSITE(le_bf16, float, 2)
+CONV_ENDIAN_IOV_COMPOSITE(be_bf16, float, 2)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,624 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_packed.c
+/// @brief A C portable source code that contains implementation of functions for converting arrays of packed 24-bit, 48-bit and 128-bit numbers
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Vector kernels
+
+    The vector kernels work on 16-byte blocks: every block of a wide array
+    holds four 32-bit or two 64-bit numbers, and the 12 bytes of the same
+    numbers in the packed array are moved in and out of the block with one
+    byte shuffle. Widening leaves the highest bytes of every number zero,
+    which the signed functions then sign extend with (val ^ m) - m where m
+    is the sign bit of the packed number.
+
+    Each kernel returns the number of blocks it has converted. The kernels
+    never read or write past the end of either array, so a few blocks at
+    the end are left to the scalar loops.
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t widen_ssse3(unsigned char* dst, const unsigned char* src, size_t blocks, const unsigned char* shuffle, size_t wide, int sign)
+{
+    __m128i mask = _mm_loadu_si128((const __m128i*)shuffle);
+    __m128i bit = wide == 4 ? _mm_set1_epi32(0x800000) : _mm_set1_epi64x(0x800000000000);
+    size_t i;
+
+    // a block reads 16 bytes for the 12 bytes of its numbers
+    for (i = 0; i + 1 < blocks; i++)
+    {
+        __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 12)), mask);
+
+        if (sign && wide == 4)
+            val = _mm_sub_epi32(_mm_xor_si128(val, bit), bit);
+        else if (sign)
+            val = _mm_sub_epi64(_mm_xor_si128(val, bit), bit);
+
+        _mm_storeu_si128((__m128i*)(dst + i * 16), val);
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t narrow_ssse3(unsigned char* dst, const unsigned char* src, size_t blocks, const unsigned char* shuffle)
+{
+    __m128i mask = _mm_loadu_si128((const __m128i*)shuffle);
+    size_t i;
+
+    // a block writes 16 bytes for the 12 bytes of its numbers
+    for (i = 0; i + 1 < blocks; i++)
+    {
+        __m128i val = _mm_loadu_si128((const __m128i*)(src + i * 16));
+        _mm_storeu_si128((__m128i*)(dst + i * 12), _mm_shuffle_epi8(val, mask));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t widen_avx2(unsigned char* dst, const unsigned char* src, size_t blocks, const unsigned char* shuffle, size_t wide, int sign)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)shuffle));
+    __m256i bit = wide == 4 ? _mm256_set1_epi32(0x800000) : _mm256_set1_epi64x(0x800000000000);
+    size_t i;
+
+    // two blocks read 28 bytes for the 24 bytes of their numbers
+    for (i = 0; i + 2 < blocks; i += 2)
+    {
+        __m128i lo = _mm_loadu_si128((const __m128i*)(src + i * 12));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(src + i * 12 + 12));
+        __m256i val = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), mask);
+
+        if (sign && wide == 4)
+            val = _mm256_sub_epi32(_mm256_xor_si256(val, bit), bit);
+        else if (sign)
+            val = _mm256_sub_epi64(_mm256_xor_si256(val, bit), bit);
+
+        _mm256_storeu_si256((__m256i*)(dst + i * 16), val);
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t narrow_avx2(unsigned char* dst, const unsigned char* src, size_t blocks, const unsigned char* shuffle)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)shuffle));
+    __m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    size_t i;
+
+    // two blocks write 32 bytes for the 24 bytes of their numbers
+    for (i = 0; i + 2 < blocks; i += 2)
+    {
+        __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 16)), mask);
+        _mm256_storeu_si256((__m256i*)(dst + i * 12), _mm256_permutevar8x32_epi32(val, pack));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t widen_avx512(unsigned char* dst, const unsigned char* src, size_t blocks, const unsigned char* shuffle, size_t wide, int sign)
+{
+    __m512i mask = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)shuffle));
+    __m512i spread = _mm512_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0);
+    __m512i bit = wide == 4 ? _mm512_set1_epi32(0x800000) : _mm512_set1_epi64(0x800000000000);
+    size_t i;
+
+    // four blocks read exactly the 48 bytes of their numbers
+    for (i = 0; i + 4 <= blocks; i += 4)
+    {
+        __m512i val = _mm512_maskz_loadu_epi8((__mmask64)0xFFFFFFFFFFFF, (const void*)(src + i * 12));
+        val = _mm512_shuffle_epi8(_mm512_permutexvar_epi32(spread, val), mask);
+
+        if (sign && wide == 4)
+            val = _mm512_sub_epi32(_mm512_xor_si512(val, bit), bit);
+        else if (sign)
+            val = _mm512_sub_epi64(_mm512_xor_si512(val, bit), bit);
+
+        _mm512_storeu_si512((void*)(dst + i * 16), val);
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t narrow_avx512(unsigned char* dst, const unsigned char* src, size_t blocks, const unsigned char* shuffle)
+{
+    __m512i mask = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)shuffle));
+    __m512i pack = _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15);
+    size_t i;
+
+    // four blocks write exactly the 48 bytes of their numbers
+    for (i = 0; i + 4 <= blocks; i += 4)
+    {
+        __m512i val = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*)(src + i * 16)), mask);
+        _mm512_mask_storeu_epi8((void*)(dst + i * 12), (__mmask64)0xFFFFFFFFFFFF, _mm512_permutexvar_epi32(pack, val));
+    }
+
+    return i;
+}
+
+#endif
+
+/*
+
+    Widening and narrowing
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+/// @brief Builds the byte shuffle that moves the packed numbers of a block into their wide numbers
+static void build_widen_shuffle(unsigned char* shuffle, size_t packed, size_t wide, int big)
+{
+    size_t i, j;
+
+    for (i = 0; i < 16 / wide; i++)
+        for (j = 0; j < wide; j++)
+            shuffle[i * wide + j] = j < packed ? (unsigned char)(i * packed + (big ? packed - 1 - j : j)) : 0x80;
+}
+
+/// @brief Builds the byte shuffle that moves the wide numbers of a block into their packed numbers
+static void build_narrow_shuffle(unsigned char* shuffle, size_t packed, size_t wide, int big)
+{
+    size_t i, j;
+
+    memset(shuffle, 0x80, 16);
+
+    for (i = 0; i < 16 / wide; i++)
+        for (j = 0; j < packed; j++)
+            shuffle[i * packed + j] = (unsigned char)(i * wide + (big ? packed - 1 - j : j));
+}
+
+#endif
+
+/// @brief Converts count packed numbers of packed bytes into wide numbers of wide bytes
+/// @return number of numbers converted, the rest is left to the caller
+static size_t widen(void* dst, const void* src, size_t count, size_t packed, size_t wide, int big, int sign)
+{
+    size_t blocks = count / (16 / wide);
+    size_t done = 0;
+
+#if defined(CONV_ENDIAN_X86)
+    conv_endian_kernel kernel = conv_endian_get_kernel();
+    unsigned char shuffle[16];
+
+    if (kernel == CONV_ENDIAN_KERNEL_SCALAR || blocks < 2)
+        return 0;
+
+    build_widen_shuffle(shuffle, packed, wide, big);
+
+    if (kernel == CONV_ENDIAN_KERNEL_AVX512)
+        done = widen_avx512((unsigned char*)dst, (const unsigned char*)src, blocks, shuffle, wide, sign);
+    else if (kernel == CONV_ENDIAN_KERNEL_AVX2)
+        done = widen_avx2((unsigned char*)dst, (const unsigned char*)src, blocks, shuffle, wide, sign);
+    else
+        done = widen_ssse3((unsigned char*)dst, (const unsigned char*)src, blocks, shuffle, wide, sign);
+#else
+    (void)dst;
+    (void)src;
+    (void)packed;
+    (void)big;
+    (void)sign;
+    (void)blocks;
+#endif
+
+    return done * (16 / wide);
+}
+
+/// @brief Converts count wide numbers of wide bytes into packed numbers of packed bytes
+/// @return number of numbers converted, the rest is left to the caller
+static size_t narrow(void* dst, const void* src, size_t count, size_t packed, size_t wide, int big)
+{
+    size_t blocks = count / (16 / wide);
+    size_t done = 0;
+
+#if defined(CONV_ENDIAN_X86)
+    conv_endian_kernel kernel = conv_endian_get_kernel();
+    unsigned char shuffle[16];
+
+    if (kernel == CONV_ENDIAN_KERNEL_SCALAR || blocks < 2)
+        return 0;
+
+    build_narrow_shuffle(shuffle, packed, wide, big);
+
+    if (kernel == CONV_ENDIAN_KERNEL_AVX512)
+        done = narrow_avx512((unsigned char*)dst, (const unsigned char*)src, blocks, shuffle);
+    else if (kernel == CONV_ENDIAN_KERNEL_AVX2)
+        done = narrow_avx2((unsigned char*)dst, (const unsigned char*)src, blocks, shuffle);
+    else
+        done = narrow_ssse3((unsigned char*)dst, (const unsigned char*)src, blocks, shuffle);
+#else
+    (void)dst;
+    (void)src;
+    (void)packed;
+    (void)big;
+    (void)blocks;
+#endif
+
+    return done * (16 / wide);
+}
+
+/*
+
+    24-bit arrays
+
+*/
+
+/// @brief Reads an array of packed 24-bit unsigned little endian integers into an array of uint32_t
+/// @param dst array that receives the values in their endianness of their machine
+/// @param src array of count packed values of 3 bytes in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_u24_array(uint32_t* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_READ, count * 3);
+
+    for (i = widen(dst, src, count, 3, 4, 0, 0); i < count; i++)
+        dst[i] = load_le_u24(bytes + i * 3);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_READ, count * 3);
+}
+
+/// @brief Writes an array of uint32_t as packed 24-bit unsigned little endian integers
+/// @param dst array that receives count packed values of 3 bytes in little endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 24 bits are written
+/// @param count number of values in src
+void convert_to_le_u24_array(void* dst, const uint32_t* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 4);
+
+    for (i = narrow(dst, src, count, 3, 4, 0); i < count; i++)
+        store_le_u24(bytes + i * 3, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 4);
+}
+
+/// @brief Reads an array of packed 24-bit unsigned big endian integers into an array of uint32_t
+/// @param dst array that receives the values in their endianness of their machine
+/// @param src array of count packed values of 3 bytes in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_u24_array(uint32_t* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_READ, count * 3);
+
+    for (i = widen(dst, src, count, 3, 4, 1, 0); i < count; i++)
+        dst[i] = load_be_u24(bytes + i * 3);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_READ, count * 3);
+}
+
+/// @brief Writes an array of uint32_t as packed 24-bit unsigned big endian integers
+/// @param dst array that receives count packed values of 3 bytes in big endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 24 bits are written
+/// @param count number of values in src
+void convert_to_be_u24_array(void* dst, const uint32_t* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 4);
+
+    for (i = narrow(dst, src, count, 3, 4, 1); i < count; i++)
+        store_be_u24(bytes + i * 3, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 4);
+}
+
+/// @brief Reads an array of packed 24-bit signed little endian integers into an array of int32_t
+/// @param dst array that receives the values in their endianness of their machine, sign extended
+/// @param src array of count packed values of 3 bytes in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_s24_array(int32_t* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_READ, count * 3);
+
+    for (i = widen(dst, src, count, 3, 4, 0, 1); i < count; i++)
+        dst[i] = load_le_s24(bytes + i * 3);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_READ, count * 3);
+}
+
+/// @brief Writes an array of int32_t as packed 24-bit signed little endian integers
+/// @param dst array that receives count packed values of 3 bytes in little endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 24 bits are written
+/// @param count number of values in src
+void convert_to_le_s24_array(void* dst, const int32_t* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 4);
+
+    for (i = narrow(dst, src, count, 3, 4, 0); i < count; i++)
+        store_le_s24(bytes + i * 3, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 4);
+}
+
+/// @brief Reads an array of packed 24-bit signed big endian integers into an array of int32_t
+/// @param dst array that receives the values in their endianness of their machine, sign extended
+/// @param src array of count packed values of 3 bytes in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_s24_array(int32_t* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_READ, count * 3);
+
+    for (i = widen(dst, src, count, 3, 4, 1, 1); i < count; i++)
+        dst[i] = load_be_s24(bytes + i * 3);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_READ, count * 3);
+}
+
+/// @brief Writes an array of int32_t as packed 24-bit signed big endian integers
+/// @param dst array that receives count packed values of 3 bytes in big endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 24 bits are written
+/// @param count number of values in src
+void convert_to_be_s24_array(void* dst, const int32_t* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 4);
+
+    for (i = narrow(dst, src, count, 3, 4, 1); i < count; i++)
+        store_be_s24(bytes + i * 3, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 4);
+}
+
+/*
+
+    48-bit arrays
+
+*/
+
+/// @brief Reads an array of packed 48-bit unsigned little endian integers into an array of uint64_t
+/// @param dst array that receives the values in their endianness of their machine
+/// @param src array of count packed values of 6 bytes in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_u48_array(uint64_t* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_READ, count * 6);
+
+    for (i = widen(dst, src, count, 6, 8, 0, 0); i < count; i++)
+        dst[i] = load_le_u48(bytes + i * 6);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_READ, count * 6);
+}
+
+/// @brief Writes an array of uint64_t as packed 48-bit unsigned little endian integers
+/// @param dst array that receives count packed values of 6 bytes in little endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 48 bits are written
+/// @param count number of values in src
+void convert_to_le_u48_array(void* dst, const uint64_t* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 8);
+
+    for (i = narrow(dst, src, count, 6, 8, 0); i < count; i++)
+        store_le_u48(bytes + i * 6, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 8);
+}
+
+/// @brief Reads an array of packed 48-bit unsigned big endian integers into an array of uint64_t
+/// @param dst array that receives the values in their endianness of their machine
+/// @param src array of count packed values of 6 bytes in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_u48_array(uint64_t* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_READ, count * 6);
+
+    for (i = widen(dst, src, count, 6, 8, 1, 0); i < count; i++)
+        dst[i] = load_be_u48(bytes + i * 6);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_READ, count * 6);
+}
+
+/// @brief Writes an array of uint64_t as packed 48-bit unsigned big endian integers
+/// @param dst array that receives count packed values of 6 bytes in big endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 48 bits are written
+/// @param count number of values in src
+void convert_to_be_u48_array(void* dst, const uint64_t* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 8);
+
+    for (i = narrow(dst, src, count, 6, 8, 1); i < count; i++)
+        store_be_u48(bytes + i * 6, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 8);
+}
+
+/// @brief Reads an array of packed 48-bit signed little endian integers into an array of int64_t
+/// @param dst array that receives the values in their endianness of their machine, sign extended
+/// @param src array of count packed values of 6 bytes in little endian, must not overlap dst
+/// @param count number of values in src
+void read_le_s48_array(int64_t* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_READ, count * 6);
+
+    for (i = widen(dst, src, count, 6, 8, 0, 1); i < count; i++)
+        dst[i] = load_le_s48(bytes + i * 6);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_READ, count * 6);
+}
+
+/// @brief Writes an array of int64_t as packed 48-bit signed little endian integers
+/// @param dst array that receives count packed values of 6 bytes in little endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 48 bits are written
+/// @param count number of values in src
+void convert_to_le_s48_array(void* dst, const int64_t* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 8);
+
+    for (i = narrow(dst, src, count, 6, 8, 0); i < count; i++)
+        store_le_s48(bytes + i * 6, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 8);
+}
+
+/// @brief Reads an array of packed 48-bit signed big endian integers into an array of int64_t
+/// @param dst array that receives the values in their endianness of their machine, sign extended
+/// @param src array of count packed values of 6 bytes in big endian, must not overlap dst
+/// @param count number of values in src
+void read_be_s48_array(int64_t* dst, const void* src, size_t count)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_READ, count * 6);
+
+    for (i = widen(dst, src, count, 6, 8, 1, 1); i < count; i++)
+        dst[i] = load_be_s48(bytes + i * 6);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_READ, count * 6);
+}
+
+/// @brief Writes an array of int64_t as packed 48-bit signed big endian integers
+/// @param dst array that receives count packed values of 6 bytes in big endian, must not overlap src
+/// @param src array of values in their endianness of their machine, only their lowest 48 bits are written
+/// @param count number of values in src
+void convert_to_be_s48_array(void* dst, const int64_t* src, size_t count)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 8);
+
+    for (i = narrow(dst, src, count, 6, 8, 1); i < count; i++)
+        store_be_s48(bytes + i * 6, src[i]);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PACKED_WRITE, count * 8);
+}
+
+/*
+
+    128-bit arrays
+
+    conv_endian_u128 keeps its lowest 64 bits first, so converting between
+    an array of them and an array in either endianness only rearranges the
+    bytes of every 16-byte record
+
+*/
+
+static void permute_u128(void* dst, const void* src, size_t count, int big)
+{
+    uint16_t perm[16];
+    size_t i;
+
+    for (i = 0; i < 16; i++)
+    {
+        if (conv_endian_host_is_little())
+            perm[i] = (uint16_t)(big ? 15 - i : i);
+        else
+            perm[i] = (uint16_t)(big ? (i + 8) % 16 : (i & 8) + 7 - (i & 7));
+    }
+
+    // 16-byte records are never large enough to need memory
+    conv_endian_permute_records(dst, src, count, 16, perm);
+}
+
+/// @brief Reads an array of 128-bit unsigned little endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count 128-bit unsigned integers in little endian
+/// @param count number of values in src
+void read_le_u128_array(conv_endian_u128* dst, const void* src, size_t count)
+{
+    permute_u128(dst, src, count, 0);
+}
+
+/// @brief Writes an array of 128-bit unsigned little endian integers
+/// @param dst array that receives count 128-bit unsigned integers in little endian, may be the same array as src
+/// @param src array of values in their endianness of their machine
+/// @param count number of values in src
+void convert_to_le_u128_array(void* dst, const conv_endian_u128* src, size_t count)
+{
+    permute_u128(dst, src, count, 0);
+}
+
+/// @brief Reads an array of 128-bit unsigned big endian integers
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count 128-bit unsigned integers in big endian
+/// @param count number of values in src
+void read_be_u128_array(conv_endian_u128* dst, const void* src, size_t count)
+{
+    permute_u128(dst, src, count, 1);
+}
+
+/// @brief Writes an array of 128-bit unsigned big endian integers
+/// @param dst array that receives count 128-bit unsigned integers in big endian, may be the same array as src
+/// @param src array of values in their endianness of their machine
+/// @param count number of values in src
+void convert_to_be_u128_array(void* dst, const conv_endian_u128* src, size_t count)
+{
+    permute_u128(dst, src, count, 1);
+}
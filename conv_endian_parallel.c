@@ -0,0 +1,561 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_parallel.c
+/// @brief A C portable source code that contains implementation of functions for converting large arrays with several threads
+
+
+#include "conv_endian_parallel.h"
+#include "conv_endian.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/*
+
+    Threads
+
+    Only the few thread functions the pool needs, on top of Windows threads
+    or POSIX threads
+
+*/
+
+#if defined(_WIN32)
+
+typedef HANDLE pool_thread;
+typedef CRITICAL_SECTION pool_mutex;
+typedef CONDITION_VARIABLE pool_cond;
+
+#define POOL_THREAD_RETURN unsigned __stdcall
+
+static int pool_thread_start(pool_thread* thread, unsigned (__stdcall* func)(void*), void* arg)
+{
+    *thread = (HANDLE)_beginthreadex(NULL, 0, func, arg, 0, NULL);
+    return *thread != NULL ? 0 : -1;
+}
+
+static void pool_thread_join(pool_thread thread)
+{
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+static void pool_mutex_init(pool_mutex* mutex) { InitializeCriticalSection(mutex); }
+static void pool_mutex_destroy(pool_mutex* mutex) { DeleteCriticalSection(mutex); }
+static void pool_mutex_lock(pool_mutex* mutex) { EnterCriticalSection(mutex); }
+static void pool_mutex_unlock(pool_mutex* mutex) { LeaveCriticalSection(mutex); }
+
+static void pool_cond_init(pool_cond* cond) { InitializeConditionVariable(cond); }
+static void pool_cond_destroy(pool_cond* cond) { (void)cond; }
+static void pool_cond_wait(pool_cond* cond, pool_mutex* mutex) { SleepConditionVariableCS(cond, mutex, INFINITE); }
+static void pool_cond_signal(pool_cond* cond) { WakeConditionVariable(cond); }
+static void pool_cond_broadcast(pool_cond* cond) { WakeAllConditionVariable(cond); }
+
+static unsigned processor_count(void)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (unsigned)info.dwNumberOfProcessors;
+}
+
+#else
+
+typedef pthread_t pool_thread;
+typedef pthread_mutex_t pool_mutex;
+typedef pthread_cond_t pool_cond;
+
+#define POOL_THREAD_RETURN void*
+
+static int pool_thread_start(pool_thread* thread, void* (*func)(void*), void* arg)
+{
+    return pthread_create(thread, NULL, func, arg) == 0 ? 0 : -1;
+}
+
+static void pool_thread_join(pool_thread thread)
+{
+    pthread_join(thread, NULL);
+}
+
+static void pool_mutex_init(pool_mutex* mutex) { pthread_mutex_init(mutex, NULL); }
+static void pool_mutex_destroy(pool_mutex* mutex) { pthread_mutex_destroy(mutex); }
+static void pool_mutex_lock(pool_mutex* mutex) { pthread_mutex_lock(mutex); }
+static void pool_mutex_unlock(pool_mutex* mutex) { pthread_mutex_unlock(mutex); }
+
+static void pool_cond_init(pool_cond* cond) { pthread_cond_init(cond, NULL); }
+static void pool_cond_destroy(pool_cond* cond) { pthread_cond_destroy(cond); }
+static void pool_cond_wait(pool_cond* cond, pool_mutex* mutex) { pthread_cond_wait(cond, mutex); }
+static void pool_cond_signal(pool_cond* cond) { pthread_cond_signal(cond); }
+static void pool_cond_broadcast(pool_cond* cond) { pthread_cond_broadcast(cond); }
+
+static unsigned processor_count(void)
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned)count : 1;
+}
+
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+typedef volatile long long pool_counter;
+#define POOL_COUNTER_TAKE(counter) ((size_t)_InterlockedExchangeAdd64((counter), 1))
+#define POOL_COUNTER_SET(counter, val) _InterlockedExchange64((counter), (long long)(val))
+#else
+typedef size_t pool_counter;
+#define POOL_COUNTER_TAKE(counter) __atomic_fetch_add((counter), 1, __ATOMIC_RELAXED)
+#define POOL_COUNTER_SET(counter, val) __atomic_store_n((counter), (val), __ATOMIC_RELAXED)
+#endif
+
+/*
+
+    Jobs
+
+    A job is split into chunks and every thread owns a contiguous range of
+    them. A thread takes chunks from its own range first and then from the
+    ranges of the other threads, each chunk being taken by exactly one
+    thread through the counter of its range
+
+*/
+
+typedef enum job_kind
+{
+    JOB_BSWAP16,
+    JOB_BSWAP32,
+    JOB_BSWAP64,
+    JOB_PERMUTE
+} job_kind;
+
+/// @brief The chunks owned by one thread, padded to its own cache line
+typedef struct job_range
+{
+    pool_counter next; ///< next chunk to be taken
+    size_t end; ///< one past the last chunk
+    unsigned char padding[64 - sizeof(pool_counter) - sizeof(size_t)];
+} job_range;
+
+typedef struct job
+{
+    job_kind kind;
+    unsigned char* dst;
+    const unsigned char* src;
+    size_t count; ///< number of values or records
+    size_t chunk; ///< number of values or records in a chunk
+    size_t record_size;
+    const uint16_t* perm;
+    int stream; ///< whether the whole array is large enough for non-temporal stores
+    job_range* ranges;
+    unsigned range_count;
+} job;
+
+static void job_run_chunk(const job* work, size_t index)
+{
+    size_t first = index * work->chunk;
+    size_t count = work->count - first < work->chunk ? work->count - first : work->chunk;
+
+    switch (work->kind)
+    {
+    case JOB_BSWAP16:
+        if (work->stream)
+            conv_endian_bswap16_array_stream(work->dst + first * 2, work->src + first * 2, count);
+        else
+            conv_endian_bswap16_array(work->dst + first * 2, work->src + first * 2, count);
+        break;
+    case JOB_BSWAP32:
+        if (work->stream)
+            conv_endian_bswap32_array_stream(work->dst + first * 4, work->src + first * 4, count);
+        else
+            conv_endian_bswap32_array(work->dst + first * 4, work->src + first * 4, count);
+        break;
+    case JOB_BSWAP64:
+        if (work->stream)
+            conv_endian_bswap64_array_stream(work->dst + first * 8, work->src + first * 8, count);
+        else
+            conv_endian_bswap64_array(work->dst + first * 8, work->src + first * 8, count);
+        break;
+    case JOB_PERMUTE:
+        // large records are never converted in place here, so this does not allocate
+        conv_endian_permute_records(work->dst + first * work->record_size, work->src + first * work->record_size,
+            count, work->record_size, work->perm);
+        break;
+    }
+}
+
+static void job_run(const job* work, unsigned self)
+{
+    unsigned i;
+
+    for (i = 0; i < work->range_count; i++)
+    {
+        job_range* range = &work->ranges[(self + i) % work->range_count];
+
+        for (;;)
+        {
+            size_t index = POOL_COUNTER_TAKE(&range->next);
+
+            if (index >= range->end)
+                break;
+
+            job_run_chunk(work, index);
+        }
+    }
+}
+
+/*
+
+    Pools
+
+*/
+
+struct conv_endian_pool
+{
+    unsigned threads; ///< number of threads converting a job including the calling thread
+    size_t cutoff;
+    pool_thread* workers; ///< threads - 1 threads started by the pool
+    job_range* ranges; ///< one range per thread
+    pool_mutex mutex;
+    pool_cond wake; ///< signalled when a job is posted or the pool is stopped
+    pool_cond done; ///< signalled when the last worker has finished a job
+    const job* current;
+    unsigned long generation; ///< incremented for every job posted
+    unsigned pending; ///< number of workers still running the current job
+    int stopping;
+    int busy; ///< whether a thread is converting a job with the pool
+};
+
+/// @brief Arguments of a worker thread
+typedef struct pool_worker
+{
+    conv_endian_pool* pool;
+    unsigned index;
+} pool_worker;
+
+static POOL_THREAD_RETURN pool_worker_main(void* arg)
+{
+    pool_worker* worker = (pool_worker*)arg;
+    conv_endian_pool* pool = worker->pool;
+    unsigned index = worker->index;
+    unsigned long seen = 0;
+
+    free(worker);
+
+    pool_mutex_lock(&pool->mutex);
+
+    for (;;)
+    {
+        const job* work;
+
+        while (!pool->stopping && pool->generation == seen)
+            pool_cond_wait(&pool->wake, &pool->mutex);
+
+        if (pool->stopping)
+            break;
+
+        seen = pool->generation;
+        work = pool->current;
+        pool_mutex_unlock(&pool->mutex);
+
+        job_run(work, index);
+
+        pool_mutex_lock(&pool->mutex);
+
+        if (--pool->pending == 0)
+            pool_cond_signal(&pool->done);
+    }
+
+    pool_mutex_unlock(&pool->mutex);
+    return 0;
+}
+
+static void pool_stop(conv_endian_pool* pool, unsigned started)
+{
+    unsigned i;
+
+    pool_mutex_lock(&pool->mutex);
+    pool->stopping = 1;
+    pool_cond_broadcast(&pool->wake);
+    pool_mutex_unlock(&pool->mutex);
+
+    for (i = 0; i < started; i++)
+        pool_thread_join(pool->workers[i]);
+
+    pool_cond_destroy(&pool->done);
+    pool_cond_destroy(&pool->wake);
+    pool_mutex_destroy(&pool->mutex);
+    free(pool->ranges);
+    free(pool->workers);
+    free(pool);
+}
+
+/// @brief Creates a pool and starts its threads
+/// @param threads number of threads converting an array including the calling thread, 0 for one thread per processor
+/// @return new pool that has to be released with conv_endian_pool_destroy, or NULL if memory or threads could not be allocated
+conv_endian_pool* conv_endian_pool_create(unsigned threads)
+{
+    conv_endian_pool* pool;
+    unsigned i;
+
+    if (threads == 0)
+        threads = processor_count();
+
+    pool = (conv_endian_pool*)calloc(1, sizeof(conv_endian_pool));
+
+    if (pool == NULL)
+        return NULL;
+
+    pool->threads = threads;
+    pool->cutoff = CONV_ENDIAN_PARALLEL_CUTOFF;
+    pool->workers = (pool_thread*)calloc(threads, sizeof(pool_thread));
+    pool->ranges = (job_range*)calloc(threads, sizeof(job_range));
+
+    if (pool->workers == NULL || pool->ranges == NULL)
+    {
+        free(pool->ranges);
+        free(pool->workers);
+        free(pool);
+        return NULL;
+    }
+
+    pool_mutex_init(&pool->mutex);
+    pool_cond_init(&pool->wake);
+    pool_cond_init(&pool->done);
+
+    for (i = 0; i + 1 < threads; i++)
+    {
+        pool_worker* worker = (pool_worker*)malloc(sizeof(pool_worker));
+
+        if (worker == NULL)
+        {
+            pool_stop(pool, i);
+            return NULL;
+        }
+
+        worker->pool = pool;
+        worker->index = i + 1;
+
+        if (pool_thread_start(&pool->workers[i], pool_worker_main, worker) != 0)
+        {
+            free(worker);
+            pool_stop(pool, i);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+/// @brief Stops the threads of a pool and releases it, no conversion may be using the pool
+/// @param pool pool to be released, may be NULL
+void conv_endian_pool_destroy(conv_endian_pool* pool)
+{
+    if (pool != NULL)
+        pool_stop(pool, pool->threads - 1);
+}
+
+/// @brief Gets the number of threads converting an array with a pool
+/// @param pool pool
+/// @return number of threads including the calling thread
+unsigned conv_endian_pool_threads(const conv_endian_pool* pool)
+{
+    return pool->threads;
+}
+
+/// @brief Sets the number of bytes below which a pool converts arrays with the calling thread alone
+/// @param pool pool
+/// @param bytes cutoff in bytes, CONV_ENDIAN_PARALLEL_CUTOFF when the pool is created
+void conv_endian_pool_set_cutoff(conv_endian_pool* pool, size_t bytes)
+{
+    pool->cutoff = bytes;
+}
+
+/// @brief Gets the number of bytes below which a pool converts arrays with the calling thread alone
+/// @param pool pool
+/// @return cutoff in bytes
+size_t conv_endian_pool_get_cutoff(const conv_endian_pool* pool)
+{
+    return pool->cutoff;
+}
+
+/// @brief Converts a job with the threads of a pool
+/// @return 0 if the job was converted or -1 if the calling thread has to convert it alone
+static int pool_run(conv_endian_pool* pool, job* work, size_t bytes)
+{
+    size_t chunks;
+    size_t first = 0;
+    unsigned i;
+
+    if (pool == NULL || pool->threads < 2 || bytes < pool->cutoff || work->count == 0)
+        return -1;
+
+    chunks = (work->count + work->chunk - 1) / work->chunk;
+
+    if (chunks < 2)
+        return -1;
+
+    pool_mutex_lock(&pool->mutex);
+
+    if (pool->busy)
+    {
+        pool_mutex_unlock(&pool->mutex);
+        return -1;
+    }
+
+    pool->busy = 1;
+
+    // every thread starts with an equal share of the chunks, threads
+    // without a share of their own only take chunks from the others
+    for (i = 0; i < pool->threads; i++)
+    {
+        size_t share = chunks / pool->threads + (i < chunks % pool->threads ? 1 : 0);
+
+        POOL_COUNTER_SET(&pool->ranges[i].next, first);
+        pool->ranges[i].end = first + share;
+        first += share;
+    }
+
+    work->ranges = pool->ranges;
+    work->range_count = pool->threads;
+
+    pool->current = work;
+    pool->pending = pool->threads - 1;
+    pool->generation++;
+    pool_cond_broadcast(&pool->wake);
+    pool_mutex_unlock(&pool->mutex);
+
+    job_run(work, 0);
+
+    pool_mutex_lock(&pool->mutex);
+
+    while (pool->pending != 0)
+        pool_cond_wait(&pool->done, &pool->mutex);
+
+    pool->current = NULL;
+    pool->busy = 0;
+    pool_mutex_unlock(&pool->mutex);
+
+    return 0;
+}
+
+/*
+
+    Parallel conversions
+
+*/
+
+static void parallel_bswap(conv_endian_pool* pool, job_kind kind, size_t width, void* dst, const void* src, size_t count)
+{
+    job work;
+
+    work.kind = kind;
+    work.dst = (unsigned char*)dst;
+    work.src = (const unsigned char*)src;
+    work.count = count;
+    work.chunk = CONV_ENDIAN_PARALLEL_CHUNK / width;
+    work.record_size = width;
+    work.perm = NULL;
+
+    // every chunk is smaller than the stream threshold, so whether to
+    // stream is decided for the whole array
+    work.stream = dst != src && count * width >= conv_endian_get_stream_threshold();
+
+    if (pool_run(pool, &work, count * width) == 0)
+        return;
+
+    if (width == 2)
+        conv_endian_bswap16_array(dst, src, count);
+    else if (width == 4)
+        conv_endian_bswap32_array(dst, src, count);
+    else
+        conv_endian_bswap64_array(dst, src, count);
+}
+
+/// @brief Reverses the bytes of every 16-bit value in an array with the threads of a pool
+/// @param pool pool, or NULL to convert with the calling thread alone
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+void conv_endian_parallel_bswap16_array(conv_endian_pool* pool, void* dst, const void* src, size_t count)
+{
+    parallel_bswap(pool, JOB_BSWAP16, 2, dst, src, count);
+}
+
+/// @brief Reverses the bytes of every 32-bit value in an array with the threads of a pool
+/// @param pool pool, or NULL to convert with the calling thread alone
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+void conv_endian_parallel_bswap32_array(conv_endian_pool* pool, void* dst, const void* src, size_t count)
+{
+    parallel_bswap(pool, JOB_BSWAP32, 4, dst, src, count);
+}
+
+/// @brief Reverses the bytes of every 64-bit value in an array with the threads of a pool
+/// @param pool pool, or NULL to convert with the calling thread alone
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+void conv_endian_parallel_bswap64_array(conv_endian_pool* pool, void* dst, const void* src, size_t count)
+{
+    parallel_bswap(pool, JOB_BSWAP64, 8, dst, src, count);
+}
+
+/// @brief Rearranges the bytes of every record in an array of fixed size records with the threads of a pool
+/// @param pool pool, or NULL to convert with the calling thread alone
+/// @param dst array that receives the rearranged records, may be the same array as src
+/// @param src array of records
+/// @param count number of records in src
+/// @param record_size number of bytes in a record
+/// @param perm record_size byte indices, byte i of every record in dst is byte perm[i] of the same record in src
+/// @return 0 on success or -1, without converting anything, if memory for converting records larger than 256 bytes in place could not be allocated
+int conv_endian_parallel_permute_records(conv_endian_pool* pool, void* dst, const void* src, size_t count, size_t record_size, const uint16_t* perm)
+{
+    job work;
+
+    // large records converted in place need a scratch buffer, which is
+    // allocated once by converting them with the calling thread alone
+    if (record_size == 0 || (dst == src && record_size > 256))
+        return conv_endian_permute_records(dst, src, count, record_size, perm);
+
+    work.kind = JOB_PERMUTE;
+    work.dst = (unsigned char*)dst;
+    work.src = (const unsigned char*)src;
+    work.count = count;
+    work.chunk = record_size < CONV_ENDIAN_PARALLEL_CHUNK ? CONV_ENDIAN_PARALLEL_CHUNK / record_size : 1;
+    work.record_size = record_size;
+    work.perm = perm;
+    work.stream = 0;
+
+    if (pool_run(pool, &work, count * record_size) == 0)
+        return 0;
+
+    return conv_endian_permute_records(dst, src, count, record_size, perm);
+}
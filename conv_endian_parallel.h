@@ -0,0 +1,130 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_parallel.h
+/// @brief A C portable header that contains declarations of functions for converting large arrays with several threads
+
+
+#ifndef CONV_ENDIAN_PARALLEL_H
+#define CONV_ENDIAN_PARALLEL_H
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+
+    Worker pools
+
+    A pool keeps its threads waiting between conversions, so it is meant to
+    be created once and reused. An array is split into chunks of
+    CONV_ENDIAN_PARALLEL_CHUNK bytes and every thread starts with its own
+    share of the chunks. A thread that runs out of chunks takes the
+    remaining chunks of the other threads, so a thread that is slowed down
+    does not hold up the whole conversion.
+
+    Arrays smaller than the cutoff of a pool are converted by the calling
+    thread alone, as are arrays converted while another thread is using the
+    same pool. The calling thread always converts chunks as well, so a pool
+    of n threads starts n - 1 threads of its own.
+
+    These functions are only available when the library is built with the
+    worker pool, see the README.
+
+*/
+
+/// @brief Number of bytes of an array that a thread converts at a time
+#define CONV_ENDIAN_PARALLEL_CHUNK (256 * 1024)
+
+/// @brief Number of bytes below which a new pool converts arrays with the calling thread alone
+#define CONV_ENDIAN_PARALLEL_CUTOFF (4 * 1024 * 1024)
+
+/// @brief A pool of threads that convert arrays together
+typedef struct conv_endian_pool conv_endian_pool;
+
+/// @brief Creates a pool and starts its threads
+/// @param threads number of threads converting an array including the calling thread, 0 for one thread per processor
+/// @return new pool that has to be released with conv_endian_pool_destroy, or NULL if memory or threads could not be allocated
+conv_endian_pool* conv_endian_pool_create(unsigned threads);
+
+/// @brief Stops the threads of a pool and releases it, no conversion may be using the pool
+/// @param pool pool to be released, may be NULL
+void conv_endian_pool_destroy(conv_endian_pool* pool);
+
+/// @brief Gets the number of threads converting an array with a pool
+/// @param pool pool
+/// @return number of threads including the calling thread
+unsigned conv_endian_pool_threads(const conv_endian_pool* pool);
+
+/// @brief Sets the number of bytes below which a pool converts arrays with the calling thread alone
+/// @param pool pool
+/// @param bytes cutoff in bytes, CONV_ENDIAN_PARALLEL_CUTOFF when the pool is created
+void conv_endian_pool_set_cutoff(conv_endian_pool* pool, size_t bytes);
+
+/// @brief Gets the number of bytes below which a pool converts arrays with the calling thread alone
+/// @param pool pool
+/// @return cutoff in bytes
+size_t conv_endian_pool_get_cutoff(const conv_endian_pool* pool);
+
+/// @brief Reverses the bytes of every 16-bit value in an array with the threads of a pool
+/// @param pool pool, or NULL to convert with the calling thread alone
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 16-bit values
+/// @param count number of values in src
+void conv_endian_parallel_bswap16_array(conv_endian_pool* pool, void* dst, const void* src, size_t count);
+
+/// @brief Reverses the bytes of every 32-bit value in an array with the threads of a pool
+/// @param pool pool, or NULL to convert with the calling thread alone
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 32-bit values
+/// @param count number of values in src
+void conv_endian_parallel_bswap32_array(conv_endian_pool* pool, void* dst, const void* src, size_t count);
+
+/// @brief Reverses the bytes of every 64-bit value in an array with the threads of a pool
+/// @param pool pool, or NULL to convert with the calling thread alone
+/// @param dst array that receives the byte swapped values, may be the same array as src
+/// @param src array of 64-bit values
+/// @param count number of values in src
+void conv_endian_parallel_bswap64_array(conv_endian_pool* pool, void* dst, const void* src, size_t count);
+
+/// @brief Rearranges the bytes of every record in an array of fixed size records with the threads of a pool
+/// @param pool pool, or NULL to convert with the calling thread alone
+/// @param dst array that receives the rearranged records, may be the same array as src
+/// @param src array of records
+/// @param count number of records in src
+/// @param record_size number of bytes in a record
+/// @param perm record_size byte indices, byte i of every record in dst is byte perm[i] of the same record in src
+/// @return 0 on success or -1, without converting anything, if memory for converting records larger than 256 bytes in place could not be allocated
+int conv_endian_parallel_permute_records(conv_endian_pool* pool, void* dst, const void* src, size_t count, size_t record_size, const uint16_t* perm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,712 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_pcm.c
+/// @brief A C portable source code that contains implementation of functions for converting PCM audio samples from and into floating point numbers
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Scalar samples
+
+    A sample of width bytes is scaled by 2^-(8 * width - 1), which is exact
+    for 16-bit and 24-bit samples and rounds 32-bit samples to the 24 bits
+    of a float the same way the vector conversion does. Rounding to the
+    nearest integer when writing adds and subtracts 2^23, which leaves no
+    fractional bits in a float, instead of calling lrintf, so the library
+    does not need the math library.
+
+*/
+
+/// @brief Number of samples that the _planar functions convert at a time through a buffer on the stack
+#define PCM_BLOCK 2048
+
+static uint32_t pcm_load(const unsigned char* ptr, size_t width, int big)
+{
+    uint32_t val = 0;
+    size_t i;
+
+    for (i = 0; i < width; i++)
+        val = (val << 8) | ptr[big ? i : width - 1 - i];
+
+    return val;
+}
+
+static void pcm_store(unsigned char* ptr, uint32_t val, size_t width, int big)
+{
+    size_t i;
+
+    for (i = 0; i < width; i++)
+        ptr[big ? width - 1 - i : i] = (unsigned char)(val >> (8 * i));
+}
+
+static float pcm_scale(size_t width)
+{
+    return (float)((uint32_t)1 << (8 * width - 1));
+}
+
+// the largest float that converts into a sample of width bytes
+static float pcm_high(size_t width)
+{
+    // 2^31 - 1 is not a float
+    if (width == 4)
+        return 2147483520.0f;
+
+    return pcm_scale(width) - 1.0f;
+}
+
+static float pcm_decode_one(const unsigned char* ptr, size_t width, int big, float unit)
+{
+    int64_t half = (int64_t)1 << (8 * width - 1);
+
+    return (float)((int64_t)(pcm_load(ptr, width, big) ^ (uint32_t)half) - half) * unit;
+}
+
+static uint32_t pcm_encode_one(float val, float scale, float high)
+{
+    float x = val * scale;
+
+    if (x != x)
+        return 0;
+
+    if (x <= -scale)
+        return (uint32_t)(-(int64_t)scale);
+
+    if (x >= high)
+        return (uint32_t)(int64_t)high;
+
+    // ties to even, like the conversion of the vector kernels
+    if (x >= 0.0f && x < 8388608.0f)
+        x = (x + 8388608.0f) - 8388608.0f;
+    else if (x < 0.0f && x > -8388608.0f)
+        x = (x - 8388608.0f) + 8388608.0f;
+
+    return (uint32_t)(int64_t)x;
+}
+
+/*
+
+    Vector kernels
+
+    Reading shuffles the bytes of every sample into the highest bytes of a
+    32-bit lane, which byte swaps and sign extends it at once, so every
+    width is converted with the same scale of 2^-31. Writing scales,
+    clamps and converts four samples into 32-bit integers, and the inverse
+    shuffle keeps the lowest width bytes of each lane in the order of the
+    array.
+
+    Shuffles only move bytes within 16-byte blocks, so 24-bit samples are
+    loaded four at a time, from blocks 12 bytes apart. The SSSE3 kernels
+    load and store 4 bytes past the last sample of such a block, which
+    the loops leave room for, and the AVX-512 kernels use masked loads and
+    stores instead.
+
+    Each kernel returns the number of samples it has converted so that the
+    caller can finish the rest one at a time.
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+// four samples starting at sample first of a 16-byte block into the highest bytes of four 32-bit lanes
+static void decode_mask(signed char* mask, size_t first, size_t width, int big)
+{
+    size_t lane, byte;
+
+    for (lane = 0; lane < 4; lane++)
+    {
+        for (byte = 0; byte < 4; byte++)
+        {
+            size_t sig = byte + width - 4;
+
+            if (byte + width < 4)
+                mask[lane * 4 + byte] = -128;
+            else
+                mask[lane * 4 + byte] = (signed char)((first + lane) * width + (big ? width - 1 - sig : sig));
+        }
+    }
+}
+
+// the lowest width bytes of four 32-bit lanes into samples starting at byte offset of a 16-byte block
+static void encode_mask(signed char* mask, size_t offset, size_t width, int big)
+{
+    size_t lane, sig;
+
+    memset(mask, -128, 16);
+
+    for (lane = 0; lane < 4; lane++)
+    {
+        for (sig = 0; sig < width; sig++)
+            mask[offset + lane * width + (big ? width - 1 - sig : sig)] = (signed char)(lane * 4 + sig);
+    }
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i mask_128(const signed char* mask)
+{
+    return _mm_loadu_si128((const __m128i*)mask);
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128 decode_block_128(__m128i val, __m128i mask)
+{
+    return _mm_mul_ps(_mm_cvtepi32_ps(_mm_shuffle_epi8(val, mask)), _mm_set1_ps(1.0f / 2147483648.0f));
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i encode_block_128(const float* src, __m128 scale, __m128 high)
+{
+    __m128 x = _mm_mul_ps(_mm_loadu_ps(src), scale);
+
+    x = _mm_and_ps(x, _mm_cmpord_ps(x, x));
+    x = _mm_min_ps(_mm_max_ps(x, _mm_sub_ps(_mm_setzero_ps(), scale)), high);
+    return _mm_cvtps_epi32(x);
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t decode_ssse3(float* dst, const unsigned char* src, size_t count, size_t width, int big)
+{
+    signed char lo[16], hi[16];
+    __m128i mask_lo, mask_hi;
+    size_t i = 0;
+
+    decode_mask(lo, 0, width, big);
+    decode_mask(hi, 4, width, big);
+    mask_lo = mask_128(lo);
+    mask_hi = mask_128(hi);
+
+    if (width == 2)
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i val = _mm_loadu_si128((const __m128i*)(src + i * 2));
+            _mm_storeu_ps(dst + i, decode_block_128(val, mask_lo));
+            _mm_storeu_ps(dst + i + 4, decode_block_128(val, mask_hi));
+        }
+    }
+    else if (width == 3)
+    {
+        for (; i + 6 <= count; i += 4)
+            _mm_storeu_ps(dst + i, decode_block_128(_mm_loadu_si128((const __m128i*)(src + i * 3)), mask_lo));
+    }
+    else
+    {
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_ps(dst + i, decode_block_128(_mm_loadu_si128((const __m128i*)(src + i * 4)), mask_lo));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static size_t encode_ssse3(unsigned char* dst, const float* src, size_t count, size_t width, int big)
+{
+    signed char lo[16], hi[16];
+    __m128i mask_lo;
+    __m128 scale = _mm_set1_ps(pcm_scale(width));
+    __m128 high = _mm_set1_ps(pcm_high(width));
+    size_t i = 0;
+
+    encode_mask(lo, 0, width, big);
+    mask_lo = mask_128(lo);
+
+    if (width == 2)
+    {
+        // the second four samples go into the highest 8 bytes
+        __m128i mask_hi;
+
+        encode_mask(hi, 8, width, big);
+        mask_hi = mask_128(hi);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i a = _mm_shuffle_epi8(encode_block_128(src + i, scale, high), mask_lo);
+            __m128i b = _mm_shuffle_epi8(encode_block_128(src + i + 4, scale, high), mask_hi);
+            _mm_storeu_si128((__m128i*)(dst + i * 2), _mm_or_si128(a, b));
+        }
+    }
+    else if (width == 3)
+    {
+        // the 4 bytes past each block are written again by the next one
+        for (; i + 6 <= count; i += 4)
+            _mm_storeu_si128((__m128i*)(dst + i * 3), _mm_shuffle_epi8(encode_block_128(src + i, scale, high), mask_lo));
+    }
+    else
+    {
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_si128((__m128i*)(dst + i * 4), _mm_shuffle_epi8(encode_block_128(src + i, scale, high), mask_lo));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static __m256i mask_256(const signed char* lo, const signed char* hi)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)lo)), _mm_loadu_si128((const __m128i*)hi), 1);
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static __m256 decode_block_256(__m256i val, __m256i mask)
+{
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_shuffle_epi8(val, mask)), _mm256_set1_ps(1.0f / 2147483648.0f));
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static __m256i encode_block_256(const float* src, __m256 scale, __m256 high)
+{
+    __m256 x = _mm256_mul_ps(_mm256_loadu_ps(src), scale);
+
+    x = _mm256_and_ps(x, _mm256_cmp_ps(x, x, _CMP_ORD_Q));
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_sub_ps(_mm256_setzero_ps(), scale)), high);
+    return _mm256_cvtps_epi32(x);
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t decode_avx2(float* dst, const unsigned char* src, size_t count, size_t width, int big)
+{
+    signed char lo[16], hi[16];
+    size_t i = 0;
+
+    decode_mask(lo, 0, width, big);
+    decode_mask(hi, 4, width, big);
+
+    if (width == 2)
+    {
+        __m256i mask = mask_256(lo, hi);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i val = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(src + i * 2)));
+            _mm256_storeu_ps(dst + i, decode_block_256(val, mask));
+        }
+    }
+    else if (width == 3)
+    {
+        __m256i mask = mask_256(lo, lo);
+
+        for (; i + 10 <= count; i += 8)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i*)(src + i * 3));
+            __m128i b = _mm_loadu_si128((const __m128i*)(src + i * 3 + 12));
+            _mm256_storeu_ps(dst + i, decode_block_256(_mm256_inserti128_si256(_mm256_castsi128_si256(a), b, 1), mask));
+        }
+    }
+    else
+    {
+        __m256i mask = mask_256(lo, lo);
+
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, decode_block_256(_mm256_loadu_si256((const __m256i*)(src + i * 4)), mask));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t encode_avx2(unsigned char* dst, const float* src, size_t count, size_t width, int big)
+{
+    signed char lo[16];
+    __m256i mask;
+    __m256 scale = _mm256_set1_ps(pcm_scale(width));
+    __m256 high = _mm256_set1_ps(pcm_high(width));
+    size_t i = 0;
+
+    encode_mask(lo, 0, width, big);
+    mask = mask_256(lo, lo);
+
+    if (width == 2)
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i val = _mm256_shuffle_epi8(encode_block_256(src + i, scale, high), mask);
+            val = _mm256_permute4x64_epi64(val, 0x08);
+            _mm_storeu_si128((__m128i*)(dst + i * 2), _mm256_castsi256_si128(val));
+        }
+    }
+    else if (width == 3)
+    {
+        __m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i val = _mm256_shuffle_epi8(encode_block_256(src + i, scale, high), mask);
+            val = _mm256_permutevar8x32_epi32(val, pack);
+            _mm_storeu_si128((__m128i*)(dst + i * 3), _mm256_castsi256_si128(val));
+            _mm_storel_epi64((__m128i*)(dst + i * 3 + 16), _mm256_extracti128_si256(val, 1));
+        }
+    }
+    else
+    {
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_si256((__m256i*)(dst + i * 4), _mm256_shuffle_epi8(encode_block_256(src + i, scale, high), mask));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static __m512i mask_512(const signed char* lo, const signed char* hi)
+{
+    __m512i mask = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i*)lo));
+
+    mask = _mm512_inserti32x4(mask, _mm_loadu_si128((const __m128i*)hi), 1);
+    return _mm512_shuffle_i64x2(mask, mask, 0x44);
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static __m512 decode_block_512(__m512i val, __m512i mask)
+{
+    return _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_shuffle_epi8(val, mask)), _mm512_set1_ps(1.0f / 2147483648.0f));
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static __m512i encode_block_512(const float* src, __m512 scale, __m512 high)
+{
+    __m512 x = _mm512_mul_ps(_mm512_loadu_ps(src), scale);
+
+    x = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x, x, _CMP_ORD_Q), x);
+    x = _mm512_min_ps(_mm512_max_ps(x, _mm512_sub_ps(_mm512_setzero_ps(), scale)), high);
+    return _mm512_cvtps_epi32(x);
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t decode_avx512(float* dst, const unsigned char* src, size_t count, size_t width, int big)
+{
+    signed char lo[16], hi[16];
+    size_t i = 0;
+
+    decode_mask(lo, 0, width, big);
+    decode_mask(hi, 4, width, big);
+
+    if (width == 2)
+    {
+        __m512i mask = mask_512(lo, hi);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i val = _mm512_castsi256_si512(_mm256_loadu_si256((const __m256i*)(src + i * 2)));
+            _mm512_storeu_ps(dst + i, decode_block_512(_mm512_shuffle_i64x2(val, val, 0x50), mask));
+        }
+    }
+    else if (width == 3)
+    {
+        __m512i mask = mask_512(lo, lo);
+        __m512i spread = _mm512_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6, 6, 7, 8, 9, 9, 10, 11, 12);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i val = _mm512_maskz_loadu_epi32(0x0FFF, src + i * 3);
+            _mm512_storeu_ps(dst + i, decode_block_512(_mm512_permutexvar_epi32(spread, val), mask));
+        }
+    }
+    else
+    {
+        __m512i mask = mask_512(lo, lo);
+
+        for (; i + 16 <= count; i += 16)
+            _mm512_storeu_ps(dst + i, decode_block_512(_mm512_loadu_si512((const void*)(src + i * 4)), mask));
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t encode_avx512(unsigned char* dst, const float* src, size_t count, size_t width, int big)
+{
+    signed char lo[16];
+    __m512i mask;
+    __m512 scale = _mm512_set1_ps(pcm_scale(width));
+    __m512 high = _mm512_set1_ps(pcm_high(width));
+    size_t i = 0;
+
+    encode_mask(lo, 0, width, big);
+    mask = mask_512(lo, lo);
+
+    if (width == 2)
+    {
+        __m512i pack = _mm512_setr_epi64(0, 2, 4, 6, 0, 0, 0, 0);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i val = _mm512_shuffle_epi8(encode_block_512(src + i, scale, high), mask);
+            val = _mm512_permutexvar_epi64(pack, val);
+            _mm256_storeu_si256((__m256i*)(dst + i * 2), _mm512_castsi512_si256(val));
+        }
+    }
+    else if (width == 3)
+    {
+        __m512i pack = _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0, 0, 0, 0);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i val = _mm512_shuffle_epi8(encode_block_512(src + i, scale, high), mask);
+            _mm512_mask_storeu_epi32(dst + i * 3, 0x0FFF, _mm512_permutexvar_epi32(pack, val));
+        }
+    }
+    else
+    {
+        for (; i + 16 <= count; i += 16)
+            _mm512_storeu_si512((void*)(dst + i * 4), _mm512_shuffle_epi8(encode_block_512(src + i, scale, high), mask));
+    }
+
+    return i;
+}
+
+#endif
+
+/*
+
+    Kernel selection
+
+*/
+
+static size_t pcm_decode(float* dst, const unsigned char* src, size_t count, size_t width, int big)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return decode_avx512(dst, src, count, width, big);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return decode_avx2(dst, src, count, width, big);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        return decode_ssse3(dst, src, count, width, big);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)width;
+    (void)big;
+    return 0;
+}
+
+static size_t pcm_encode(unsigned char* dst, const float* src, size_t count, size_t width, int big)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return encode_avx512(dst, src, count, width, big);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return encode_avx2(dst, src, count, width, big);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        return encode_ssse3(dst, src, count, width, big);
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)width;
+    (void)big;
+    return 0;
+}
+
+/*
+
+    Conversions
+
+*/
+
+static void decode_array(float* dst, const unsigned char* src, size_t count, size_t width, int big)
+{
+    float unit = 1.0f / pcm_scale(width);
+    size_t i;
+
+    for (i = pcm_decode(dst, src, count, width, big); i < count; i++)
+        dst[i] = pcm_decode_one(src + i * width, width, big, unit);
+}
+
+static void encode_array(unsigned char* dst, const float* src, size_t count, size_t width, int big)
+{
+    float scale = pcm_scale(width);
+    float high = pcm_high(width);
+    size_t i;
+
+    for (i = pcm_encode(dst, src, count, width, big); i < count; i++)
+        pcm_store(dst + i * width, pcm_encode_one(src[i], scale, high), width, big);
+}
+
+static int pcm_supported(size_t width)
+{
+    return width >= 2 && width <= 4;
+}
+
+/*
+
+    Interleaved samples are converted a block of frames at a time into a
+    buffer that stays in the cache, and moved between the buffer and the
+    arrays of the channels from there. A frame with more than PCM_BLOCK
+    channels is converted in pieces of PCM_BLOCK samples.
+
+*/
+
+static void pcm_block(size_t channels, size_t* frames, size_t* samples)
+{
+    *frames = channels <= PCM_BLOCK ? PCM_BLOCK / channels : 1;
+    *samples = channels <= PCM_BLOCK ? channels : PCM_BLOCK;
+}
+
+/// @brief Reads an array of PCM samples into an array of 32-bit floating point numbers
+/// @param dst array that receives count samples in [-1, 1)
+/// @param src array of count samples, must not overlap dst
+/// @param count number of samples in src
+/// @param width number of bytes in a sample: 2, 3 or 4
+/// @param order endianness of the samples
+/// @return 0 on success or -1 if width is not supported
+int conv_endian_pcm_to_float(float* dst, const void* src, size_t count, size_t width, conv_endian_order order)
+{
+    if (!pcm_supported(width))
+        return -1;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PCM_DECODE, count * width);
+    decode_array(dst, (const unsigned char*)src, count, width, order == CONV_ENDIAN_ORDER_BIG);
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PCM_DECODE, count * width);
+    return 0;
+}
+
+/// @brief Writes an array of 32-bit floating point numbers as PCM samples
+/// @param dst array that receives count samples, must not overlap src
+/// @param src array of count samples in [-1, 1), samples outside are clamped
+/// @param count number of samples in src
+/// @param width number of bytes in a sample: 2, 3 or 4
+/// @param order endianness the samples are written in
+/// @return 0 on success or -1 if width is not supported
+int conv_endian_float_to_pcm(void* dst, const float* src, size_t count, size_t width, conv_endian_order order)
+{
+    if (!pcm_supported(width))
+        return -1;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PCM_ENCODE, count * sizeof(float));
+    encode_array((unsigned char*)dst, src, count, width, order == CONV_ENDIAN_ORDER_BIG);
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PCM_ENCODE, count * sizeof(float));
+    return 0;
+}
+
+/// @brief Reads interleaved PCM samples into one array of 32-bit floating point numbers per channel
+/// @param dst channels arrays that each receive frames samples in [-1, 1)
+/// @param src array of frames frames of channels samples each, must not overlap any array of dst
+/// @param frames number of frames in src
+/// @param channels number of channels
+/// @param width number of bytes in a sample: 2, 3 or 4
+/// @param order endianness of the samples
+/// @return 0 on success or -1 if width is not supported or channels is 0
+int conv_endian_pcm_to_float_planar(float* const* dst, const void* src, size_t frames, size_t channels, size_t width, conv_endian_order order)
+{
+    const unsigned char* bytes = (const unsigned char*)src;
+    int big = order == CONV_ENDIAN_ORDER_BIG;
+    float block[PCM_BLOCK];
+    size_t block_frames, block_samples;
+    size_t frame, channel, n, m, i, j;
+
+    if (!pcm_supported(width) || channels == 0)
+        return -1;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PCM_DECODE, frames * channels * width);
+    pcm_block(channels, &block_frames, &block_samples);
+
+    for (frame = 0; frame < frames; frame += n)
+    {
+        n = frames - frame < block_frames ? frames - frame : block_frames;
+
+        for (channel = 0; channel < channels; channel += m)
+        {
+            m = channels - channel < block_samples ? channels - channel : block_samples;
+
+            // n frames of all channels, or part of one frame, are contiguous
+            decode_array(block, bytes + (frame * channels + channel) * width, n * m, width, big);
+
+            for (j = 0; j < m; j++)
+            {
+                float* out = dst[channel + j] + frame;
+
+                for (i = 0; i < n; i++)
+                    out[i] = block[i * m + j];
+            }
+        }
+    }
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PCM_DECODE, frames * channels * width);
+    return 0;
+}
+
+/// @brief Writes one array of 32-bit floating point numbers per channel as interleaved PCM samples
+/// @param dst array that receives frames frames of channels samples each, must not overlap any array of src
+/// @param src channels arrays of frames samples each in [-1, 1), samples outside are clamped
+/// @param frames number of frames
+/// @param channels number of channels
+/// @param width number of bytes in a sample: 2, 3 or 4
+/// @param order endianness the samples are written in
+/// @return 0 on success or -1 if width is not supported or channels is 0
+int conv_endian_float_to_pcm_planar(void* dst, const float* const* src, size_t frames, size_t channels, size_t width, conv_endian_order order)
+{
+    unsigned char* bytes = (unsigned char*)dst;
+    int big = order == CONV_ENDIAN_ORDER_BIG;
+    float block[PCM_BLOCK];
+    size_t block_frames, block_samples;
+    size_t frame, channel, n, m, i, j;
+
+    if (!pcm_supported(width) || channels == 0)
+        return -1;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_PCM_ENCODE, frames * channels * sizeof(float));
+    pcm_block(channels, &block_frames, &block_samples);
+
+    for (frame = 0; frame < frames; frame += n)
+    {
+        n = frames - frame < block_frames ? frames - frame : block_frames;
+
+        for (channel = 0; channel < channels; channel += m)
+        {
+            m = channels - channel < block_samples ? channels - channel : block_samples;
+
+            for (j = 0; j < m; j++)
+            {
+                const float* in = src[channel + j] + frame;
+
+                for (i = 0; i < n; i++)
+                    block[i * m + j] = in[i];
+            }
+
+            encode_array(bytes + (frame * channels + channel) * width, block, n * m, width, big);
+        }
+    }
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_PCM_ENCODE, frames * channels * sizeof(float));
+    return 0;
+}
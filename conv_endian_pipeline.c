@@ -0,0 +1,718 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_pipeline.c
+/// @brief A C portable source code that contains implementation of functions for converting files with overlapped reads and writes
+
+
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "conv_endian_pipeline.h"
+#include "conv_endian.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if defined(__linux__) && !defined(CONV_ENDIAN_NO_IO_URING) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define CONV_ENDIAN_IO_URING 1
+#endif
+#endif
+
+#if defined(CONV_ENDIAN_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+// blocks are aligned for direct I/O
+#define BLOCK_ALIGNMENT 4096
+
+typedef struct pipeline_job
+{
+    int dst_fd;
+    int src_fd;
+    uint64_t dst_offset;
+    uint64_t src_offset;
+    uint64_t length;
+    size_t block_size;
+    unsigned queue_depth;
+    size_t width;
+    conv_endian_block_func convert;
+    void* context;
+    conv_endian_pipeline_stats* stats;
+} pipeline_job;
+
+/*
+
+    Converting blocks
+
+*/
+
+static void convert_block(const pipeline_job* job, unsigned char* block, size_t bytes)
+{
+    // a partial element can only end the last block, and is left as it is
+    size_t whole = bytes - bytes % job->width;
+
+    if (whole == 0)
+        return;
+
+    if (job->convert != NULL)
+    {
+        job->convert(block, whole, job->context);
+        return;
+    }
+
+    switch (job->width)
+    {
+    case 2:
+        conv_endian_bswap16_array(block, block, whole / 2);
+        break;
+    case 4:
+        conv_endian_bswap32_array(block, block, whole / 4);
+        break;
+    case 8:
+        conv_endian_bswap64_array(block, block, whole / 8);
+        break;
+    default:
+        break;
+    }
+}
+
+static unsigned char* alloc_blocks(size_t bytes)
+{
+    void* blocks;
+
+    if (posix_memalign(&blocks, BLOCK_ALIGNMENT, bytes) != 0)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    return (unsigned char*)blocks;
+}
+
+/*
+
+    pread and pwrite
+
+*/
+
+static int write_all(int fd, const unsigned char* buf, size_t bytes, uint64_t offset, conv_endian_pipeline_stats* stats)
+{
+    while (bytes > 0)
+    {
+        ssize_t written = pwrite(fd, buf, bytes, (off_t)offset);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+
+        if (written == 0)
+        {
+            errno = EIO;
+            return -1;
+        }
+
+        stats->writes++;
+        buf += written;
+        bytes -= (size_t)written;
+        offset += (uint64_t)written;
+    }
+
+    return 0;
+}
+
+static int run_pread(const pipeline_job* job)
+{
+    unsigned char* block = alloc_blocks(job->block_size);
+    uint64_t done = 0;
+
+    if (block == NULL)
+        return -1;
+
+    while (done < job->length)
+    {
+        size_t want = job->length - done < job->block_size ? (size_t)(job->length - done) : job->block_size;
+        size_t got = 0;
+
+        while (got < want)
+        {
+            ssize_t n = pread(job->src_fd, block + got, want - got, (off_t)(job->src_offset + done + got));
+
+            if (n < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                free(block);
+                return -1;
+            }
+
+            job->stats->reads++;
+
+            if (n == 0)
+                break;
+
+            got += (size_t)n;
+        }
+
+        if (got == 0)
+            break;
+
+        convert_block(job, block, got);
+
+        if (write_all(job->dst_fd, block, got, job->dst_offset + done, job->stats) != 0)
+        {
+            free(block);
+            return -1;
+        }
+
+        done += got;
+        job->stats->bytes += got;
+
+        // the file ended before the range did
+        if (got < want)
+            break;
+    }
+
+    free(block);
+    return 0;
+}
+
+/*
+
+    io_uring
+
+    The rings are set up and driven with the io_uring_setup and
+    io_uring_enter system calls directly. Each block in flight has at most
+    one read or write queued, so a submission queue of queue_depth entries
+    can never overflow. Short reads and writes are queued again for the
+    rest of the block.
+
+*/
+
+#if defined(CONV_ENDIAN_IO_URING)
+
+#if !defined(__NR_io_uring_setup)
+#define __NR_io_uring_setup 425
+#endif
+
+#if !defined(__NR_io_uring_enter)
+#define __NR_io_uring_enter 426
+#endif
+
+typedef struct uring
+{
+    int fd;
+    unsigned* sq_tail;
+    unsigned sq_mask;
+    unsigned* sq_array;
+    struct io_uring_sqe* sqes;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe* cqes;
+    void* sq_ring;
+    size_t sq_ring_size;
+    void* cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+    unsigned queued;
+} uring;
+
+static void uring_close(uring* ring)
+{
+    if (ring->sqes != NULL)
+        munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != NULL && ring->cq_ring != ring->sq_ring)
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    if (ring->sq_ring != NULL)
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    if (ring->fd >= 0)
+        close(ring->fd);
+}
+
+static int uring_open(uring* ring, unsigned entries)
+{
+    struct io_uring_params params;
+    unsigned char* sq;
+    unsigned char* cq;
+    int saved;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+
+    ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0)
+        return -1;
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    // both rings share one mapping on kernels that support it
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (ring->cq_ring_size > ring->sq_ring_size)
+            ring->sq_ring_size = ring->cq_ring_size;
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED)
+    {
+        ring->sq_ring = NULL;
+        goto fail;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->cq_ring = ring->sq_ring;
+    }
+    else
+    {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED)
+        {
+            ring->cq_ring = NULL;
+            goto fail;
+        }
+    }
+
+    ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+    {
+        ring->sqes = NULL;
+        goto fail;
+    }
+
+    sq = (unsigned char*)ring->sq_ring;
+    cq = (unsigned char*)ring->cq_ring;
+    ring->sq_tail = (unsigned*)(sq + params.sq_off.tail);
+    ring->sq_mask = *(unsigned*)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned*)(sq + params.sq_off.array);
+    ring->cq_head = (unsigned*)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned*)(cq + params.cq_off.tail);
+    ring->cq_mask = *(unsigned*)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+    return 0;
+
+fail:
+    saved = errno;
+    uring_close(ring);
+    errno = saved;
+    return -1;
+}
+
+static void uring_queue(uring* ring, int opcode, int fd, struct iovec* iov, uint64_t offset, uint64_t user_data)
+{
+    unsigned tail = *ring->sq_tail;
+    unsigned index = tail & ring->sq_mask;
+    struct io_uring_sqe* sqe = ring->sqes + index;
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = (uint8_t)opcode;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)iov;
+    sqe->len = 1;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+    ring->sq_array[index] = index;
+
+    // the kernel must see the entry before the new tail
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->queued++;
+}
+
+// submits the queued entries and waits for at least one completion
+static int uring_submit_and_wait(uring* ring)
+{
+    for (;;)
+    {
+        long submitted = syscall(__NR_io_uring_enter, ring->fd, ring->queued, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+
+        if (submitted >= 0)
+        {
+            ring->queued -= (unsigned)submitted;
+            return 0;
+        }
+
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            return -1;
+    }
+}
+
+enum
+{
+    SLOT_FREE,
+    SLOT_READING,
+    SLOT_WRITING
+};
+
+typedef struct pipeline_slot
+{
+    unsigned char* block;
+    struct iovec iov;
+    uint64_t pos; // offset of the block in the range
+    size_t size; // number of bytes to be read or written
+    size_t done; // number of bytes read or written so far
+    int state;
+} pipeline_slot;
+
+static void queue_slot(uring* ring, const pipeline_job* job, pipeline_slot* slot, uint64_t index)
+{
+    slot->iov.iov_base = slot->block + slot->done;
+    slot->iov.iov_len = slot->size - slot->done;
+
+    if (slot->state == SLOT_READING)
+        uring_queue(ring, IORING_OP_READV, job->src_fd, &slot->iov, job->src_offset + slot->pos + slot->done, index);
+    else
+        uring_queue(ring, IORING_OP_WRITEV, job->dst_fd, &slot->iov, job->dst_offset + slot->pos + slot->done, index);
+}
+
+static int run_uring(const pipeline_job* job, uring* ring)
+{
+    pipeline_slot* slots = (pipeline_slot*)calloc(job->queue_depth, sizeof(pipeline_slot));
+    unsigned char* blocks = alloc_blocks(job->block_size * job->queue_depth);
+    uint64_t next = 0;
+    uint64_t end = job->length;
+    unsigned active = 0;
+    int error = 0;
+    unsigned i;
+
+    if (slots == NULL || blocks == NULL)
+    {
+        free(slots);
+        free(blocks);
+        errno = ENOMEM;
+        return -1;
+    }
+
+    for (i = 0; i < job->queue_depth; i++)
+        slots[i].block = blocks + (size_t)i * job->block_size;
+
+    for (;;)
+    {
+        unsigned head, tail;
+
+        // every free block starts reading the next part of the range
+        for (i = 0; i < job->queue_depth && !error && next < end; i++)
+        {
+            pipeline_slot* slot = slots + i;
+
+            if (slot->state != SLOT_FREE)
+                continue;
+
+            slot->pos = next;
+            slot->size = end - next < job->block_size ? (size_t)(end - next) : job->block_size;
+            slot->done = 0;
+            slot->state = SLOT_READING;
+            queue_slot(ring, job, slot, i);
+            next += slot->size;
+            active++;
+        }
+
+        if (active == 0)
+            break;
+
+        if (uring_submit_and_wait(ring) != 0)
+        {
+            // the blocks may still be in use by the kernel, so they are
+            // leaked rather than freed
+            return -1;
+        }
+
+        head = *ring->cq_head;
+        tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+        for (; head != tail; head++)
+        {
+            const struct io_uring_cqe* cqe = ring->cqes + (head & ring->cq_mask);
+            pipeline_slot* slot = slots + cqe->user_data;
+            int res = cqe->res;
+
+            if (res < 0 || error)
+            {
+                if (res == -EINTR || res == -EAGAIN)
+                {
+                    if (!error)
+                    {
+                        queue_slot(ring, job, slot, cqe->user_data);
+                        continue;
+                    }
+                }
+                else if (res < 0 && !error)
+                {
+                    error = -res;
+                }
+
+                slot->state = SLOT_FREE;
+                active--;
+                continue;
+            }
+
+            if (slot->state == SLOT_READING)
+            {
+                job->stats->reads++;
+                slot->done += (size_t)res;
+
+                // the file ended before the range did
+                if (res == 0)
+                {
+                    if (slot->pos + slot->done < end)
+                        end = slot->pos + slot->done;
+
+                    if (slot->done == 0)
+                    {
+                        slot->state = SLOT_FREE;
+                        active--;
+                        continue;
+                    }
+                }
+                else if (slot->done < slot->size)
+                {
+                    queue_slot(ring, job, slot, cqe->user_data);
+                    continue;
+                }
+
+                convert_block(job, slot->block, slot->done);
+                slot->size = slot->done;
+                slot->done = 0;
+                slot->state = SLOT_WRITING;
+                queue_slot(ring, job, slot, cqe->user_data);
+            }
+            else
+            {
+                job->stats->writes++;
+
+                if (res == 0)
+                {
+                    error = EIO;
+                    slot->state = SLOT_FREE;
+                    active--;
+                    continue;
+                }
+
+                slot->done += (size_t)res;
+
+                if (slot->done < slot->size)
+                {
+                    queue_slot(ring, job, slot, cqe->user_data);
+                    continue;
+                }
+
+                job->stats->bytes += slot->size;
+                slot->state = SLOT_FREE;
+                active--;
+            }
+        }
+
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    free(slots);
+    free(blocks);
+
+    if (error)
+    {
+        errno = error;
+        return -1;
+    }
+
+    return 0;
+}
+
+#endif
+
+/*
+
+    Pipelines
+
+*/
+
+/// @brief Fills options with the defaults
+/// @param options options to be filled
+void conv_endian_pipeline_default_options(conv_endian_pipeline_options* options)
+{
+    options->block_size = CONV_ENDIAN_PIPELINE_BLOCK;
+    options->queue_depth = CONV_ENDIAN_PIPELINE_DEPTH;
+    options->width = 4;
+    options->backend = CONV_ENDIAN_BACKEND_AUTO;
+    options->convert = NULL;
+    options->context = NULL;
+}
+
+/// @brief Converts a range of a file into another file
+/// @param dst_fd file descriptor that receives the converted elements, may be src_fd
+/// @param dst_offset offset in dst_fd of the first converted byte
+/// @param src_fd file descriptor of the elements to be converted
+/// @param src_offset offset in src_fd of the first element
+/// @param length number of bytes to be converted, or CONV_ENDIAN_PIPELINE_TO_END
+/// @param options options, or NULL for the defaults
+/// @param stats statistics of the conversion, may be NULL
+/// @return 0 on success or -1 with errno set
+int conv_endian_pipeline_convert_fd(int dst_fd, uint64_t dst_offset, int src_fd, uint64_t src_offset, uint64_t length, const conv_endian_pipeline_options* options, conv_endian_pipeline_stats* stats)
+{
+    conv_endian_pipeline_options defaults;
+    conv_endian_pipeline_stats ignored;
+    pipeline_job job;
+
+    if (options == NULL)
+    {
+        conv_endian_pipeline_default_options(&defaults);
+        options = &defaults;
+    }
+
+    if (stats == NULL)
+        stats = &ignored;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->backend = CONV_ENDIAN_BACKEND_PREAD;
+
+    if (options->width == 0 || options->block_size < options->width || options->queue_depth == 0 ||
+        (options->convert == NULL && options->width != 1 && options->width != 2 && options->width != 4 && options->width != 8))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    // the size comes from fstat, seeking would move the offset of a descriptor of the caller
+    if (length == CONV_ENDIAN_PIPELINE_TO_END)
+    {
+        struct stat st;
+
+        if (fstat(src_fd, &st) != 0)
+            return -1;
+
+        length = (uint64_t)st.st_size > src_offset ? (uint64_t)st.st_size - src_offset : 0;
+    }
+
+    job.dst_fd = dst_fd;
+    job.src_fd = src_fd;
+    job.dst_offset = dst_offset;
+    job.src_offset = src_offset;
+    job.length = length;
+    job.block_size = options->block_size - options->block_size % options->width;
+    job.queue_depth = options->queue_depth;
+    job.width = options->width;
+    job.convert = options->convert;
+    job.context = options->context;
+    job.stats = stats;
+
+#if defined(CONV_ENDIAN_IO_URING)
+    if (options->backend != CONV_ENDIAN_BACKEND_PREAD)
+    {
+        uring ring;
+
+        if (uring_open(&ring, job.queue_depth) == 0)
+        {
+            int result;
+
+            stats->backend = CONV_ENDIAN_BACKEND_IO_URING;
+            result = run_uring(&job, &ring);
+
+            if (result != 0)
+            {
+                int saved = errno;
+                uring_close(&ring);
+                errno = saved;
+                return -1;
+            }
+
+            uring_close(&ring);
+            return 0;
+        }
+
+        if (options->backend == CONV_ENDIAN_BACKEND_IO_URING)
+            return -1;
+    }
+#else
+    if (options->backend == CONV_ENDIAN_BACKEND_IO_URING)
+    {
+        errno = ENOSYS;
+        return -1;
+    }
+#endif
+
+    return run_pread(&job);
+}
+
+/// @brief Converts a whole file into a new file
+/// @param dst_path path of the file that receives the converted elements, created or truncated
+/// @param src_path path of the file of elements to be converted
+/// @param options options, or NULL for the defaults
+/// @param stats statistics of the conversion, may be NULL
+/// @return 0 on success or -1 with errno set
+int conv_endian_pipeline_convert_file(const char* dst_path, const char* src_path, const conv_endian_pipeline_options* options, conv_endian_pipeline_stats* stats)
+{
+    conv_endian_pipeline_stats ignored;
+    struct stat src_info, dst_info;
+    int src_fd, dst_fd;
+    int result;
+    int saved;
+
+    if (stats == NULL)
+        stats = &ignored;
+
+    src_fd = open(src_path, O_RDONLY);
+    if (src_fd < 0)
+        return -1;
+
+    // the destination is only truncated once it has been converted, so
+    // that converting a file into itself works in place
+    dst_fd = open(dst_path, O_WRONLY | O_CREAT, 0666);
+    if (dst_fd < 0 || fstat(src_fd, &src_info) != 0 || fstat(dst_fd, &dst_info) != 0)
+    {
+        saved = errno;
+        if (dst_fd >= 0)
+            close(dst_fd);
+        close(src_fd);
+        errno = saved;
+        return -1;
+    }
+
+    result = conv_endian_pipeline_convert_fd(dst_fd, 0, src_fd, 0, CONV_ENDIAN_PIPELINE_TO_END, options, stats);
+
+    if (result == 0 && (src_info.st_dev != dst_info.st_dev || src_info.st_ino != dst_info.st_ino))
+        result = ftruncate(dst_fd, (off_t)stats->bytes);
+
+    saved = errno;
+    close(dst_fd);
+    close(src_fd);
+    errno = saved;
+    return result;
+}
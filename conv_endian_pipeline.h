@@ -0,0 +1,136 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_pipeline.h
+/// @brief A C portable header that contains declarations of functions for converting files with overlapped reads and writes
+
+
+#ifndef CONV_ENDIAN_PIPELINE_H
+#define CONV_ENDIAN_PIPELINE_H
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+
+    File conversion pipelines
+
+    A pipeline converts a range of one file into another, or into the same
+    file, a block at a time. It keeps up to queue_depth blocks in flight:
+    each block is converted as soon as its read completes and its write is
+    queued at once, so reading, converting and writing overlap instead of
+    taking turns.
+
+    On Linux the blocks are read and written through io_uring, which the
+    library drives with raw system calls so that no other library is
+    needed. Elsewhere, or when the kernel does not allow io_uring, blocks
+    are converted one after another with pread and pwrite.
+
+    A block holds whole elements of width bytes, and only the last block
+    of a range may end with a partial element, whose bytes are copied
+    unchanged. Elements are byte swapped unless a conversion function is
+    given, which lets a pipeline convert records of any layout.
+
+    These functions are only available on POSIX systems when the library
+    is built with the pipeline, see the README.
+
+*/
+
+/// @brief Default number of bytes in a block
+#define CONV_ENDIAN_PIPELINE_BLOCK (1024 * 1024)
+
+/// @brief Default number of blocks in flight
+#define CONV_ENDIAN_PIPELINE_DEPTH 8
+
+/// @brief Length that converts a file up to its end
+#define CONV_ENDIAN_PIPELINE_TO_END UINT64_MAX
+
+/// @brief Ways a pipeline can read and write files
+typedef enum conv_endian_backend
+{
+    CONV_ENDIAN_BACKEND_AUTO = 0, ///< io_uring when the system allows it, pread and pwrite otherwise
+    CONV_ENDIAN_BACKEND_IO_URING = 1, ///< io_uring only
+    CONV_ENDIAN_BACKEND_PREAD = 2 ///< pread and pwrite, one block at a time
+} conv_endian_backend;
+
+/// @brief Converts a block of elements in place
+/// @param block block of whole elements
+/// @param bytes number of bytes in block
+/// @param context context given in the options
+typedef void (*conv_endian_block_func)(void* block, size_t bytes, void* context);
+
+/// @brief Options of a pipeline
+typedef struct conv_endian_pipeline_options
+{
+    size_t block_size; ///< number of bytes in a block, rounded down to whole elements
+    unsigned queue_depth; ///< number of blocks in flight
+    size_t width; ///< number of bytes in an element, 1, 2, 4 or 8 when elements are byte swapped
+    conv_endian_backend backend; ///< way files are read and written
+    conv_endian_block_func convert; ///< converts a block of elements, NULL to byte swap them
+    void* context; ///< passed to convert
+} conv_endian_pipeline_options;
+
+/// @brief Statistics of a pipeline
+typedef struct conv_endian_pipeline_stats
+{
+    uint64_t bytes; ///< number of bytes converted
+    uint64_t reads; ///< number of reads
+    uint64_t writes; ///< number of writes
+    conv_endian_backend backend; ///< way files were read and written
+} conv_endian_pipeline_stats;
+
+/// @brief Fills options with the defaults: blocks of CONV_ENDIAN_PIPELINE_BLOCK bytes, CONV_ENDIAN_PIPELINE_DEPTH blocks in flight and 4-byte elements
+/// @param options options to be filled
+void conv_endian_pipeline_default_options(conv_endian_pipeline_options* options);
+
+/// @brief Converts a range of a file into another file
+/// @param dst_fd file descriptor that receives the converted elements, may be src_fd
+/// @param dst_offset offset in dst_fd of the first converted byte
+/// @param src_fd file descriptor of the elements to be converted
+/// @param src_offset offset in src_fd of the first element
+/// @param length number of bytes to be converted, or CONV_ENDIAN_PIPELINE_TO_END
+/// @param options options, or NULL for the defaults
+/// @param stats statistics of the conversion, may be NULL
+/// @return 0 on success or -1 with errno set
+int conv_endian_pipeline_convert_fd(int dst_fd, uint64_t dst_offset, int src_fd, uint64_t src_offset, uint64_t length, const conv_endian_pipeline_options* options, conv_endian_pipeline_stats* stats);
+
+/// @brief Converts a whole file into a new file
+/// @param dst_path path of the file that receives the converted elements, created or truncated
+/// @param src_path path of the file of elements to be converted
+/// @param options options, or NULL for the defaults
+/// @param stats statistics of the conversion, may be NULL
+/// @return 0 on success or -1 with errno set
+int conv_endian_pipeline_convert_file(const char* dst_path, const char* src_path, const conv_endian_pipeline_options* options, conv_endian_pipeline_stats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,314 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_record.hpp
+/// @brief A C++14 header that converts whole records of a layout that is known at compile time
+
+
+#ifndef CONV_ENDIAN_RECORD_HPP
+#define CONV_ENDIAN_RECORD_HPP
+
+#include "conv_endian.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace conv_endian
+{
+
+/// @brief N bytes of a record that are copied without being converted
+template <std::size_t N>
+struct pad
+{
+};
+
+namespace detail
+{
+
+/*
+
+    Every field is described by the width of the numbers it holds and how
+    many of them there are. Bytes, padding and arrays of bytes have a width
+    of 1 and are copied without being converted.
+
+*/
+
+template <typename T>
+struct field_traits
+{
+    static_assert(std::is_arithmetic<T>::value && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8),
+        "record fields are 8-bit, 16-bit, 32-bit or 64-bit numbers, arrays of them or pad<N>");
+
+    static constexpr std::size_t width = sizeof(T);
+    static constexpr std::size_t count = 1;
+};
+
+template <std::size_t N>
+struct field_traits<pad<N>>
+{
+    static constexpr std::size_t width = 1;
+    static constexpr std::size_t count = N;
+};
+
+template <typename T, std::size_t N>
+struct field_traits<T[N]>
+{
+    static constexpr std::size_t width = field_traits<T>::width;
+    static constexpr std::size_t count = N * field_traits<T>::count;
+};
+
+template <std::size_t N>
+struct index_table
+{
+    std::size_t value[N];
+};
+
+template <std::size_t N>
+struct permutation_table
+{
+    uint16_t index[N];
+};
+
+template <std::size_t N>
+constexpr index_table<N> field_offsets(const std::size_t (&widths)[N], const std::size_t (&counts)[N])
+{
+    index_table<N> offsets = {};
+    std::size_t offset = 0;
+
+    for (std::size_t i = 0; i < N; i++)
+    {
+        offsets.value[i] = offset;
+        offset += widths[i] * counts[i];
+    }
+
+    return offsets;
+}
+
+template <std::size_t N>
+constexpr std::size_t record_size(const std::size_t (&widths)[N], const std::size_t (&counts)[N])
+{
+    std::size_t size = 0;
+
+    for (std::size_t i = 0; i < N; i++)
+        size += widths[i] * counts[i];
+
+    return size;
+}
+
+template <std::size_t Size, std::size_t N>
+constexpr permutation_table<Size> record_permutation(const std::size_t (&widths)[N], const std::size_t (&counts)[N])
+{
+    permutation_table<Size> perm = {};
+    std::size_t offset = 0;
+
+    for (std::size_t i = 0; i < N; i++)
+    {
+        for (std::size_t j = 0; j < counts[i]; j++)
+        {
+            for (std::size_t k = 0; k < widths[i]; k++)
+                perm.index[offset + k] = static_cast<uint16_t>(offset + widths[i] - 1 - k);
+
+            offset += widths[i];
+        }
+    }
+
+    return perm;
+}
+
+// mirrors the check that conv_endian_permute_records does before using byte shuffles
+template <std::size_t Size>
+constexpr bool permutation_fits_shuffles(const permutation_table<Size>& perm)
+{
+    std::size_t a = Size, b = 64;
+
+    while (b != 0)
+    {
+        std::size_t r = a % b;
+        a = b;
+        b = r;
+    }
+
+    const std::size_t period = Size / a * 64;
+
+    if (period > CONV_ENDIAN_PERMUTE_MAX_PERIOD)
+        return false;
+
+    for (std::size_t i = 0; i < period; i++)
+    {
+        if ((i - i % Size + perm.index[i % Size]) / 16 != i / 16)
+            return false;
+    }
+
+    return true;
+}
+
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+template <endian Order>
+struct is_host_order : std::integral_constant<bool, Order == endian::little>
+{
+};
+#elif defined(CONV_ENDIAN_HOST_BIG)
+template <endian Order>
+struct is_host_order : std::integral_constant<bool, Order == endian::big>
+{
+};
+#else
+template <endian Order>
+struct is_host_order : std::false_type
+{
+};
+#endif
+
+template <endian Order, std::size_t Width>
+struct field_converter
+{
+    static void convert(unsigned char* dst, const unsigned char* src, std::size_t count) noexcept
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            typename unsigned_of<Width>::type bits;
+            std::memcpy(&bits, src + i * Width, Width);
+            bits = order<Order>::convert(bits);
+            std::memcpy(dst + i * Width, &bits, Width);
+        }
+    }
+};
+
+template <endian Order>
+struct field_converter<Order, 1>
+{
+    static void convert(unsigned char* dst, const unsigned char* src, std::size_t count) noexcept
+    {
+        std::memmove(dst, src, count);
+    }
+};
+
+} // namespace detail
+
+/// @brief Layout of a fixed size record whose numbers are stored in Order
+///
+/// Fields are listed in the order they are stored, without any padding
+/// between them unless it is listed with pad<N>, for example
+/// record_layout<endian::big, uint16_t, pad<2>, uint32_t, double>.
+/// Arrays such as uint16_t[4] are fields too.
+///
+/// convert converts one record field by field with the conversions
+/// inlined, and convert_array converts an array of records with a single
+/// set of byte shuffle masks whenever the layout allows it.
+template <endian Order, typename... Fields>
+class record_layout
+{
+    static_assert(sizeof...(Fields) > 0, "a record needs at least one field");
+
+    static constexpr std::size_t widths_[sizeof...(Fields)] = {detail::field_traits<Fields>::width...};
+    static constexpr std::size_t counts_[sizeof...(Fields)] = {detail::field_traits<Fields>::count...};
+    static constexpr detail::index_table<sizeof...(Fields)> offsets_ = detail::field_offsets(widths_, counts_);
+
+public:
+    /// @brief Number of bytes in a record
+    static constexpr std::size_t size = detail::record_size(widths_, counts_);
+
+    static_assert(size <= 65535, "records are limited to 65535 bytes");
+
+    /// @brief Byte i of a converted record is byte index[i] of the record before conversion
+    static constexpr detail::permutation_table<size> permutation = detail::record_permutation<size>(widths_, counts_);
+
+    /// @brief Whether converting is the same as copying on this machine
+    static constexpr bool is_copy = detail::is_host_order<Order>::value;
+
+    /// @brief Whether arrays of records can be converted with byte shuffles
+    static constexpr bool fits_shuffles = detail::permutation_fits_shuffles(permutation);
+
+    /// @brief Converts one record between Order and their endianness of their machine
+    /// @param dst record that receives the converted fields, may be the same record as src
+    /// @param src record to be converted
+    static void convert(void* dst, const void* src) noexcept
+    {
+        convert_fields(static_cast<unsigned char*>(dst), static_cast<const unsigned char*>(src),
+            std::index_sequence_for<Fields...>());
+    }
+
+    /// @brief Converts an array of records between Order and their endianness of their machine
+    /// @param dst array that receives the converted records, may be the same array as src
+    /// @param src array of records to be converted
+    /// @param count number of records in src
+    static void convert_array(void* dst, const void* src, std::size_t count) noexcept
+    {
+        unsigned char* dst_bytes = static_cast<unsigned char*>(dst);
+        const unsigned char* src_bytes = static_cast<const unsigned char*>(src);
+
+        if (is_copy)
+        {
+            if (dst != src)
+                std::memmove(dst, src, count * size);
+            return;
+        }
+
+        // small arrays are not worth setting up the shuffle masks for
+        if (fits_shuffles && count * size >= 256 && conv_endian_get_kernel() != CONV_ENDIAN_KERNEL_SCALAR &&
+            conv_endian_permute_records(dst, src, count, size, permutation.index) == 0)
+            return;
+
+        for (std::size_t i = 0; i < count; i++)
+            convert(dst_bytes + i * size, src_bytes + i * size);
+    }
+
+private:
+    template <std::size_t... I>
+    static void convert_fields(unsigned char* dst, const unsigned char* src, std::index_sequence<I...>) noexcept
+    {
+        int expand[] = {0, (detail::field_converter<Order, detail::field_traits<Fields>::width>::convert(
+            dst + offsets_.value[I], src + offsets_.value[I], detail::field_traits<Fields>::count), 0)...};
+        (void)expand;
+    }
+};
+
+template <endian Order, typename... Fields>
+constexpr std::size_t record_layout<Order, Fields...>::widths_[sizeof...(Fields)];
+
+template <endian Order, typename... Fields>
+constexpr std::size_t record_layout<Order, Fields...>::counts_[sizeof...(Fields)];
+
+template <endian Order, typename... Fields>
+constexpr detail::index_table<sizeof...(Fields)> record_layout<Order, Fields...>::offsets_;
+
+template <endian Order, typename... Fields>
+constexpr std::size_t record_layout<Order, Fields...>::size;
+
+template <endian Order, typename... Fields>
+constexpr detail::permutation_table<record_layout<Order, Fields...>::size> record_layout<Order, Fields...>::permutation;
+
+template <endian Order, typename... Fields>
+constexpr bool record_layout<Order, Fields...>::is_copy;
+
+template <endian Order, typename... Fields>
+constexpr bool record_layout<Order, Fields...>::fits_shuffles;
+
+} // namespace conv_endian
+
+#endif
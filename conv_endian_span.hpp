@@ -0,0 +1,390 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_span.hpp
+/// @brief A C++ header that contains views which convert the numbers of an array in a fixed endianness when they are accessed
+
+
+#ifndef CONV_ENDIAN_SPAN_HPP
+#define CONV_ENDIAN_SPAN_HPP
+
+#include "conv_endian.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace conv_endian
+{
+
+/*
+
+    Endian spans
+
+    An endian_span views a buffer of numbers stored in an endianness, such
+    as a memory mapped file of big endian doubles, without owning or
+    converting it. Each number is converted only when it is read or
+    written, so a sparse walk over a large buffer only pays for the numbers
+    it touches:
+
+        conv_endian::big_endian_span<const double> samples(mapping, count);
+
+        double last = samples.back();
+        auto peak = std::max_element(samples.begin(), samples.end());
+
+    Elements are accessed through proxy references that convert on reading
+    and on assignment, so the iterators are random access iterators that
+    work with the standard algorithms, including std::sort on a span of
+    non-const numbers. Views of const numbers return plain values.
+
+    A dense pass is faster with materialize, which converts a range into an
+    array of numbers with the vectorized bulk functions of conv_endian.h,
+    and assign converts an array back into the span. Both need the compiled
+    library.
+
+*/
+
+template <typename T, endian Order>
+class endian_reference;
+
+namespace detail
+{
+
+template <typename T>
+struct span_bytes
+{
+    using type = typename std::conditional<std::is_const<T>::value, const unsigned char, unsigned char>::type;
+};
+
+// whether numbers in Order have to be byte swapped, which is only known
+// at compile time when the endianness of the machine is
+template <endian Order>
+struct span_swap
+{
+#if defined(CONV_ENDIAN_HOST_LITTLE)
+    static constexpr bool known = true;
+    static constexpr bool value = Order == endian::big;
+#elif defined(CONV_ENDIAN_HOST_BIG)
+    static constexpr bool known = true;
+    static constexpr bool value = Order == endian::little;
+#else
+    static constexpr bool known = false;
+    static constexpr bool value = false;
+#endif
+};
+
+inline void span_bswap(void* dst, const void* src, std::size_t count, std::size_t width) noexcept
+{
+    switch (width)
+    {
+    case 2:
+        conv_endian_bswap16_array(dst, src, count);
+        break;
+    case 4:
+        conv_endian_bswap32_array(dst, src, count);
+        break;
+    default:
+        conv_endian_bswap64_array(dst, src, count);
+        break;
+    }
+}
+
+} // namespace detail
+
+/// @brief A reference to a number of type T that is stored in Order, returned by the iterators of a span
+template <typename T, endian Order>
+class endian_reference
+{
+public:
+    using value_type = T;
+
+    explicit endian_reference(unsigned char* ptr) noexcept : ptr_(ptr) {}
+
+    endian_reference(const endian_reference&) noexcept = default;
+
+    /// @brief Stores a number
+    /// @param val value in their endianness of their machine
+    /// @return this reference
+    const endian_reference& operator=(T val) const noexcept
+    {
+        store<T, Order>(ptr_, val);
+        return *this;
+    }
+
+    /// @brief Stores the number of another reference, as std::sort and other algorithms do
+    /// @param other reference to the number to be stored
+    /// @return this reference
+    const endian_reference& operator=(const endian_reference& other) const noexcept
+    {
+        std::memmove(ptr_, other.ptr_, sizeof(T));
+        return *this;
+    }
+
+    operator T() const noexcept
+    {
+        return load<T, Order>(ptr_);
+    }
+
+    /// @brief Gets the number in their endianness of their machine
+    /// @return referenced number
+    T value() const noexcept
+    {
+        return load<T, Order>(ptr_);
+    }
+
+    /// @brief Exchanges the numbers of two references
+    friend void swap(endian_reference a, endian_reference b) noexcept
+    {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, a.ptr_, sizeof(T));
+        std::memcpy(a.ptr_, b.ptr_, sizeof(T));
+        std::memcpy(b.ptr_, bytes, sizeof(T));
+    }
+
+private:
+    unsigned char* ptr_;
+};
+
+/// @brief A random access iterator over the numbers of a span
+template <typename T, endian Order>
+class endian_iterator
+{
+    using byte = typename detail::span_bytes<T>::type;
+    using number = typename std::remove_const<T>::type;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = number;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = typename std::conditional<std::is_const<T>::value, number, endian_reference<number, Order>>::type;
+
+    endian_iterator() noexcept : ptr_(nullptr) {}
+
+    explicit endian_iterator(byte* ptr) noexcept : ptr_(ptr) {}
+
+    /// @brief Gets the address of the current number, which is stored in Order
+    /// @return address of the first byte of the number
+    byte* base() const noexcept { return ptr_; }
+
+    reference operator*() const noexcept { return reference(access(ptr_)); }
+    reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+    endian_iterator& operator++() noexcept { ptr_ += sizeof(T); return *this; }
+    endian_iterator& operator--() noexcept { ptr_ -= sizeof(T); return *this; }
+    endian_iterator operator++(int) noexcept { endian_iterator old = *this; ++*this; return old; }
+    endian_iterator operator--(int) noexcept { endian_iterator old = *this; --*this; return old; }
+
+    endian_iterator& operator+=(difference_type n) noexcept { ptr_ += n * static_cast<difference_type>(sizeof(T)); return *this; }
+    endian_iterator& operator-=(difference_type n) noexcept { ptr_ -= n * static_cast<difference_type>(sizeof(T)); return *this; }
+
+    friend endian_iterator operator+(endian_iterator it, difference_type n) noexcept { return it += n; }
+    friend endian_iterator operator+(difference_type n, endian_iterator it) noexcept { return it += n; }
+    friend endian_iterator operator-(endian_iterator it, difference_type n) noexcept { return it -= n; }
+
+    friend difference_type operator-(const endian_iterator& a, const endian_iterator& b) noexcept
+    {
+        return (a.ptr_ - b.ptr_) / static_cast<difference_type>(sizeof(T));
+    }
+
+    friend bool operator==(const endian_iterator& a, const endian_iterator& b) noexcept { return a.ptr_ == b.ptr_; }
+    friend bool operator!=(const endian_iterator& a, const endian_iterator& b) noexcept { return a.ptr_ != b.ptr_; }
+    friend bool operator<(const endian_iterator& a, const endian_iterator& b) noexcept { return a.ptr_ < b.ptr_; }
+    friend bool operator>(const endian_iterator& a, const endian_iterator& b) noexcept { return a.ptr_ > b.ptr_; }
+    friend bool operator<=(const endian_iterator& a, const endian_iterator& b) noexcept { return a.ptr_ <= b.ptr_; }
+    friend bool operator>=(const endian_iterator& a, const endian_iterator& b) noexcept { return a.ptr_ >= b.ptr_; }
+
+private:
+    // a const view reads the number, a mutable view hands out a proxy
+    static number access(const unsigned char* ptr, std::true_type) noexcept { return load<number, Order>(ptr); }
+    static unsigned char* access(unsigned char* ptr, std::false_type) noexcept { return ptr; }
+    static auto access(byte* ptr) noexcept -> decltype(access(ptr, std::is_const<T>()))
+    {
+        return access(ptr, std::is_const<T>());
+    }
+
+    byte* ptr_;
+};
+
+/// @brief A view of count numbers of type T stored in Order, which converts them when they are accessed
+///
+/// T may be const to view a read-only buffer. The view does not own the
+/// buffer, which does not have to be aligned.
+template <typename T, endian Order>
+class endian_span
+{
+    using number = typename std::remove_const<T>::type;
+
+    static_assert(std::is_arithmetic<number>::value && sizeof(number) >= 2 && sizeof(number) <= 8,
+        "endian_span views 16-bit, 32-bit and 64-bit integers and floating point numbers");
+
+public:
+    using element_type = T;
+    using value_type = number;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using byte = typename detail::span_bytes<T>::type;
+    using iterator = endian_iterator<T, Order>;
+    using reference = typename iterator::reference;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    static constexpr endian order = Order;
+
+    endian_span() noexcept : data_(nullptr), size_(0) {}
+
+    /// @brief Views a buffer
+    /// @param data first byte of the buffer
+    /// @param count number of numbers in the buffer
+    endian_span(typename std::conditional<std::is_const<T>::value, const void*, void*>::type data, std::size_t count) noexcept
+        : data_(static_cast<byte*>(data)), size_(count)
+    {
+    }
+
+    /// @brief Views a mutable span as a span of const numbers
+    template <typename U, typename = typename std::enable_if<std::is_const<T>::value && std::is_same<U, number>::value>::type>
+    endian_span(const endian_span<U, Order>& other) noexcept : data_(other.data()), size_(other.size())
+    {
+    }
+
+    /// @brief Gets the first byte of the buffer
+    /// @return address of the buffer
+    byte* data() const noexcept { return data_; }
+
+    /// @brief Gets the number of numbers in the view
+    /// @return number of numbers
+    std::size_t size() const noexcept { return size_; }
+
+    /// @brief Gets the number of bytes in the view
+    /// @return number of bytes
+    std::size_t size_bytes() const noexcept { return size_ * sizeof(T); }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    iterator begin() const noexcept { return iterator(data_); }
+    iterator end() const noexcept { return iterator(data_ + size_ * sizeof(T)); }
+    reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+    reference operator[](std::size_t index) const noexcept { return begin()[static_cast<difference_type>(index)]; }
+    reference front() const noexcept { return *begin(); }
+    reference back() const noexcept { return *(end() - 1); }
+
+    /// @brief Views part of the span
+    /// @param offset index of the first number
+    /// @param count number of numbers, no more than size() - offset
+    /// @return view of the numbers
+    endian_span subspan(std::size_t offset, std::size_t count) const noexcept
+    {
+        return endian_span(data_ + offset * sizeof(T), count);
+    }
+
+    endian_span first(std::size_t count) const noexcept { return subspan(0, count); }
+    endian_span last(std::size_t count) const noexcept { return subspan(size_ - count, count); }
+
+    /// @brief Converts a range of the span into an array with the bulk functions
+    /// @param dst array that receives count numbers in their endianness of their machine, must not overlap the span
+    /// @param offset index of the first number
+    /// @param count number of numbers, no more than size() - offset
+    void materialize(number* dst, std::size_t offset, std::size_t count) const noexcept
+    {
+        const unsigned char* src = data_ + offset * sizeof(T);
+
+        if (!detail::span_swap<Order>::known)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                dst[i] = load<number, Order>(src + i * sizeof(T));
+        }
+        else if (detail::span_swap<Order>::value)
+        {
+            detail::span_bswap(dst, src, count, sizeof(T));
+        }
+        else if (count != 0)
+        {
+            std::memcpy(dst, src, count * sizeof(T));
+        }
+    }
+
+    /// @brief Converts the whole span into an array with the bulk functions
+    /// @param dst array that receives size() numbers in their endianness of their machine, must not overlap the span
+    void materialize(number* dst) const noexcept
+    {
+        materialize(dst, 0, size_);
+    }
+
+    /// @brief Converts the whole span into a vector with the bulk functions
+    /// @return vector of size() numbers in their endianness of their machine
+    std::vector<number> materialize() const
+    {
+        std::vector<number> values(size_);
+        materialize(values.data(), 0, size_);
+        return values;
+    }
+
+    /// @brief Converts an array into a range of the span with the bulk functions
+    /// @param offset index of the first number of the span to be written
+    /// @param src array of count numbers in their endianness of their machine, must not overlap the span
+    /// @param count number of numbers, no more than size() - offset
+    template <typename U = T, typename = typename std::enable_if<!std::is_const<U>::value>::type>
+    void assign(std::size_t offset, const number* src, std::size_t count) const noexcept
+    {
+        unsigned char* dst = data_ + offset * sizeof(T);
+
+        if (!detail::span_swap<Order>::known)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                store<number, Order>(dst + i * sizeof(T), src[i]);
+        }
+        else if (detail::span_swap<Order>::value)
+        {
+            detail::span_bswap(dst, src, count, sizeof(T));
+        }
+        else if (count != 0)
+        {
+            std::memcpy(dst, src, count * sizeof(T));
+        }
+    }
+
+private:
+    byte* data_;
+    std::size_t size_;
+};
+
+template <typename T, endian Order>
+constexpr endian endian_span<T, Order>::order;
+
+/// @brief A view of numbers of type T that are stored in big endian
+template <typename T>
+using big_endian_span = endian_span<T, endian::big>;
+
+/// @brief A view of numbers of type T that are stored in little endian
+template <typename T>
+using little_endian_span = endian_span<T, endian::little>;
+
+} // namespace conv_endian
+
+#endif
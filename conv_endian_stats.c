@@ -0,0 +1,1089 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_stats.c
+/// @brief A C portable source code that contains implementation of functions for reading arrays and computing their statistics in the same pass
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Statistics of a piece of an array
+
+    Integer numbers are compared and added up as unsigned keys: a signed
+    number with its sign bit flipped is ordered like an unsigned number,
+    and the sum of n flipped numbers is their sum plus n times the sign
+    bit, which is taken off afterwards. The sums of integer numbers are
+    modulo 2^64 in every case.
+
+    Values that are null in the validity bitmap are replaced by numbers
+    that cannot change the statistics before they are added up, the
+    largest key for the minimum, 0 for the maximum and the sum, and
+    infinities for floating point numbers.
+
+*/
+
+typedef struct stats_block
+{
+    uint64_t min; ///< smallest key
+    uint64_t max; ///< largest key
+    uint64_t sum; ///< sum of the keys
+    double fmin; ///< smallest floating point number
+    double fmax; ///< largest floating point number
+    double fsum; ///< sum of the floating point numbers
+    size_t nans; ///< NaNs that are not null
+} stats_block;
+
+static uint64_t popcount64(uint64_t val)
+{
+    val = val - ((val >> 1) & 0x5555555555555555ull);
+    val = (val & 0x3333333333333333ull) + ((val >> 2) & 0x3333333333333333ull);
+    val = (val + (val >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (val * 0x0101010101010101ull) >> 56;
+}
+
+// number of values that are not null
+static size_t count_valid(const uint8_t* validity, size_t count)
+{
+    size_t valid = 0;
+    size_t i;
+
+    if (validity == NULL)
+        return count;
+
+    for (i = 0; i + 64 <= count; i += 64)
+    {
+        uint64_t bits;
+        memcpy(&bits, validity + i / 8, 8);
+        valid += (size_t)popcount64(bits);
+    }
+
+    for (; i + 8 <= count; i += 8)
+        valid += (size_t)popcount64(validity[i / 8]);
+
+    if (i < count)
+        valid += (size_t)popcount64(validity[i / 8] & ((1u << (count - i)) - 1));
+
+    return valid;
+}
+
+static int is_valid(const uint8_t* validity, size_t i)
+{
+    return validity == NULL || ((validity[i / 8] >> (i % 8)) & 1);
+}
+
+static uint64_t stats_load(const unsigned char* ptr, size_t width, int big)
+{
+    switch (width)
+    {
+    case 2:
+        return big ? load_be_u16(ptr) : load_le_u16(ptr);
+    case 4:
+        return big ? load_be_u32(ptr) : load_le_u32(ptr);
+    default:
+        return big ? load_be_u64(ptr) : load_le_u64(ptr);
+    }
+}
+
+static void stats_store(unsigned char* ptr, uint64_t val, size_t width)
+{
+    uint16_t val16 = (uint16_t)val;
+    uint32_t val32 = (uint32_t)val;
+
+    switch (width)
+    {
+    case 2:
+        memcpy(ptr, &val16, 2);
+        break;
+    case 4:
+        memcpy(ptr, &val32, 4);
+        break;
+    default:
+        memcpy(ptr, &val, 8);
+        break;
+    }
+}
+
+static uint64_t key_flip(size_t width, int is_signed)
+{
+    return is_signed ? (uint64_t)1 << (8 * width - 1) : 0;
+}
+
+static void int_stats_scalar(unsigned char* dst, const unsigned char* src, size_t i, size_t count, size_t width, int big, int is_signed, const uint8_t* validity, stats_block* block)
+{
+    uint64_t flip = key_flip(width, is_signed);
+
+    for (; i < count; i++)
+    {
+        uint64_t key = stats_load(src + i * width, width, big);
+
+        stats_store(dst + i * width, key, width);
+
+        if (!is_valid(validity, i))
+            continue;
+
+        key ^= flip;
+        block->min = key < block->min ? key : block->min;
+        block->max = key > block->max ? key : block->max;
+        block->sum += key;
+    }
+}
+
+static void float_stats_scalar(unsigned char* dst, const unsigned char* src, size_t i, size_t count, size_t width, int big, const uint8_t* validity, stats_block* block)
+{
+    for (; i < count; i++)
+    {
+        uint64_t bits = stats_load(src + i * width, width, big);
+        double val = width == 4 ? (double)conv_endian_bits_f32((uint32_t)bits) : conv_endian_bits_f64(bits);
+
+        stats_store(dst + i * width, bits, width);
+
+        if (!is_valid(validity, i))
+            continue;
+
+        if (val != val)
+        {
+            block->nans++;
+            continue;
+        }
+
+        block->fmin = val < block->fmin ? val : block->fmin;
+        block->fmax = val > block->fmax ? val : block->fmax;
+        block->fsum += val;
+    }
+}
+
+/*
+
+    Vector kernels
+
+    Every kernel byte swaps a register of values, stores it and keeps the
+    minimum, maximum and sum of every lane in registers, which are only
+    reduced into the statistics of the piece at the end. 16-bit keys are
+    added up with the sums of absolute differences of their low and high
+    bytes, and wider keys are added into 64-bit lanes.
+
+    The validity bits of a register of values are spread into a lane mask
+    by comparing them to one bit per lane, except with AVX-512, whose masks
+    are the bits themselves. NaNs are rare, so they are only counted when
+    a register has any.
+
+    Each kernel returns the number of values it has converted so that the
+    caller can finish the rest one at a time.
+
+    The 16-byte kernels compare 64-bit lanes and blend them, which takes
+    SSE4.1 and SSE4.2 on top of SSSE3, so the SSSE3 kernel level only uses
+    them on processors that have both and otherwise reads the values one at
+    a time.
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+static void reduce_keys(stats_block* block, const void* min, const void* max, const uint64_t* sum, size_t lanes, size_t sums, size_t width)
+{
+    size_t i;
+
+    for (i = 0; i < lanes; i++)
+    {
+        uint64_t lo = 0, hi = 0;
+
+        memcpy(&lo, (const unsigned char*)min + i * width, width);
+        memcpy(&hi, (const unsigned char*)max + i * width, width);
+        block->min = lo < block->min ? lo : block->min;
+        block->max = hi > block->max ? hi : block->max;
+    }
+
+    for (i = 0; i < sums; i++)
+        block->sum += sum[i];
+}
+
+static void reduce_floats(stats_block* block, const void* min, const void* max, const double* sum, size_t lanes, size_t sums, size_t width)
+{
+    size_t i;
+
+    for (i = 0; i < lanes; i++)
+    {
+        double lo, hi;
+
+        if (width == 4)
+        {
+            float narrow;
+            memcpy(&narrow, (const unsigned char*)min + i * 4, 4);
+            lo = narrow;
+            memcpy(&narrow, (const unsigned char*)max + i * 4, 4);
+            hi = narrow;
+        }
+        else
+        {
+            memcpy(&lo, (const unsigned char*)min + i * 8, 8);
+            memcpy(&hi, (const unsigned char*)max + i * 8, 8);
+        }
+
+        block->fmin = lo < block->fmin ? lo : block->fmin;
+        block->fmax = hi > block->fmax ? hi : block->fmax;
+    }
+
+    for (i = 0; i < sums; i++)
+        block->fsum += sum[i];
+}
+
+CONV_ENDIAN_TARGET("ssse3")
+static __m128i swap_mask_128(size_t width, int big)
+{
+    if (!big)
+        return _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    switch (width)
+    {
+    case 2:
+        return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    case 4:
+        return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    default:
+        return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    }
+}
+
+// the validity bits of the lanes values starting at value i, which is a multiple of lanes
+static unsigned lane_bits(const uint8_t* validity, size_t i, size_t lanes)
+{
+    if (lanes == 16)
+        return validity[i / 8] | ((unsigned)validity[i / 8 + 1] << 8);
+
+    return (validity[i / 8] >> (i % 8)) & ((1u << lanes) - 1);
+}
+
+CONV_ENDIAN_TARGET("ssse3,sse4.2")
+static __m128i lane_mask_128(const uint8_t* validity, size_t i, size_t width)
+{
+    unsigned bits = lane_bits(validity, i, 16 / width);
+    __m128i lanes;
+
+    switch (width)
+    {
+    case 2:
+        lanes = _mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+        return _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16((short)bits), lanes), lanes);
+    case 4:
+        lanes = _mm_setr_epi32(1, 2, 4, 8);
+        return _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)bits), lanes), lanes);
+    default:
+        lanes = _mm_set_epi64x(2, 1);
+        return _mm_cmpeq_epi64(_mm_and_si128(_mm_set1_epi64x(bits), lanes), lanes);
+    }
+}
+
+// unsigned 64-bit comparison by flipping the sign bits
+CONV_ENDIAN_TARGET("ssse3,sse4.2")
+static __m128i min_epu64_128(__m128i a, __m128i b)
+{
+    __m128i sign = _mm_set1_epi64x((long long)0x8000000000000000ull);
+    __m128i gt = _mm_cmpgt_epi64(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+    return _mm_blendv_epi8(a, b, gt);
+}
+
+CONV_ENDIAN_TARGET("ssse3,sse4.2")
+static __m128i max_epu64_128(__m128i a, __m128i b)
+{
+    __m128i sign = _mm_set1_epi64x((long long)0x8000000000000000ull);
+    __m128i gt = _mm_cmpgt_epi64(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+    return _mm_blendv_epi8(b, a, gt);
+}
+
+CONV_ENDIAN_TARGET("ssse3,sse4.2")
+static size_t int_stats_sse42(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, int is_signed, const uint8_t* validity, stats_block* block)
+{
+    __m128i mask = swap_mask_128(width, big);
+    __m128i zero = _mm_setzero_si128();
+    __m128i ones = _mm_set1_epi32(-1);
+    __m128i flip = _mm_set1_epi64x((long long)key_flip(width, is_signed));
+    __m128i low = _mm_set1_epi16(0xFF);
+    __m128i vmin = ones, vmax = zero, vsum = zero;
+    size_t lanes = 16 / width;
+    size_t i;
+    uint64_t min[2], max[2], sum[2];
+
+    // the flipped bit of narrower keys is the highest bit of every lane
+    if (width == 2)
+        flip = _mm_set1_epi16(is_signed ? (short)0x8000 : 0);
+    else if (width == 4)
+        flip = _mm_set1_epi32(is_signed ? (int)0x80000000u : 0);
+
+    for (i = 0; i + lanes <= count; i += lanes)
+    {
+        __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * width)), mask);
+        __m128i key = _mm_xor_si128(val, flip);
+        __m128i high = key;
+
+        _mm_storeu_si128((__m128i*)(dst + i * width), val);
+
+        if (validity != NULL)
+        {
+            __m128i valid = lane_mask_128(validity, i, width);
+            high = _mm_or_si128(key, _mm_andnot_si128(valid, ones));
+            key = _mm_and_si128(key, valid);
+        }
+
+        if (width == 2)
+        {
+            vmin = _mm_min_epu16(vmin, high);
+            vmax = _mm_max_epu16(vmax, key);
+            vsum = _mm_add_epi64(vsum, _mm_sad_epu8(_mm_and_si128(key, low), zero));
+            vsum = _mm_add_epi64(vsum, _mm_slli_epi64(_mm_sad_epu8(_mm_srli_epi16(key, 8), zero), 8));
+        }
+        else if (width == 4)
+        {
+            vmin = _mm_min_epu32(vmin, high);
+            vmax = _mm_max_epu32(vmax, key);
+            vsum = _mm_add_epi64(vsum, _mm_add_epi64(_mm_unpacklo_epi32(key, zero), _mm_unpackhi_epi32(key, zero)));
+        }
+        else
+        {
+            vmin = min_epu64_128(vmin, high);
+            vmax = max_epu64_128(vmax, key);
+            vsum = _mm_add_epi64(vsum, key);
+        }
+    }
+
+    _mm_storeu_si128((__m128i*)min, vmin);
+    _mm_storeu_si128((__m128i*)max, vmax);
+    _mm_storeu_si128((__m128i*)sum, vsum);
+    reduce_keys(block, min, max, sum, lanes, 2, width);
+    return i;
+}
+
+CONV_ENDIAN_TARGET("ssse3,sse4.2")
+static size_t float_stats_sse42(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, const uint8_t* validity, stats_block* block)
+{
+    __m128i mask = swap_mask_128(width, big);
+    size_t lanes = 16 / width;
+    size_t i;
+    __m128d sum_lo = _mm_setzero_pd(), sum_hi = _mm_setzero_pd();
+    double sum[4];
+    union
+    {
+        float f32[4];
+        double f64[2];
+    } min, max;
+
+    if (width == 4)
+    {
+        __m128 vmin = _mm_set1_ps(INFINITY), vmax = _mm_set1_ps(-INFINITY);
+
+        for (i = 0; i + 4 <= count; i += 4)
+        {
+            __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 4)), mask);
+            __m128 num = _mm_castsi128_ps(val);
+            __m128 used = _mm_cmpord_ps(num, num);
+            __m128 valid = validity != NULL ? _mm_castsi128_ps(lane_mask_128(validity, i, 4)) : _mm_castsi128_ps(_mm_set1_epi32(-1));
+            int nans = _mm_movemask_ps(_mm_andnot_ps(used, valid));
+
+            _mm_storeu_si128((__m128i*)(dst + i * 4), val);
+
+            if (nans != 0)
+                block->nans += (size_t)popcount64((uint64_t)nans);
+
+            used = _mm_and_ps(used, valid);
+            vmin = _mm_min_ps(vmin, _mm_blendv_ps(_mm_set1_ps(INFINITY), num, used));
+            vmax = _mm_max_ps(vmax, _mm_blendv_ps(_mm_set1_ps(-INFINITY), num, used));
+            num = _mm_and_ps(num, used);
+            sum_lo = _mm_add_pd(sum_lo, _mm_cvtps_pd(num));
+            sum_hi = _mm_add_pd(sum_hi, _mm_cvtps_pd(_mm_movehl_ps(num, num)));
+        }
+
+        _mm_storeu_ps(min.f32, vmin);
+        _mm_storeu_ps(max.f32, vmax);
+    }
+    else
+    {
+        __m128d vmin = _mm_set1_pd(INFINITY), vmax = _mm_set1_pd(-INFINITY);
+
+        for (i = 0; i + 2 <= count; i += 2)
+        {
+            __m128i val = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 8)), mask);
+            __m128d num = _mm_castsi128_pd(val);
+            __m128d used = _mm_cmpord_pd(num, num);
+            __m128d valid = validity != NULL ? _mm_castsi128_pd(lane_mask_128(validity, i, 8)) : _mm_castsi128_pd(_mm_set1_epi32(-1));
+            int nans = _mm_movemask_pd(_mm_andnot_pd(used, valid));
+
+            _mm_storeu_si128((__m128i*)(dst + i * 8), val);
+
+            if (nans != 0)
+                block->nans += (size_t)popcount64((uint64_t)nans);
+
+            used = _mm_and_pd(used, valid);
+            vmin = _mm_min_pd(vmin, _mm_blendv_pd(_mm_set1_pd(INFINITY), num, used));
+            vmax = _mm_max_pd(vmax, _mm_blendv_pd(_mm_set1_pd(-INFINITY), num, used));
+            sum_lo = _mm_add_pd(sum_lo, _mm_and_pd(num, used));
+        }
+
+        _mm_storeu_pd(min.f64, vmin);
+        _mm_storeu_pd(max.f64, vmax);
+    }
+
+    _mm_storeu_pd(sum, sum_lo);
+    _mm_storeu_pd(sum + 2, sum_hi);
+    reduce_floats(block, &min, &max, sum, lanes, 4, width);
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static __m256i lane_mask_256(const uint8_t* validity, size_t i, size_t width)
+{
+    unsigned bits = lane_bits(validity, i, 32 / width);
+    __m256i lanes;
+
+    switch (width)
+    {
+    case 2:
+        lanes = _mm256_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, (short)0x8000);
+        return _mm256_cmpeq_epi16(_mm256_and_si256(_mm256_set1_epi16((short)bits), lanes), lanes);
+    case 4:
+        lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32((int)bits), lanes), lanes);
+    default:
+        lanes = _mm256_setr_epi64x(1, 2, 4, 8);
+        return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(bits), lanes), lanes);
+    }
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t int_stats_avx2(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, int is_signed, const uint8_t* validity, stats_block* block)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(swap_mask_128(width, big));
+    __m256i zero = _mm256_setzero_si256();
+    __m256i ones = _mm256_set1_epi32(-1);
+    __m256i sign = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+    __m256i flip = _mm256_set1_epi64x((long long)key_flip(width, is_signed));
+    __m256i low = _mm256_set1_epi16(0xFF);
+    __m256i vmin = ones, vmax = zero, vsum = zero;
+    size_t lanes = 32 / width;
+    size_t i;
+    uint64_t min[4], max[4], sum[4];
+
+    if (width == 2)
+        flip = _mm256_set1_epi16(is_signed ? (short)0x8000 : 0);
+    else if (width == 4)
+        flip = _mm256_set1_epi32(is_signed ? (int)0x80000000u : 0);
+
+    for (i = 0; i + lanes <= count; i += lanes)
+    {
+        __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * width)), mask);
+        __m256i key = _mm256_xor_si256(val, flip);
+        __m256i high = key;
+
+        _mm256_storeu_si256((__m256i*)(dst + i * width), val);
+
+        if (validity != NULL)
+        {
+            __m256i valid = lane_mask_256(validity, i, width);
+            high = _mm256_or_si256(key, _mm256_andnot_si256(valid, ones));
+            key = _mm256_and_si256(key, valid);
+        }
+
+        if (width == 2)
+        {
+            vmin = _mm256_min_epu16(vmin, high);
+            vmax = _mm256_max_epu16(vmax, key);
+            vsum = _mm256_add_epi64(vsum, _mm256_sad_epu8(_mm256_and_si256(key, low), zero));
+            vsum = _mm256_add_epi64(vsum, _mm256_slli_epi64(_mm256_sad_epu8(_mm256_srli_epi16(key, 8), zero), 8));
+        }
+        else if (width == 4)
+        {
+            vmin = _mm256_min_epu32(vmin, high);
+            vmax = _mm256_max_epu32(vmax, key);
+            vsum = _mm256_add_epi64(vsum, _mm256_add_epi64(_mm256_unpacklo_epi32(key, zero), _mm256_unpackhi_epi32(key, zero)));
+        }
+        else
+        {
+            __m256i gt = _mm256_cmpgt_epi64(_mm256_xor_si256(vmin, sign), _mm256_xor_si256(high, sign));
+            vmin = _mm256_blendv_epi8(vmin, high, gt);
+            gt = _mm256_cmpgt_epi64(_mm256_xor_si256(key, sign), _mm256_xor_si256(vmax, sign));
+            vmax = _mm256_blendv_epi8(vmax, key, gt);
+            vsum = _mm256_add_epi64(vsum, key);
+        }
+    }
+
+    _mm256_storeu_si256((__m256i*)min, vmin);
+    _mm256_storeu_si256((__m256i*)max, vmax);
+    _mm256_storeu_si256((__m256i*)sum, vsum);
+    reduce_keys(block, min, max, sum, lanes, 4, width);
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t float_stats_avx2(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, const uint8_t* validity, stats_block* block)
+{
+    __m256i mask = _mm256_broadcastsi128_si256(swap_mask_128(width, big));
+    size_t lanes = 32 / width;
+    size_t i;
+    __m256d sum_lo = _mm256_setzero_pd(), sum_hi = _mm256_setzero_pd();
+    double sum[8];
+    union
+    {
+        float f32[8];
+        double f64[4];
+    } min, max;
+
+    if (width == 4)
+    {
+        __m256 vmin = _mm256_set1_ps(INFINITY), vmax = _mm256_set1_ps(-INFINITY);
+
+        for (i = 0; i + 8 <= count; i += 8)
+        {
+            __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 4)), mask);
+            __m256 num = _mm256_castsi256_ps(val);
+            __m256 used = _mm256_cmp_ps(num, num, _CMP_ORD_Q);
+            __m256 valid = validity != NULL ? _mm256_castsi256_ps(lane_mask_256(validity, i, 4)) : _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            int nans = _mm256_movemask_ps(_mm256_andnot_ps(used, valid));
+
+            _mm256_storeu_si256((__m256i*)(dst + i * 4), val);
+
+            if (nans != 0)
+                block->nans += (size_t)popcount64((uint64_t)nans);
+
+            used = _mm256_and_ps(used, valid);
+            vmin = _mm256_min_ps(vmin, _mm256_blendv_ps(_mm256_set1_ps(INFINITY), num, used));
+            vmax = _mm256_max_ps(vmax, _mm256_blendv_ps(_mm256_set1_ps(-INFINITY), num, used));
+            num = _mm256_and_ps(num, used);
+            sum_lo = _mm256_add_pd(sum_lo, _mm256_cvtps_pd(_mm256_castps256_ps128(num)));
+            sum_hi = _mm256_add_pd(sum_hi, _mm256_cvtps_pd(_mm256_extractf128_ps(num, 1)));
+        }
+
+        _mm256_storeu_ps(min.f32, vmin);
+        _mm256_storeu_ps(max.f32, vmax);
+    }
+    else
+    {
+        __m256d vmin = _mm256_set1_pd(INFINITY), vmax = _mm256_set1_pd(-INFINITY);
+
+        for (i = 0; i + 4 <= count; i += 4)
+        {
+            __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 8)), mask);
+            __m256d num = _mm256_castsi256_pd(val);
+            __m256d used = _mm256_cmp_pd(num, num, _CMP_ORD_Q);
+            __m256d valid = validity != NULL ? _mm256_castsi256_pd(lane_mask_256(validity, i, 8)) : _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+            int nans = _mm256_movemask_pd(_mm256_andnot_pd(used, valid));
+
+            _mm256_storeu_si256((__m256i*)(dst + i * 8), val);
+
+            if (nans != 0)
+                block->nans += (size_t)popcount64((uint64_t)nans);
+
+            used = _mm256_and_pd(used, valid);
+            vmin = _mm256_min_pd(vmin, _mm256_blendv_pd(_mm256_set1_pd(INFINITY), num, used));
+            vmax = _mm256_max_pd(vmax, _mm256_blendv_pd(_mm256_set1_pd(-INFINITY), num, used));
+            sum_lo = _mm256_add_pd(sum_lo, _mm256_and_pd(num, used));
+        }
+
+        _mm256_storeu_pd(min.f64, vmin);
+        _mm256_storeu_pd(max.f64, vmax);
+    }
+
+    _mm256_storeu_pd(sum, sum_lo);
+    _mm256_storeu_pd(sum + 4, sum_hi);
+    reduce_floats(block, &min, &max, sum, lanes, 8, width);
+    return i;
+}
+
+// the validity bits of the 64 / width values starting at value i
+static uint32_t lane_bits_512(const uint8_t* validity, size_t i, size_t width)
+{
+    uint32_t bits = 0;
+
+    if (validity == NULL)
+        return 0xFFFFFFFFu;
+
+    if (width == 2)
+        memcpy(&bits, validity + i / 8, 4);
+    else if (width == 4)
+        memcpy(&bits, validity + i / 8, 2);
+    else
+        bits = validity[i / 8];
+
+    return bits;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t int_stats_avx512(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, int is_signed, const uint8_t* validity, stats_block* block)
+{
+    __m512i mask = _mm512_broadcast_i32x4(swap_mask_128(width, big));
+    __m512i zero = _mm512_setzero_si512();
+    __m512i flip = _mm512_set1_epi64((long long)key_flip(width, is_signed));
+    __m512i low = _mm512_set1_epi16(0xFF);
+    __m512i vmin = _mm512_set1_epi32(-1), vmax = zero, vsum = zero;
+    size_t lanes = 64 / width;
+    size_t i;
+    uint64_t min[8], max[8], sum[8];
+
+    if (width == 2)
+        flip = _mm512_set1_epi16(is_signed ? (short)0x8000 : 0);
+    else if (width == 4)
+        flip = _mm512_set1_epi32(is_signed ? (int)0x80000000u : 0);
+
+    for (i = 0; i + lanes <= count; i += lanes)
+    {
+        __m512i val = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*)(src + i * width)), mask);
+        __m512i key = _mm512_xor_si512(val, flip);
+        uint32_t valid = lane_bits_512(validity, i, width);
+
+        _mm512_storeu_si512((void*)(dst + i * width), val);
+
+        if (width == 2)
+        {
+            key = _mm512_maskz_mov_epi16(valid, key);
+            vmin = _mm512_mask_min_epu16(vmin, valid, vmin, key);
+            vmax = _mm512_max_epu16(vmax, key);
+            vsum = _mm512_add_epi64(vsum, _mm512_sad_epu8(_mm512_and_si512(key, low), zero));
+            vsum = _mm512_add_epi64(vsum, _mm512_slli_epi64(_mm512_sad_epu8(_mm512_srli_epi16(key, 8), zero), 8));
+        }
+        else if (width == 4)
+        {
+            key = _mm512_maskz_mov_epi32((__mmask16)valid, key);
+            vmin = _mm512_mask_min_epu32(vmin, (__mmask16)valid, vmin, key);
+            vmax = _mm512_max_epu32(vmax, key);
+            vsum = _mm512_add_epi64(vsum, _mm512_add_epi64(_mm512_unpacklo_epi32(key, zero), _mm512_unpackhi_epi32(key, zero)));
+        }
+        else
+        {
+            key = _mm512_maskz_mov_epi64((__mmask8)valid, key);
+            vmin = _mm512_mask_min_epu64(vmin, (__mmask8)valid, vmin, key);
+            vmax = _mm512_max_epu64(vmax, key);
+            vsum = _mm512_add_epi64(vsum, key);
+        }
+    }
+
+    _mm512_storeu_si512((void*)min, vmin);
+    _mm512_storeu_si512((void*)max, vmax);
+    _mm512_storeu_si512((void*)sum, vsum);
+    reduce_keys(block, min, max, sum, lanes, 8, width);
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t float_stats_avx512(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, const uint8_t* validity, stats_block* block)
+{
+    __m512i mask = _mm512_broadcast_i32x4(swap_mask_128(width, big));
+    size_t lanes = 64 / width;
+    size_t i;
+    __m512d sum_lo = _mm512_setzero_pd(), sum_hi = _mm512_setzero_pd();
+    double sum[16];
+    union
+    {
+        float f32[16];
+        double f64[8];
+    } min, max;
+
+    if (width == 4)
+    {
+        __m512 vmin = _mm512_set1_ps(INFINITY), vmax = _mm512_set1_ps(-INFINITY);
+
+        for (i = 0; i + 16 <= count; i += 16)
+        {
+            __m512i val = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*)(src + i * 4)), mask);
+            __m512 num = _mm512_castsi512_ps(val);
+            __mmask16 valid = (__mmask16)lane_bits_512(validity, i, 4);
+            __mmask16 used = _mm512_mask_cmp_ps_mask(valid, num, num, _CMP_ORD_Q);
+
+            _mm512_storeu_si512((void*)(dst + i * 4), val);
+
+            if (used != valid)
+                block->nans += (size_t)popcount64((uint64_t)(valid & ~used));
+
+            vmin = _mm512_mask_min_ps(vmin, used, vmin, num);
+            vmax = _mm512_mask_max_ps(vmax, used, vmax, num);
+            num = _mm512_maskz_mov_ps(used, num);
+            sum_lo = _mm512_add_pd(sum_lo, _mm512_cvtps_pd(_mm512_castps512_ps256(num)));
+            sum_hi = _mm512_add_pd(sum_hi, _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(num), 1))));
+        }
+
+        _mm512_storeu_ps(min.f32, vmin);
+        _mm512_storeu_ps(max.f32, vmax);
+    }
+    else
+    {
+        __m512d vmin = _mm512_set1_pd(INFINITY), vmax = _mm512_set1_pd(-INFINITY);
+
+        for (i = 0; i + 8 <= count; i += 8)
+        {
+            __m512i val = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*)(src + i * 8)), mask);
+            __m512d num = _mm512_castsi512_pd(val);
+            __mmask8 valid = (__mmask8)lane_bits_512(validity, i, 8);
+            __mmask8 used = _mm512_mask_cmp_pd_mask(valid, num, num, _CMP_ORD_Q);
+
+            _mm512_storeu_si512((void*)(dst + i * 8), val);
+
+            if (used != valid)
+                block->nans += (size_t)popcount64((uint64_t)(valid & ~used));
+
+            vmin = _mm512_mask_min_pd(vmin, used, vmin, num);
+            vmax = _mm512_mask_max_pd(vmax, used, vmax, num);
+            sum_lo = _mm512_add_pd(sum_lo, _mm512_maskz_mov_pd(used, num));
+        }
+
+        _mm512_storeu_pd(min.f64, vmin);
+        _mm512_storeu_pd(max.f64, vmax);
+    }
+
+    _mm512_storeu_pd(sum, sum_lo);
+    _mm512_storeu_pd(sum + 8, sum_hi);
+    reduce_floats(block, &min, &max, sum, lanes, 16, width);
+    return i;
+}
+
+#endif
+
+/*
+
+    Kernel selection
+
+*/
+
+static size_t int_stats(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, int is_signed, const uint8_t* validity, stats_block* block)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return int_stats_avx512(dst, src, count, width, big, is_signed, validity, block);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return int_stats_avx2(dst, src, count, width, big, is_signed, validity, block);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        if (conv_endian_has_sse42())
+            return int_stats_sse42(dst, src, count, width, big, is_signed, validity, block);
+        break;
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)width;
+    (void)big;
+    (void)is_signed;
+    (void)validity;
+    (void)block;
+    return 0;
+}
+
+static size_t float_stats(unsigned char* dst, const unsigned char* src, size_t count, size_t width, int big, const uint8_t* validity, stats_block* block)
+{
+#if defined(CONV_ENDIAN_X86)
+    switch (conv_endian_get_kernel())
+    {
+    case CONV_ENDIAN_KERNEL_AVX512:
+        return float_stats_avx512(dst, src, count, width, big, validity, block);
+    case CONV_ENDIAN_KERNEL_AVX2:
+        return float_stats_avx2(dst, src, count, width, big, validity, block);
+    case CONV_ENDIAN_KERNEL_SSSE3:
+        if (conv_endian_has_sse42())
+            return float_stats_sse42(dst, src, count, width, big, validity, block);
+        break;
+    default:
+        break;
+    }
+#endif
+
+    (void)dst;
+    (void)src;
+    (void)count;
+    (void)width;
+    (void)big;
+    (void)validity;
+    (void)block;
+    return 0;
+}
+
+/*
+
+    Merging statistics
+
+*/
+
+// a key of width bytes with its sign bit flipped back, sign extended
+static int64_t key_signed(uint64_t key, size_t width)
+{
+    uint64_t sign = (uint64_t)1 << (8 * width - 1);
+    uint64_t all = (sign << 1) - 1;
+
+    key = (key ^ sign) & all;
+
+    if (key & sign)
+        return -(int64_t)((all - key) & all) - 1;
+
+    return (int64_t)key;
+}
+
+static void read_int_stats(void* dst, const void* src, size_t count, size_t width, int big, int is_signed, const uint8_t* validity, conv_endian_stats* stats)
+{
+    stats_block block = {UINT64_MAX, 0, 0, 0.0, 0.0, 0.0, 0};
+    size_t valid = count_valid(validity, count);
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_STATS, count * width);
+
+    i = int_stats((unsigned char*)dst, (const unsigned char*)src, count, width, big, is_signed, validity, &block);
+    int_stats_scalar((unsigned char*)dst, (const unsigned char*)src, i, count, width, big, is_signed, validity, &block);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_STATS, count * width);
+
+    stats->null_count += count - valid;
+
+    if (valid == 0)
+        return;
+
+    if (is_signed)
+    {
+        int64_t min = key_signed(block.min, width);
+        int64_t max = key_signed(block.max, width);
+
+        stats->min.s = stats->count == 0 || min < stats->min.s ? min : stats->min.s;
+        stats->max.s = stats->count == 0 || max > stats->max.s ? max : stats->max.s;
+    }
+    else
+    {
+        stats->min.u = stats->count == 0 || block.min < stats->min.u ? block.min : stats->min.u;
+        stats->max.u = stats->count == 0 || block.max > stats->max.u ? block.max : stats->max.u;
+    }
+
+    stats->sum.u += block.sum - (uint64_t)valid * key_flip(width, is_signed);
+    stats->count += valid;
+}
+
+static void read_float_stats(void* dst, const void* src, size_t count, size_t width, int big, const uint8_t* validity, conv_endian_stats* stats)
+{
+    stats_block block = {0, 0, 0, INFINITY, -INFINITY, 0.0, 0};
+    size_t valid = count_valid(validity, count);
+    size_t i;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_STATS, count * width);
+
+    i = float_stats((unsigned char*)dst, (const unsigned char*)src, count, width, big, validity, &block);
+    float_stats_scalar((unsigned char*)dst, (const unsigned char*)src, i, count, width, big, validity, &block);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_STATS, count * width);
+
+    stats->null_count += count - valid;
+    stats->nan_count += block.nans;
+
+    if (valid == block.nans)
+        return;
+
+    stats->min.f = stats->count == 0 || block.fmin < stats->min.f ? block.fmin : stats->min.f;
+    stats->max.f = stats->count == 0 || block.fmax > stats->max.f ? block.fmax : stats->max.f;
+    stats->sum.f = stats->count == 0 ? block.fsum : stats->sum.f + block.fsum;
+    stats->count += valid - block.nans;
+}
+
+/*
+
+    Reading arrays with their statistics
+
+*/
+
+/// @brief Reads an array of 16-bit unsigned little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_u16_array_stats(uint16_t* dst, const uint16_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 2, 0, 0, validity, stats);
+}
+
+/// @brief Reads an array of 16-bit signed little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_s16_array_stats(int16_t* dst, const int16_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 2, 0, 1, validity, stats);
+}
+
+/// @brief Reads an array of 32-bit unsigned little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_u32_array_stats(uint32_t* dst, const uint32_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 4, 0, 0, validity, stats);
+}
+
+/// @brief Reads an array of 32-bit signed little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_s32_array_stats(int32_t* dst, const int32_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 4, 0, 1, validity, stats);
+}
+
+/// @brief Reads an array of 32-bit little endian floating point numbers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_f32_array_stats(float* dst, const float* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_float_stats(dst, src, count, 4, 0, validity, stats);
+}
+
+/// @brief Reads an array of 64-bit unsigned little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_u64_array_stats(uint64_t* dst, const uint64_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 8, 0, 0, validity, stats);
+}
+
+/// @brief Reads an array of 64-bit signed little endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_s64_array_stats(int64_t* dst, const int64_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 8, 0, 1, validity, stats);
+}
+
+/// @brief Reads an array of 64-bit little endian floating point numbers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in little endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_le_f64_array_stats(double* dst, const double* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_float_stats(dst, src, count, 8, 0, validity, stats);
+}
+
+/// @brief Reads an array of 16-bit unsigned big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_u16_array_stats(uint16_t* dst, const uint16_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 2, 1, 0, validity, stats);
+}
+
+/// @brief Reads an array of 16-bit signed big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_s16_array_stats(int16_t* dst, const int16_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 2, 1, 1, validity, stats);
+}
+
+/// @brief Reads an array of 32-bit unsigned big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_u32_array_stats(uint32_t* dst, const uint32_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 4, 1, 0, validity, stats);
+}
+
+/// @brief Reads an array of 32-bit signed big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_s32_array_stats(int32_t* dst, const int32_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 4, 1, 1, validity, stats);
+}
+
+/// @brief Reads an array of 32-bit big endian floating point numbers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_f32_array_stats(float* dst, const float* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_float_stats(dst, src, count, 4, 1, validity, stats);
+}
+
+/// @brief Reads an array of 64-bit unsigned big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_u64_array_stats(uint64_t* dst, const uint64_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 8, 1, 0, validity, stats);
+}
+
+/// @brief Reads an array of 64-bit signed big endian integers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_s64_array_stats(int64_t* dst, const int64_t* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_int_stats(dst, src, count, 8, 1, 1, validity, stats);
+}
+
+/// @brief Reads an array of 64-bit big endian floating point numbers and merges their statistics into stats
+/// @param dst array that receives the values in their endianness of their machine, may be the same array as src
+/// @param src array of count values in big endian
+/// @param count number of values in src
+/// @param validity bitmap of the values that are not null, or NULL if no value is null
+/// @param stats statistics that the statistics of the values are merged into
+void read_be_f64_array_stats(double* dst, const double* src, size_t count, const uint8_t* validity, conv_endian_stats* stats)
+{
+    read_float_stats(dst, src, count, 8, 1, validity, stats);
+}
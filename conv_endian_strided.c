@@ -0,0 +1,368 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_strided.c
+/// @brief A C portable source code that contains implementation of functions for converting one field of an array of records
+
+
+#include "conv_endian.h"
+#include "conv_endian_internal.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+
+    Scalar kernels
+
+*/
+
+static void gather_scalar(unsigned char* dst, const unsigned char* base, size_t stride, size_t count, size_t width, int swap)
+{
+    size_t i;
+
+    switch (width)
+    {
+    case 1:
+        for (i = 0; i < count; i++)
+            dst[i] = base[i * stride];
+        break;
+    case 2:
+        for (i = 0; i < count; i++)
+        {
+            uint16_t val;
+            memcpy(&val, base + i * stride, sizeof(val));
+            if (swap)
+                val = conv_endian_bswap16(val);
+            memcpy(dst + i * 2, &val, sizeof(val));
+        }
+        break;
+    case 4:
+        for (i = 0; i < count; i++)
+        {
+            uint32_t val;
+            memcpy(&val, base + i * stride, sizeof(val));
+            if (swap)
+                val = conv_endian_bswap32(val);
+            memcpy(dst + i * 4, &val, sizeof(val));
+        }
+        break;
+    default:
+        for (i = 0; i < count; i++)
+        {
+            uint64_t val;
+            memcpy(&val, base + i * stride, sizeof(val));
+            if (swap)
+                val = conv_endian_bswap64(val);
+            memcpy(dst + i * 8, &val, sizeof(val));
+        }
+        break;
+    }
+}
+
+static void scatter_scalar(unsigned char* base, size_t stride, const unsigned char* src, size_t count, size_t width, int swap)
+{
+    size_t i;
+
+    switch (width)
+    {
+    case 1:
+        for (i = 0; i < count; i++)
+            base[i * stride] = src[i];
+        break;
+    case 2:
+        for (i = 0; i < count; i++)
+        {
+            uint16_t val;
+            memcpy(&val, src + i * 2, sizeof(val));
+            if (swap)
+                val = conv_endian_bswap16(val);
+            memcpy(base + i * stride, &val, sizeof(val));
+        }
+        break;
+    case 4:
+        for (i = 0; i < count; i++)
+        {
+            uint32_t val;
+            memcpy(&val, src + i * 4, sizeof(val));
+            if (swap)
+                val = conv_endian_bswap32(val);
+            memcpy(base + i * stride, &val, sizeof(val));
+        }
+        break;
+    default:
+        for (i = 0; i < count; i++)
+        {
+            uint64_t val;
+            memcpy(&val, src + i * 8, sizeof(val));
+            if (swap)
+                val = conv_endian_bswap64(val);
+            memcpy(base + i * stride, &val, sizeof(val));
+        }
+        break;
+    }
+}
+
+/*
+
+    Vector kernels
+
+    The kernels gather a register of fields with one instruction using a
+    vector of offsets that are multiples of the stride, byte swap the whole
+    register and store it densely. They return the number of records they
+    have converted so that the caller can finish the rest with a scalar
+    kernel. Offsets are 32-bit, so the caller only uses them when every
+    offset of a register fits.
+
+    16-bit fields are gathered as 32-bit values, which reads two bytes past
+    the field, so the last record is always left to the scalar kernel.
+
+*/
+
+#if defined(CONV_ENDIAN_X86)
+
+CONV_ENDIAN_TARGET("avx2")
+static size_t gather_avx2(unsigned char* dst, const unsigned char* base, size_t stride, size_t count, size_t width, int swap)
+{
+    const __m256i swap16 = _mm256_setr_epi8(
+        1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1,
+        1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i keep16 = _mm256_setr_epi8(
+        0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+        0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i swap32 = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256i swap64 = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const int s = (int)stride;
+    const __m256i offsets8 = _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+    const __m128i offsets4 = _mm_setr_epi32(0, s, 2 * s, 3 * s);
+    size_t i = 0;
+
+    if (width == 2)
+    {
+        const __m256i mask = swap ? swap16 : keep16;
+
+        for (; i + 8 < count; i += 8)
+        {
+            __m256i v = _mm256_i32gather_epi32((const int*)(base + i * stride), offsets8, 1);
+            v = _mm256_shuffle_epi8(v, mask);
+            v = _mm256_permute4x64_epi64(v, 0x08);
+            _mm_storeu_si128((__m128i*)(dst + i * 2), _mm256_castsi256_si128(v));
+        }
+    }
+    else if (width == 4)
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i v = _mm256_i32gather_epi32((const int*)(base + i * stride), offsets8, 1);
+            if (swap)
+                v = _mm256_shuffle_epi8(v, swap32);
+            _mm256_storeu_si256((__m256i*)(dst + i * 4), v);
+        }
+    }
+    else
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256i v = _mm256_i32gather_epi64((const long long*)(base + i * stride), offsets4, 1);
+            if (swap)
+                v = _mm256_shuffle_epi8(v, swap64);
+            _mm256_storeu_si256((__m256i*)(dst + i * 8), v);
+        }
+    }
+
+    return i;
+}
+
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t gather_avx512(unsigned char* dst, const unsigned char* base, size_t stride, size_t count, size_t width, int swap)
+{
+    const __m512i swap16 = _mm512_broadcast_i32x4(_mm_setr_epi8(1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1));
+    const __m512i swap32 = _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    const __m512i swap64 = _mm512_broadcast_i32x4(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    const __m512i offsets16 = _mm512_mullo_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32((int)stride));
+    const __m256i offsets8 = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)stride));
+    size_t i = 0;
+
+    if (width == 2)
+    {
+        for (; i + 16 < count; i += 16)
+        {
+            __m512i v = _mm512_i32gather_epi32(offsets16, (const void*)(base + i * stride), 1);
+            if (swap)
+            {
+                v = _mm512_shuffle_epi8(v, swap16);
+                v = _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), v);
+                _mm256_storeu_si256((__m256i*)(dst + i * 2), _mm512_castsi512_si256(v));
+            }
+            else
+            {
+                _mm256_storeu_si256((__m256i*)(dst + i * 2), _mm512_cvtepi32_epi16(v));
+            }
+        }
+    }
+    else if (width == 4)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i v = _mm512_i32gather_epi32(offsets16, (const void*)(base + i * stride), 1);
+            if (swap)
+                v = _mm512_shuffle_epi8(v, swap32);
+            _mm512_storeu_si512((void*)(dst + i * 4), v);
+        }
+    }
+    else
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m512i v = _mm512_i32gather_epi64(offsets8, (const void*)(base + i * stride), 1);
+            if (swap)
+                v = _mm512_shuffle_epi8(v, swap64);
+            _mm512_storeu_si512((void*)(dst + i * 8), v);
+        }
+    }
+
+    return i;
+}
+
+// there is no 16-bit scatter, so only 32-bit and 64-bit fields are scattered here
+CONV_ENDIAN_TARGET("avx512f,avx512bw")
+static size_t scatter_avx512(unsigned char* base, size_t stride, const unsigned char* src, size_t count, size_t width, int swap)
+{
+    const __m512i swap32 = _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    const __m512i swap64 = _mm512_broadcast_i32x4(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    const __m512i offsets16 = _mm512_mullo_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32((int)stride));
+    const __m256i offsets8 = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)stride));
+    size_t i = 0;
+
+    if (width == 4)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i v = _mm512_loadu_si512((const void*)(src + i * 4));
+            if (swap)
+                v = _mm512_shuffle_epi8(v, swap32);
+            _mm512_i32scatter_epi32((void*)(base + i * stride), offsets16, v, 1);
+        }
+    }
+    else if (width == 8)
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m512i v = _mm512_loadu_si512((const void*)(src + i * 8));
+            if (swap)
+                v = _mm512_shuffle_epi8(v, swap64);
+            _mm512_i32scatter_epi64((void*)(base + i * stride), offsets8, v, 1);
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+/*
+
+    Strided conversion
+
+*/
+
+// 16 offsets of a register have to fit in a signed 32-bit integer
+#define STRIDE_VECTOR_LIMIT ((size_t)0x7FFFFFFF / 16)
+
+/// @brief Converts one field of every record in an array of records into a dense array
+/// @param dst dense array that receives count numbers in their endianness of their machine
+/// @param base address of the field in the first record
+/// @param stride number of bytes from one record to the next, at least width
+/// @param count number of records
+/// @param width number of bytes in the field: 1, 2, 4 or 8
+/// @param order endianness of the field
+/// @return 0 on success or -1 if width or stride is not supported
+int conv_endian_gather(void* dst, const void* base, size_t stride, size_t count, size_t width, conv_endian_order order)
+{
+    unsigned char* dst_bytes = (unsigned char*)dst;
+    const unsigned char* base_bytes = (const unsigned char*)base;
+    int swap = conv_endian_needs_swap(width, order);
+    size_t done = 0;
+
+    if ((width != 1 && width != 2 && width != 4 && width != 8) || stride < width)
+        return -1;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_GATHER, count * width);
+
+#if defined(CONV_ENDIAN_X86)
+    if (width != 1 && stride <= STRIDE_VECTOR_LIMIT)
+    {
+        conv_endian_kernel kernel = conv_endian_get_kernel();
+
+        if (kernel == CONV_ENDIAN_KERNEL_AVX512)
+            done = gather_avx512(dst_bytes, base_bytes, stride, count, width, swap);
+        else if (kernel == CONV_ENDIAN_KERNEL_AVX2)
+            done = gather_avx2(dst_bytes, base_bytes, stride, count, width, swap);
+    }
+#endif
+
+    gather_scalar(dst_bytes + done * width, base_bytes + done * stride, stride, count - done, width, swap);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_GATHER, count * width);
+    return 0;
+}
+
+/// @brief Converts a dense array into one field of every record in an array of records
+/// @param base address of the field in the first record
+/// @param stride number of bytes from one record to the next, at least width
+/// @param src dense array of count numbers in their endianness of their machine
+/// @param count number of records
+/// @param width number of bytes in the field: 1, 2, 4 or 8
+/// @param order endianness the field is written in
+/// @return 0 on success or -1 if width or stride is not supported
+int conv_endian_scatter(void* base, size_t stride, const void* src, size_t count, size_t width, conv_endian_order order)
+{
+    unsigned char* base_bytes = (unsigned char*)base;
+    const unsigned char* src_bytes = (const unsigned char*)src;
+    int swap = conv_endian_needs_swap(width, order);
+    size_t done = 0;
+
+    if ((width != 1 && width != 2 && width != 4 && width != 8) || stride < width)
+        return -1;
+
+    CONV_ENDIAN_TRACE_BEGIN(CONV_ENDIAN_OPERATION_SCATTER, count * width);
+
+#if defined(CONV_ENDIAN_X86)
+    if ((width == 4 || width == 8) && stride <= STRIDE_VECTOR_LIMIT &&
+        conv_endian_get_kernel() == CONV_ENDIAN_KERNEL_AVX512)
+        done = scatter_avx512(base_bytes, stride, src_bytes, count, width, swap);
+#endif
+
+    scatter_scalar(base_bytes + done * stride, stride, src_bytes + done * width, count - done, width, swap);
+
+    CONV_ENDIAN_TRACE_END(CONV_ENDIAN_OPERATION_SCATTER, count * width);
+    return 0;
+}
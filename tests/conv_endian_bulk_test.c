@@ -0,0 +1,257 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_bulk_test.c
+/// @brief Tests that the bulk byte swaps, record permutations and CRC32C of every kernel match the scalar code and stay within their arrays, next to pages that cannot be accessed
+
+
+#include "conv_endian.h"
+#include "conv_endian_test.h"
+#include <string.h>
+
+// enough values for several vector blocks and every length of tail
+#define TEST_COUNT 300
+
+// largest record that is permuted
+#define TEST_RECORD 16
+
+#define TEST_BYTES (TEST_COUNT * TEST_RECORD)
+
+typedef void (*swap_function)(void* dst, const void* src, size_t count);
+typedef uint32_t (*swap_crc_function)(void* dst, const void* src, size_t count, uint32_t crc);
+
+static unsigned char values[TEST_BYTES];
+static unsigned char expected[TEST_BYTES];
+
+/*
+
+    Reference
+
+*/
+
+/// @brief Computes the CRC32C of a buffer one bit at a time
+/// @param data buffer to be checksummed
+/// @param size number of bytes in data
+/// @param crc CRC32C of the data before this buffer, or 0 for the first buffer
+/// @return CRC32C of the data up to the end of this buffer
+static uint32_t reference_crc32c(const unsigned char* data, size_t size, uint32_t crc)
+{
+    size_t i;
+    int bit;
+
+    crc = ~crc;
+    for (i = 0; i < size; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1)));
+    }
+
+    return ~crc;
+}
+
+/*
+
+    Tests
+
+*/
+
+static void test_swaps(guarded_memory* guarded, conv_endian_kernel kernel)
+{
+    static const swap_function swaps[] = { conv_endian_bswap16_array, conv_endian_bswap32_array, conv_endian_bswap64_array };
+    static const swap_function streams[] = { conv_endian_bswap16_array_stream, conv_endian_bswap32_array_stream, conv_endian_bswap64_array_stream };
+    static const size_t widths[] = { 2, 4, 8 };
+    size_t w, count;
+
+    for (w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+    {
+        for (count = 0; count <= TEST_COUNT; count++)
+        {
+            size_t bytes = count * widths[w];
+            unsigned char* at_start = guarded->data;
+            unsigned char* at_end = guarded_memory_end(guarded, bytes);
+
+            // the scalar kernel gives the expected results
+            conv_endian_set_kernel(CONV_ENDIAN_KERNEL_SCALAR);
+            swaps[w](expected, values, count);
+            conv_endian_set_kernel(kernel);
+
+            // values read from the end and written to the start of the memory, then the other way around
+            memcpy(at_end, values, bytes);
+            swaps[w](at_start, at_end, count);
+            CHECK(memcmp(at_start, expected, bytes) == 0);
+            memcpy(at_start, values, bytes);
+            swaps[w](at_end, at_start, count);
+            CHECK(memcmp(at_end, expected, bytes) == 0);
+
+            // the same with non-temporal stores
+            memcpy(at_end, values, bytes);
+            streams[w](at_start, at_end, count);
+            CHECK(memcmp(at_start, expected, bytes) == 0);
+            memcpy(at_start, values, bytes);
+            streams[w](at_end, at_start, count);
+            CHECK(memcmp(at_end, expected, bytes) == 0);
+
+            // in place at either end of the memory
+            memcpy(at_end, values, bytes);
+            swaps[w](at_end, at_end, count);
+            CHECK(memcmp(at_end, expected, bytes) == 0);
+            memcpy(at_start, values, bytes);
+            swaps[w](at_start, at_start, count);
+            CHECK(memcmp(at_start, expected, bytes) == 0);
+        }
+    }
+}
+
+static void test_permute(guarded_memory* guarded, conv_endian_kernel kernel)
+{
+    // a 16-bit and a 32-bit number, a 16-bit, a 32-bit and a 64-bit number,
+    // two 64-bit numbers, and a 24-bit number, which do not all fit shuffles
+    static const uint16_t perm6[] = { 1, 0, 5, 4, 3, 2 };
+    static const uint16_t perm14[] = { 1, 0, 5, 4, 3, 2, 13, 12, 11, 10, 9, 8, 7, 6 };
+    static const uint16_t perm16[] = { 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 };
+    static const uint16_t perm3[] = { 2, 1, 0 };
+    static const uint16_t* perms[] = { perm6, perm14, perm16, perm3 };
+    static const size_t record_sizes[] = { 6, 14, 16, 3 };
+    size_t p, count;
+
+    for (p = 0; p < sizeof(record_sizes) / sizeof(record_sizes[0]); p++)
+    {
+        for (count = 0; count <= TEST_COUNT; count++)
+        {
+            size_t bytes = count * record_sizes[p];
+            unsigned char* at_start = guarded->data;
+            unsigned char* at_end = guarded_memory_end(guarded, bytes);
+
+            conv_endian_set_kernel(CONV_ENDIAN_KERNEL_SCALAR);
+            CHECK(conv_endian_permute_records(expected, values, count, record_sizes[p], perms[p]) == 0);
+            conv_endian_set_kernel(kernel);
+
+            memcpy(at_end, values, bytes);
+            CHECK(conv_endian_permute_records(at_start, at_end, count, record_sizes[p], perms[p]) == 0);
+            CHECK(memcmp(at_start, expected, bytes) == 0);
+            memcpy(at_start, values, bytes);
+            CHECK(conv_endian_permute_records(at_end, at_start, count, record_sizes[p], perms[p]) == 0);
+            CHECK(memcmp(at_end, expected, bytes) == 0);
+
+            memcpy(at_end, values, bytes);
+            CHECK(conv_endian_permute_records(at_end, at_end, count, record_sizes[p], perms[p]) == 0);
+            CHECK(memcmp(at_end, expected, bytes) == 0);
+        }
+    }
+}
+
+// the scalar kernel computes the CRC32C with a table, the vector kernels
+// with the CRC32 instruction when the processor has it
+static void test_crc32c(guarded_memory* guarded, conv_endian_kernel kernel)
+{
+    static const swap_crc_function swaps[] = { conv_endian_bswap16_array_crc32c, conv_endian_bswap32_array_crc32c, conv_endian_bswap64_array_crc32c };
+    static const swap_crc_function swaps_dst[] = { conv_endian_bswap16_array_crc32c_dst, conv_endian_bswap32_array_crc32c_dst, conv_endian_bswap64_array_crc32c_dst };
+    static const size_t widths[] = { 2, 4, 8 };
+    static const uint32_t seed = 0x12345678;
+    size_t w, count, size;
+
+    conv_endian_set_kernel(kernel);
+
+    CHECK(conv_endian_crc32c("123456789", 9, 0) == 0xE3069283);
+
+    for (size = 0; size <= TEST_COUNT; size++)
+    {
+        unsigned char* at_end = guarded_memory_end(guarded, size);
+        uint32_t crc = reference_crc32c(values, size, seed);
+
+        memcpy(guarded->data, values, size);
+        CHECK(conv_endian_crc32c(guarded->data, size, seed) == crc);
+        memcpy(at_end, values, size);
+        CHECK(conv_endian_crc32c(at_end, size, seed) == crc);
+
+        // chained over two buffers
+        CHECK(conv_endian_crc32c(at_end + size / 3, size - size / 3, conv_endian_crc32c(at_end, size / 3, seed)) == crc);
+    }
+
+    for (w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+    {
+        for (count = 0; count <= TEST_COUNT; count++)
+        {
+            size_t bytes = count * widths[w];
+            unsigned char* at_start = guarded->data;
+            unsigned char* at_end = guarded_memory_end(guarded, bytes);
+            uint32_t src_crc = reference_crc32c(values, bytes, seed);
+            uint32_t dst_crc;
+
+            conv_endian_set_kernel(CONV_ENDIAN_KERNEL_SCALAR);
+            swaps[w](expected, values, count, 0);
+            conv_endian_set_kernel(kernel);
+            dst_crc = reference_crc32c(expected, bytes, seed);
+
+            // checksum of the source
+            memcpy(at_end, values, bytes);
+            CHECK(swaps[w](at_start, at_end, count, seed) == src_crc);
+            CHECK(memcmp(at_start, expected, bytes) == 0);
+            memcpy(at_end, values, bytes);
+            CHECK(swaps[w](at_end, at_end, count, seed) == src_crc);
+            CHECK(memcmp(at_end, expected, bytes) == 0);
+
+            // checksum of the destination
+            memcpy(at_start, values, bytes);
+            CHECK(swaps_dst[w](at_end, at_start, count, seed) == dst_crc);
+            CHECK(memcmp(at_end, expected, bytes) == 0);
+            memcpy(at_start, values, bytes);
+            CHECK(swaps_dst[w](at_start, at_start, count, seed) == dst_crc);
+            CHECK(memcmp(at_start, expected, bytes) == 0);
+        }
+    }
+}
+
+int main(void)
+{
+    guarded_memory guarded;
+    size_t i;
+    int kernel;
+
+    // room for a source and a destination that do not overlap
+    if (guarded_memory_create(&guarded, 2 * TEST_BYTES) != 0)
+    {
+        perror("mmap");
+        return 1;
+    }
+
+    srand(1);
+    for (i = 0; i < sizeof(values); i++)
+        values[i] = (unsigned char)rand();
+
+    for (kernel = CONV_ENDIAN_KERNEL_SCALAR; kernel <= (int)conv_endian_best_kernel(); kernel++)
+    {
+        printf("testing the %s kernel\n", conv_endian_kernel_name((conv_endian_kernel)kernel));
+        test_swaps(&guarded, (conv_endian_kernel)kernel);
+        test_permute(&guarded, (conv_endian_kernel)kernel);
+        test_crc32c(&guarded, (conv_endian_kernel)kernel);
+    }
+
+    guarded_memory_destroy(&guarded);
+
+    return test_finish();
+}
@@ -0,0 +1,122 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_pcm_test.c
+/// @brief Tests that the PCM sample conversions of every kernel stay within their arrays, next to pages that cannot be accessed
+
+
+#include "conv_endian.h"
+#include "conv_endian_test.h"
+#include <string.h>
+
+// enough samples for several vector blocks and every length of tail
+#define TEST_COUNT 100
+
+/*
+
+    Tests
+
+*/
+
+static void test_kernel(guarded_memory* guarded, conv_endian_kernel kernel)
+{
+    static const size_t widths[] = { 2, 3, 4 };
+    unsigned char samples[TEST_COUNT * 4];
+    unsigned char expected_samples[TEST_COUNT * 4];
+    float floats[TEST_COUNT];
+    float expected_floats[TEST_COUNT];
+    float out[TEST_COUNT];
+    size_t w, count, i;
+    int big;
+
+    for (i = 0; i < sizeof(samples); i++)
+        samples[i] = (unsigned char)rand();
+    for (i = 0; i < TEST_COUNT; i++)
+        floats[i] = (float)rand() / (float)RAND_MAX * 2.0f - 1.0f;
+
+    for (w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+    {
+        size_t width = widths[w];
+
+        for (big = 0; big < 2; big++)
+        {
+            conv_endian_order order = big ? CONV_ENDIAN_ORDER_BIG : CONV_ENDIAN_ORDER_LITTLE;
+
+            for (count = 0; count <= TEST_COUNT; count++)
+            {
+                size_t bytes = count * width;
+                unsigned char* at_start = guarded->data;
+                unsigned char* at_end = guarded_memory_end(guarded, bytes);
+
+                // the scalar kernel gives the expected results
+                conv_endian_set_kernel(CONV_ENDIAN_KERNEL_SCALAR);
+                CHECK(conv_endian_pcm_to_float(expected_floats, samples, count, width, order) == 0);
+                CHECK(conv_endian_float_to_pcm(expected_samples, floats, count, width, order) == 0);
+                conv_endian_set_kernel(kernel);
+
+                // samples that end where the next page starts
+                memcpy(at_end, samples, bytes);
+                CHECK(conv_endian_pcm_to_float(out, at_end, count, width, order) == 0);
+                CHECK(memcmp(out, expected_floats, count * sizeof(float)) == 0);
+
+                // samples that start where the previous page ends
+                memcpy(at_start, samples, bytes);
+                CHECK(conv_endian_pcm_to_float(out, at_start, count, width, order) == 0);
+                CHECK(memcmp(out, expected_floats, count * sizeof(float)) == 0);
+
+                // written samples at either end of the page
+                CHECK(conv_endian_float_to_pcm(at_end, floats, count, width, order) == 0);
+                CHECK(memcmp(at_end, expected_samples, bytes) == 0);
+                CHECK(conv_endian_float_to_pcm(at_start, floats, count, width, order) == 0);
+                CHECK(memcmp(at_start, expected_samples, bytes) == 0);
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    guarded_memory guarded;
+    int kernel;
+
+    if (guarded_memory_create(&guarded, TEST_COUNT * 4) != 0)
+    {
+        perror("mmap");
+        return 1;
+    }
+
+    srand(1);
+
+    for (kernel = CONV_ENDIAN_KERNEL_SCALAR; kernel <= (int)conv_endian_best_kernel(); kernel++)
+    {
+        printf("testing the %s kernel\n", conv_endian_kernel_name((conv_endian_kernel)kernel));
+        test_kernel(&guarded, (conv_endian_kernel)kernel);
+    }
+
+    guarded_memory_destroy(&guarded);
+
+    return test_finish();
+}
@@ -0,0 +1,198 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_pipeline_test.c
+/// @brief Tests of the file conversion pipeline on temporary files, with every backend the system allows
+
+
+#include "conv_endian.h"
+#include "conv_endian_pipeline.h"
+#include "conv_endian_test.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+// three full blocks, one partial block and two bytes of a partial element
+#define TEST_BLOCK 4096
+#define TEST_SIZE (TEST_BLOCK * 3 + 1000 + 2)
+
+static unsigned char original[TEST_SIZE];
+static unsigned char expected[TEST_SIZE];
+
+static int make_temp_file(char* path, const void* data, size_t size)
+{
+    const char* dir = getenv("TMPDIR");
+    int fd;
+
+    snprintf(path, 256, "%s/conv_endian_pipeline_XXXXXX", dir != NULL ? dir : "/tmp");
+
+    fd = mkstemp(path);
+    if (fd < 0)
+        return -1;
+
+    if (size != 0 && pwrite(fd, data, size, 0) != (ssize_t)size)
+    {
+        close(fd);
+        unlink(path);
+        return -1;
+    }
+
+    return fd;
+}
+
+static int file_equals(int fd, const void* data, size_t size)
+{
+    unsigned char* contents = (unsigned char*)malloc(size + 1);
+    int equal;
+
+    if (contents == NULL)
+        return 0;
+
+    // one byte more than expected shows that the file is not longer
+    equal = pread(fd, contents, size + 1, 0) == (ssize_t)size && memcmp(contents, data, size) == 0;
+
+    free(contents);
+    return equal;
+}
+
+static void set_options(conv_endian_pipeline_options* options, conv_endian_backend backend)
+{
+    conv_endian_pipeline_default_options(options);
+    options->block_size = TEST_BLOCK;
+    options->queue_depth = 4;
+    options->width = 4;
+    options->backend = backend;
+}
+
+// returns 0 when the backend cannot be used on this system
+static int test_convert_fd(conv_endian_backend backend)
+{
+    conv_endian_pipeline_options options;
+    conv_endian_pipeline_stats stats;
+    char src_path[256], dst_path[256];
+    int src_fd, dst_fd, result;
+
+    src_fd = make_temp_file(src_path, original, sizeof(original));
+    dst_fd = make_temp_file(dst_path, NULL, 0);
+    CHECK(src_fd >= 0 && dst_fd >= 0);
+    if (src_fd < 0 || dst_fd < 0)
+        return 1;
+
+    set_options(&options, backend);
+
+    // converting up to the end must not move the offsets of the descriptors
+    CHECK(lseek(src_fd, 100, SEEK_SET) == 100);
+
+    result = conv_endian_pipeline_convert_fd(dst_fd, 0, src_fd, 0, CONV_ENDIAN_PIPELINE_TO_END, &options, &stats);
+
+    if (result != 0 && backend == CONV_ENDIAN_BACKEND_IO_URING && stats.backend != CONV_ENDIAN_BACKEND_IO_URING)
+    {
+        close(src_fd);
+        close(dst_fd);
+        unlink(src_path);
+        unlink(dst_path);
+        return 0;
+    }
+
+    CHECK(result == 0);
+    CHECK(stats.bytes == sizeof(original));
+    CHECK(stats.backend == (backend == CONV_ENDIAN_BACKEND_IO_URING ? CONV_ENDIAN_BACKEND_IO_URING : CONV_ENDIAN_BACKEND_PREAD));
+    CHECK(lseek(src_fd, 0, SEEK_CUR) == 100);
+    CHECK(file_equals(dst_fd, expected, sizeof(expected)));
+
+    // a range that starts in the middle of the file, written at another offset
+    result = conv_endian_pipeline_convert_fd(dst_fd, 8, src_fd, TEST_BLOCK, 2 * TEST_BLOCK, &options, &stats);
+    CHECK(result == 0);
+    CHECK(stats.bytes == 2 * TEST_BLOCK);
+
+    {
+        unsigned char range[2 * TEST_BLOCK];
+
+        CHECK(pread(dst_fd, range, sizeof(range), 8) == (ssize_t)sizeof(range));
+        CHECK(memcmp(range, expected + TEST_BLOCK, sizeof(range)) == 0);
+    }
+
+    close(src_fd);
+    close(dst_fd);
+    unlink(src_path);
+    unlink(dst_path);
+    return 1;
+}
+
+static void test_convert_file(conv_endian_backend backend)
+{
+    conv_endian_pipeline_options options;
+    char src_path[256], dst_path[256];
+    int src_fd, dst_fd;
+
+    set_options(&options, backend);
+
+    src_fd = make_temp_file(src_path, original, sizeof(original));
+    dst_fd = make_temp_file(dst_path, expected, 100);
+    CHECK(src_fd >= 0 && dst_fd >= 0);
+    if (src_fd < 0 || dst_fd < 0)
+        return;
+
+    // into another, shorter file
+    CHECK(conv_endian_pipeline_convert_file(dst_path, src_path, &options, NULL) == 0);
+    CHECK(file_equals(dst_fd, expected, sizeof(expected)));
+
+    // in place, into the same file
+    CHECK(conv_endian_pipeline_convert_file(src_path, src_path, &options, NULL) == 0);
+    CHECK(file_equals(src_fd, expected, sizeof(expected)));
+
+    close(src_fd);
+    close(dst_fd);
+    unlink(src_path);
+    unlink(dst_path);
+}
+
+int main(void)
+{
+    size_t whole = sizeof(original) - sizeof(original) % 4;
+    size_t i;
+
+    srand(1);
+    for (i = 0; i < sizeof(original); i++)
+        original[i] = (unsigned char)rand();
+
+    // the bytes of the partial element at the end are copied unchanged
+    conv_endian_bswap32_array(expected, original, whole / 4);
+    memcpy(expected + whole, original + whole, sizeof(original) - whole);
+
+    test_convert_fd(CONV_ENDIAN_BACKEND_PREAD);
+    test_convert_file(CONV_ENDIAN_BACKEND_PREAD);
+
+    if (test_convert_fd(CONV_ENDIAN_BACKEND_IO_URING))
+        test_convert_file(CONV_ENDIAN_BACKEND_IO_URING);
+    else
+        printf("io_uring is not available, only pread and pwrite were tested\n");
+
+    return test_finish();
+}
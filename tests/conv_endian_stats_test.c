@@ -0,0 +1,243 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_stats_test.c
+/// @brief Tests that the statistics of every kernel match the scalar code and that the kernels stay within their arrays and validity bitmaps, next to pages that cannot be accessed
+
+
+#include "conv_endian.h"
+#include "conv_endian_test.h"
+#include <math.h>
+#include <string.h>
+
+// enough values for several vector blocks and every length of tail
+#define TEST_COUNT 300
+
+#define TEST_BYTES (TEST_COUNT * 8)
+
+typedef void (*stats_function)(void* dst, const void* src, size_t count, const uint8_t* validity, conv_endian_stats* stats);
+
+// the functions under test, called through the same type
+#define STATS_FUNCTION(name, type) \
+    static void test_##name(void* dst, const void* src, size_t count, const uint8_t* validity, conv_endian_stats* stats) \
+    { \
+        name((type*)dst, (const type*)src, count, validity, stats); \
+    }
+
+STATS_FUNCTION(read_le_u16_array_stats, uint16_t)
+STATS_FUNCTION(read_le_s16_array_stats, int16_t)
+STATS_FUNCTION(read_le_u32_array_stats, uint32_t)
+STATS_FUNCTION(read_le_s32_array_stats, int32_t)
+STATS_FUNCTION(read_le_f32_array_stats, float)
+STATS_FUNCTION(read_le_u64_array_stats, uint64_t)
+STATS_FUNCTION(read_le_s64_array_stats, int64_t)
+STATS_FUNCTION(read_le_f64_array_stats, double)
+STATS_FUNCTION(read_be_u16_array_stats, uint16_t)
+STATS_FUNCTION(read_be_s16_array_stats, int16_t)
+STATS_FUNCTION(read_be_u32_array_stats, uint32_t)
+STATS_FUNCTION(read_be_s32_array_stats, int32_t)
+STATS_FUNCTION(read_be_f32_array_stats, float)
+STATS_FUNCTION(read_be_u64_array_stats, uint64_t)
+STATS_FUNCTION(read_be_s64_array_stats, int64_t)
+STATS_FUNCTION(read_be_f64_array_stats, double)
+
+typedef struct stats_test
+{
+    stats_function function; ///< function under test
+    size_t width; ///< number of bytes in a value
+    int big; ///< 1 if the values are big endian
+    int is_float; ///< 1 if the values are floating point numbers
+} stats_test;
+
+static const stats_test tests[] = {
+    { test_read_le_u16_array_stats, 2, 0, 0 },
+    { test_read_le_s16_array_stats, 2, 0, 0 },
+    { test_read_le_u32_array_stats, 4, 0, 0 },
+    { test_read_le_s32_array_stats, 4, 0, 0 },
+    { test_read_le_f32_array_stats, 4, 0, 1 },
+    { test_read_le_u64_array_stats, 8, 0, 0 },
+    { test_read_le_s64_array_stats, 8, 0, 0 },
+    { test_read_le_f64_array_stats, 8, 0, 1 },
+    { test_read_be_u16_array_stats, 2, 1, 0 },
+    { test_read_be_s16_array_stats, 2, 1, 0 },
+    { test_read_be_u32_array_stats, 4, 1, 0 },
+    { test_read_be_s32_array_stats, 4, 1, 0 },
+    { test_read_be_f32_array_stats, 4, 1, 1 },
+    { test_read_be_u64_array_stats, 8, 1, 0 },
+    { test_read_be_s64_array_stats, 8, 1, 0 },
+    { test_read_be_f64_array_stats, 8, 1, 1 }
+};
+
+static unsigned char int_values[TEST_BYTES];
+static unsigned char float_values[2][2][TEST_BYTES]; // by order, then 32 or 64 bits
+static uint8_t validity_bits[(TEST_COUNT + 7) / 8];
+
+static int host_is_little(void)
+{
+    uint16_t one = 1;
+    unsigned char first;
+
+    memcpy(&first, &one, 1);
+    return first;
+}
+
+/// @brief Fills the test values
+///
+/// Floating point values are small integers, some of them NaN, so their
+/// sums are exact whatever order they are added in. Zeros are left out
+/// because either of them may be the minimum or maximum of 0 and -0.
+static void make_values(void)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(int_values); i++)
+        int_values[i] = (unsigned char)rand();
+    for (i = 0; i < sizeof(validity_bits); i++)
+        validity_bits[i] = (uint8_t)rand();
+
+    for (i = 0; i < TEST_COUNT; i++)
+    {
+        int n = rand() % 2000 - 1000;
+        double f = rand() % 16 == 0 ? NAN : (double)(n == 0 ? 1 : n);
+        float f32 = (float)f;
+
+        memcpy(float_values[0][0] + i * 4, &f32, 4);
+        memcpy(float_values[0][1] + i * 8, &f, 8);
+    }
+
+    conv_endian_bswap32_array(float_values[1][0], float_values[0][0], TEST_COUNT);
+    conv_endian_bswap64_array(float_values[1][1], float_values[0][1], TEST_COUNT);
+
+    // float_values[0] holds the values in the endianness of the machine
+    if (!host_is_little())
+    {
+        memcpy(float_values[0][0], float_values[1][0], TEST_BYTES);
+        conv_endian_bswap32_array(float_values[1][0], float_values[0][0], TEST_COUNT);
+        memcpy(float_values[0][1], float_values[1][1], TEST_BYTES);
+        conv_endian_bswap64_array(float_values[1][1], float_values[0][1], TEST_COUNT);
+    }
+}
+
+static int stats_equal(const conv_endian_stats* a, const conv_endian_stats* b)
+{
+    return a->count == b->count && a->null_count == b->null_count && a->nan_count == b->nan_count &&
+        a->min.u == b->min.u && a->max.u == b->max.u && a->sum.u == b->sum.u;
+}
+
+/*
+
+    Tests
+
+*/
+
+static void test_kernel(guarded_memory* guarded, guarded_memory* guarded_validity, conv_endian_kernel kernel)
+{
+    unsigned char expected[TEST_BYTES];
+    size_t t, count;
+    int with_validity;
+
+    for (t = 0; t < sizeof(tests) / sizeof(tests[0]); t++)
+    {
+        const stats_test* test = &tests[t];
+        const unsigned char* values = test->is_float ? float_values[test->big][test->width == 8] : int_values;
+
+        for (with_validity = 0; with_validity < 2; with_validity++)
+        {
+            for (count = 0; count <= TEST_COUNT; count++)
+            {
+                size_t bytes = count * test->width;
+                size_t validity_bytes = (count + 7) / 8;
+                unsigned char* at_start = guarded->data;
+                unsigned char* at_end = guarded_memory_end(guarded, bytes);
+                uint8_t* validity = NULL;
+                conv_endian_stats expected_stats, stats;
+                size_t split = count / 16 * 8;
+
+                // a bitmap that ends where the next page starts
+                if (with_validity)
+                {
+                    validity = guarded_memory_end(guarded_validity, validity_bytes);
+                    memcpy(validity, validity_bits, validity_bytes);
+                }
+
+                // the scalar kernel gives the expected results
+                conv_endian_set_kernel(CONV_ENDIAN_KERNEL_SCALAR);
+                memset(&expected_stats, 0, sizeof(expected_stats));
+                test->function(expected, values, count, validity, &expected_stats);
+                conv_endian_set_kernel(kernel);
+
+                // values read from the end and written to the start of the memory
+                memcpy(at_end, values, bytes);
+                memset(&stats, 0, sizeof(stats));
+                test->function(at_start, at_end, count, validity, &stats);
+                CHECK(memcmp(at_start, expected, bytes) == 0);
+                CHECK(stats_equal(&stats, &expected_stats));
+
+                // in place at the end of the memory
+                memset(&stats, 0, sizeof(stats));
+                test->function(at_end, at_end, count, validity, &stats);
+                CHECK(memcmp(at_end, expected, bytes) == 0);
+                CHECK(stats_equal(&stats, &expected_stats));
+
+                // read in two pieces merged into the same statistics, split on a byte of the bitmap
+                memcpy(at_end, values, bytes);
+                memset(&stats, 0, sizeof(stats));
+                test->function(at_start, at_end, split, validity, &stats);
+                test->function(at_start + split * test->width, at_end + split * test->width, count - split, validity == NULL ? NULL : validity + split / 8, &stats);
+                CHECK(memcmp(at_start, expected, bytes) == 0);
+                CHECK(stats_equal(&stats, &expected_stats));
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    guarded_memory guarded, guarded_validity;
+    int kernel;
+
+    // room for a source and a destination that do not overlap
+    if (guarded_memory_create(&guarded, 2 * TEST_BYTES) != 0 ||
+        guarded_memory_create(&guarded_validity, sizeof(validity_bits)) != 0)
+    {
+        perror("mmap");
+        return 1;
+    }
+
+    srand(1);
+    make_values();
+
+    for (kernel = CONV_ENDIAN_KERNEL_SCALAR; kernel <= (int)conv_endian_best_kernel(); kernel++)
+    {
+        printf("testing the %s kernel\n", conv_endian_kernel_name((conv_endian_kernel)kernel));
+        test_kernel(&guarded, &guarded_validity, (conv_endian_kernel)kernel);
+    }
+
+    guarded_memory_destroy(&guarded);
+    guarded_memory_destroy(&guarded_validity);
+
+    return test_finish();
+}
@@ -0,0 +1,135 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file conv_endian_test.h
+/// @brief Checks and guarded memory shared by the tests, on POSIX systems
+
+
+#ifndef CONV_ENDIAN_TEST_H
+#define CONV_ENDIAN_TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*
+
+    Checks
+
+    A failed check is reported with its line and counted, and the test
+    carries on so that one run shows every failure
+
+*/
+
+static int failures = 0;
+
+#define CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            fprintf(stderr, "%s:%d: %s failed\n", __FILE__, __LINE__, #condition); \
+            failures++; \
+        } \
+    } while (0)
+
+/// @brief Reports the result of a test
+/// @return exit status of the test, 0 if every check passed
+static int test_finish(void)
+{
+    if (failures != 0)
+    {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
+
+/*
+
+    Guarded memory
+
+    Accessible pages between two pages that cannot be accessed, so that
+    any access before or after an array placed at either end of them
+    faults
+
+*/
+
+typedef struct guarded_memory
+{
+    unsigned char* base; ///< whole mapping, including the guard pages
+    unsigned char* data; ///< first accessible byte
+    size_t size; ///< number of accessible bytes
+    size_t page; ///< number of bytes in a page
+} guarded_memory;
+
+/// @brief Maps accessible memory between two guard pages
+/// @param guarded memory to be mapped
+/// @param size number of accessible bytes, rounded up to whole pages
+/// @return 0 on success or -1 if the memory could not be mapped
+static int guarded_memory_create(guarded_memory* guarded, size_t size)
+{
+    guarded->page = (size_t)sysconf(_SC_PAGESIZE);
+    guarded->size = (size + guarded->page - 1) / guarded->page * guarded->page;
+    if (guarded->size == 0)
+        guarded->size = guarded->page;
+
+    guarded->base = (unsigned char*)mmap(NULL, guarded->size + 2 * guarded->page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (guarded->base == MAP_FAILED)
+        return -1;
+
+    guarded->data = guarded->base + guarded->page;
+
+    if (mprotect(guarded->base, guarded->page, PROT_NONE) != 0 ||
+        mprotect(guarded->data + guarded->size, guarded->page, PROT_NONE) != 0)
+    {
+        munmap(guarded->base, guarded->size + 2 * guarded->page);
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @brief Unmaps guarded memory
+/// @param guarded memory to be unmapped
+static void guarded_memory_destroy(guarded_memory* guarded)
+{
+    munmap(guarded->base, guarded->size + 2 * guarded->page);
+}
+
+/// @brief Gets the address of an array that ends where the accessible memory ends
+/// @param guarded guarded memory
+/// @param bytes number of bytes in the array, at most the size of the memory
+/// @return address of the array
+static unsigned char* guarded_memory_end(const guarded_memory* guarded, size_t bytes)
+{
+    return guarded->data + guarded->size - bytes;
+}
+
+#endif
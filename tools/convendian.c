@@ -0,0 +1,566 @@
+// This is free and unencumbered software released into the public domain.
+
+// Anyone is free to copy, modify, publish, use, compile, sell, or
+// distribute this software, either in source code form or as a compiled
+// binary, for any purpose, commercial or non-commercial, and by any
+// means.
+
+// In jurisdictions that recognize copyright laws, the author or authors
+// of this software dedicate any and all copyright interest in the
+// software to the public domain. We make this dedication for the benefit
+// of the public at large and to the detriment of our heirs and
+// successors. We intend this dedication to be an overt act of
+// relinquishment in perpetuity of all present and future rights to this
+// software under copyright law.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+// OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+
+// For more information, please refer to <https://unlicense.org>
+
+
+/// @file convendian.c
+/// @brief A command line tool that converts the endianness of arrays and records in files
+
+
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "conv_endian.h"
+#include "conv_endian_format.h"
+#include "conv_endian_parallel.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+
+    Usage: convendian [options] input [output]
+
+        --type u16|s16|u32|s32|u64|s64|f32|f64
+                            type of the elements, u32 by default
+        --from big|little|native
+        --to big|little|native
+                            endianness of the input and of the output,
+                            big and native by default
+        --format fmt        converts records described by a format string
+                            of conv_endian_format.h from its endianness
+                            into the native one, instead of elements,
+                            and cannot be combined with --from or --to
+        --offset bytes      first byte of the input to be converted
+        --length bytes      number of bytes to be converted, up to the end
+                            of the input by default
+        --threads n         number of threads, 0 for one per processor
+        --no-huge-pages     does not ask for huge pages
+        --quiet             does not print statistics
+
+    Without an output, or when the output is the input itself, the range is
+    converted in place, otherwise the output receives the converted range
+    alone. Sizes may end with k, m or g.
+
+    The input and the output are mapped into memory and converted with the
+    worker pool, so the tool is only built with the pool on POSIX systems.
+    Mappings of at least HUGE_PAGE_MIN bytes are advised to use huge pages,
+    which saves most of the page table walks of a large conversion on
+    kernels that back files with them.
+
+    A trailing partial element or record is copied unchanged, and the time
+    and throughput of the conversion are printed to stderr.
+
+*/
+
+#define HUGE_PAGE_MIN ((size_t)64 * 1024 * 1024)
+
+typedef struct tool_options
+{
+    const char* input;
+    const char* output;
+    size_t width;
+    int from_big;
+    int to_big;
+    int orders_given;
+    const char* format;
+    uint64_t offset;
+    uint64_t length;
+    unsigned threads;
+    int huge_pages;
+    int quiet;
+} tool_options;
+
+static int host_is_big_endian(void)
+{
+    const uint16_t probe = 1;
+    return *(const unsigned char*)&probe == 0;
+}
+
+static int parse_size(const char* text, uint64_t* size)
+{
+    char* end;
+    unsigned long long value;
+    unsigned shift = 0;
+
+    errno = 0;
+    value = strtoull(text, &end, 0);
+    if (errno != 0 || end == text || *text == '-')
+        return -1;
+
+    switch (*end)
+    {
+    case 'k': case 'K':
+        shift = 10;
+        end++;
+        break;
+    case 'm': case 'M':
+        shift = 20;
+        end++;
+        break;
+    case 'g': case 'G':
+        shift = 30;
+        end++;
+        break;
+    default:
+        break;
+    }
+
+    // a suffix must not shift the size out of 64 bits
+    if (*end != '\0' || value > (UINT64_MAX >> shift))
+        return -1;
+
+    *size = value << shift;
+    return 0;
+}
+
+static int parse_order(const char* text, int* big)
+{
+    if (strcmp(text, "big") == 0)
+        *big = 1;
+    else if (strcmp(text, "little") == 0)
+        *big = 0;
+    else if (strcmp(text, "native") == 0)
+        *big = host_is_big_endian();
+    else
+        return -1;
+
+    return 0;
+}
+
+static int parse_type(const char* text, size_t* width)
+{
+    static const char* const names[] = { "u16", "s16", "u32", "s32", "f32", "u64", "s64", "f64" };
+    static const size_t widths[] = { 2, 2, 4, 4, 4, 8, 8, 8 };
+    size_t i;
+
+    for (i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        if (strcmp(text, names[i]) == 0)
+        {
+            *width = widths[i];
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+static int parse_options(int argc, char** argv, tool_options* options)
+{
+    int i;
+
+    options->input = NULL;
+    options->output = NULL;
+    options->width = 4;
+    options->from_big = 1;
+    options->to_big = host_is_big_endian();
+    options->orders_given = 0;
+    options->format = NULL;
+    options->offset = 0;
+    options->length = UINT64_MAX;
+    options->threads = 0;
+    options->huge_pages = 1;
+    options->quiet = 0;
+
+    for (i = 1; i < argc; i++)
+    {
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        uint64_t number;
+
+        if (argv[i][0] != '-' || argv[i][1] == '\0')
+        {
+            if (options->input == NULL)
+                options->input = argv[i];
+            else if (options->output == NULL)
+                options->output = argv[i];
+            else
+                return -1;
+            continue;
+        }
+
+        if (strcmp(argv[i], "--no-huge-pages") == 0)
+        {
+            options->huge_pages = 0;
+            continue;
+        }
+
+        if (strcmp(argv[i], "--quiet") == 0)
+        {
+            options->quiet = 1;
+            continue;
+        }
+
+        if (value == NULL)
+            return -1;
+
+        if (strcmp(argv[i], "--type") == 0)
+        {
+            if (parse_type(value, &options->width) != 0)
+                return -1;
+        }
+        else if (strcmp(argv[i], "--from") == 0)
+        {
+            if (parse_order(value, &options->from_big) != 0)
+                return -1;
+            options->orders_given = 1;
+        }
+        else if (strcmp(argv[i], "--to") == 0)
+        {
+            if (parse_order(value, &options->to_big) != 0)
+                return -1;
+            options->orders_given = 1;
+        }
+        else if (strcmp(argv[i], "--format") == 0)
+        {
+            options->format = value;
+        }
+        else if (strcmp(argv[i], "--offset") == 0)
+        {
+            if (parse_size(value, &options->offset) != 0)
+                return -1;
+        }
+        else if (strcmp(argv[i], "--length") == 0)
+        {
+            if (parse_size(value, &options->length) != 0)
+                return -1;
+        }
+        else if (strcmp(argv[i], "--threads") == 0)
+        {
+            if (parse_size(value, &number) != 0 || number > 4096)
+                return -1;
+            options->threads = (unsigned)number;
+        }
+        else
+        {
+            return -1;
+        }
+
+        i++;
+    }
+
+    // a format string gives the endianness of its records itself
+    if (options->format != NULL && options->orders_given)
+        return -1;
+
+    return options->input != NULL ? 0 : -1;
+}
+
+// whether output names the same file as input, which then has to be
+// converted in place instead of being truncated while it is read
+static int same_file(const char* input, const char* output)
+{
+    struct stat in_info, out_info;
+
+    if (stat(input, &in_info) != 0 || stat(output, &out_info) != 0)
+        return 0;
+
+    return in_info.st_dev == out_info.st_dev && in_info.st_ino == out_info.st_ino;
+}
+
+/*
+
+    Record permutations
+
+    Unpacking a record only moves its bytes, so unpacking a record whose
+    bytes hold their own offsets gives the permutation of the format. Two
+    records are unpacked, one for the low byte and one for the high byte of
+    every offset, so records of up to 65536 bytes are supported.
+
+*/
+
+static uint16_t* format_permutation(const conv_endian_format* format)
+{
+    size_t size = conv_endian_format_size(format);
+    unsigned char* record = (unsigned char*)malloc(size * 2);
+    uint16_t* perm = (uint16_t*)malloc(size * sizeof(uint16_t));
+    size_t i;
+
+    if (record == NULL || perm == NULL || size > 65536)
+    {
+        free(record);
+        free(perm);
+        return NULL;
+    }
+
+    for (i = 0; i < size; i++)
+    {
+        record[i] = (unsigned char)i;
+        record[size + i] = (unsigned char)(i >> 8);
+    }
+
+    if (conv_endian_unpack(format, record, record, 1) != 0 || conv_endian_unpack(format, record + size, record + size, 1) != 0)
+    {
+        free(record);
+        free(perm);
+        return NULL;
+    }
+
+    for (i = 0; i < size; i++)
+        perm[i] = (uint16_t)(record[i] | (record[size + i] << 8));
+
+    free(record);
+    return perm;
+}
+
+/*
+
+    Mappings
+
+*/
+
+typedef struct mapping
+{
+    void* base;
+    size_t size;
+    unsigned char* data;
+} mapping;
+
+static int map_range(mapping* map, int fd, uint64_t offset, size_t length, int writable, int huge_pages)
+{
+    uint64_t page = (uint64_t)sysconf(_SC_PAGESIZE);
+    uint64_t start = offset - offset % page;
+    int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+
+    map->size = (size_t)(offset - start) + length;
+    map->base = mmap(NULL, map->size, prot, MAP_SHARED, fd, (off_t)start);
+    if (map->base == MAP_FAILED)
+        return -1;
+
+    map->data = (unsigned char*)map->base + (offset - start);
+
+    madvise(map->base, map->size, MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+    if (huge_pages && map->size >= HUGE_PAGE_MIN)
+        madvise(map->base, map->size, MADV_HUGEPAGE);
+#else
+    (void)huge_pages;
+#endif
+
+    return 0;
+}
+
+static double now_seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/*
+
+    Conversion
+
+*/
+
+static int convert(conv_endian_pool* pool, const tool_options* options, const uint16_t* perm, size_t unit,
+    unsigned char* dst, const unsigned char* src, size_t length)
+{
+    size_t count = length / unit;
+    size_t tail = length - count * unit;
+
+    if (perm != NULL)
+    {
+        if (conv_endian_parallel_permute_records(pool, dst, src, count, unit, perm) != 0)
+            return -1;
+    }
+    else if (options->from_big == options->to_big)
+    {
+        if (dst != src)
+            memcpy(dst, src, count * unit);
+    }
+    else if (unit == 2)
+    {
+        conv_endian_parallel_bswap16_array(pool, dst, src, count);
+    }
+    else if (unit == 4)
+    {
+        conv_endian_parallel_bswap32_array(pool, dst, src, count);
+    }
+    else
+    {
+        conv_endian_parallel_bswap64_array(pool, dst, src, count);
+    }
+
+    if (tail != 0 && dst != src)
+        memcpy(dst + count * unit, src + count * unit, tail);
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    tool_options options;
+    const conv_endian_format* format = NULL;
+    uint16_t* perm = NULL;
+    conv_endian_pool* pool;
+    mapping in, out;
+    struct stat info;
+    size_t unit, length;
+    int in_fd, out_fd = -1;
+    int result = 1;
+    double start, seconds;
+
+    if (parse_options(argc, argv, &options) != 0)
+    {
+        fprintf(stderr, "usage: %s [--type u16|s16|u32|s32|u64|s64|f32|f64] [--from big|little|native] [--to big|little|native] "
+            "[--format fmt] [--offset bytes] [--length bytes] [--threads n] [--no-huge-pages] [--quiet] input [output]\n"
+            "--format cannot be combined with --from or --to\n", argv[0]);
+        return 2;
+    }
+
+    if (options.output != NULL && same_file(options.input, options.output))
+        options.output = NULL;
+
+    unit = options.width;
+
+    if (options.format != NULL)
+    {
+        format = conv_endian_format_get(options.format);
+        if (format == NULL || conv_endian_format_size(format) == 0)
+        {
+            fprintf(stderr, "%s: invalid format string %s\n", argv[0], options.format);
+            return 2;
+        }
+
+        perm = format_permutation(format);
+        if (perm == NULL)
+        {
+            fprintf(stderr, "%s: records of %s are too large\n", argv[0], options.format);
+            return 1;
+        }
+
+        unit = conv_endian_format_size(format);
+    }
+
+    in_fd = open(options.input, options.output == NULL ? O_RDWR : O_RDONLY);
+    if (in_fd < 0 || fstat(in_fd, &info) != 0)
+    {
+        perror(options.input);
+        free(perm);
+        return 1;
+    }
+
+    if (options.offset > (uint64_t)info.st_size)
+        options.offset = (uint64_t)info.st_size;
+    if (options.length > (uint64_t)info.st_size - options.offset)
+        options.length = (uint64_t)info.st_size - options.offset;
+
+    if (options.length > SIZE_MAX)
+    {
+        fprintf(stderr, "%s: %s is too large to be mapped\n", argv[0], options.input);
+        close(in_fd);
+        free(perm);
+        return 1;
+    }
+
+    length = (size_t)options.length;
+
+    pool = conv_endian_pool_create(options.threads);
+    if (pool == NULL)
+    {
+        fprintf(stderr, "%s: could not start the threads\n", argv[0]);
+        close(in_fd);
+        free(perm);
+        return 1;
+    }
+
+    start = now_seconds();
+
+    if (length == 0)
+    {
+        // an empty output still has to be created
+        if (options.output != NULL)
+        {
+            out_fd = open(options.output, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+            if (out_fd < 0)
+                perror(options.output);
+            else
+                result = 0;
+        }
+        else
+        {
+            result = 0;
+        }
+    }
+    else if (map_range(&in, in_fd, options.offset, length, options.output == NULL, options.huge_pages) != 0)
+    {
+        perror(options.input);
+    }
+    else
+    {
+        if (options.output == NULL)
+        {
+            if (convert(pool, &options, perm, unit, in.data, in.data, length) == 0)
+                result = 0;
+            else
+                fprintf(stderr, "%s: out of memory\n", argv[0]);
+        }
+        else
+        {
+            out_fd = open(options.output, O_RDWR | O_CREAT | O_TRUNC, 0666);
+
+            if (out_fd < 0 || ftruncate(out_fd, (off_t)length) != 0 ||
+                map_range(&out, out_fd, 0, length, 1, options.huge_pages) != 0)
+            {
+                perror(options.output);
+            }
+            else
+            {
+                if (convert(pool, &options, perm, unit, out.data, in.data, length) == 0)
+                    result = 0;
+                else
+                    fprintf(stderr, "%s: out of memory\n", argv[0]);
+                munmap(out.base, out.size);
+            }
+        }
+
+        munmap(in.base, in.size);
+    }
+
+    seconds = now_seconds() - start;
+
+    if (result == 0 && !options.quiet)
+    {
+        fprintf(stderr, "%s: converted %zu bytes in %.3f s (%.2f GB/s) with %u thread%s and the %s kernel\n",
+            argv[0], length, seconds, seconds > 0.0 ? (double)length / seconds * 1e-9 : 0.0,
+            conv_endian_pool_threads(pool), conv_endian_pool_threads(pool) == 1 ? "" : "s",
+            conv_endian_kernel_name(conv_endian_get_kernel()));
+    }
+
+    if (out_fd >= 0)
+        close(out_fd);
+    close(in_fd);
+    conv_endian_pool_destroy(pool);
+    free(perm);
+    return result;
+}